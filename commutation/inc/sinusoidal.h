@@ -0,0 +1,90 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   sinusoidal.h
+ *
+ * @brief  Header file for the sinusoidal commutation module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "motor.h"
+
+/**
+ * @defgroup SinusoidalCommutation Sinusoidal commutation module
+ * @brief    Hall-interpolated sine-wave commutation method module, voltage mode without current sensing
+ * @details  Angles are electrical, with 65536 counts per revolution, and give the phase of the phase A back-EMF:
+ *           phase A is driven with the sine of the angle, phases B and C 120 and 240 degrees behind it.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define SINUSOIDAL_ANGLE_COUNTS TRIG_ANGLE_COUNTS /* Electrical angle counts per revolution */
+#define SINUSOIDAL_ANGLE_COUNTS_PER_RAD TRIG_ANGLE_COUNTS_PER_RAD
+#define SINUSOIDAL_ANGLE_HALF_TURN TRIG_ANGLE_HALF_TURN
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initialize sinusoidal commutation method with a configuration
+ * @param   cfg Motor configuration to apply
+ * @return  true if initialization successful, false otherwise
+ */
+bool sinusoidal_init(const MotorConfig_t *cfg);
+
+/**
+ * @brief   Estimate the electrical angle from the Hall state and the time since its last transition
+ * @details The rotor entered the Hall sector at the boundary it was moving towards, so the angle runs from that
+ *          boundary at the electrical speed and is held within the sector. At standstill it is the sector centre,
+ *          at most 30 degrees from the rotor.
+ * @param   hall 3-bit Hall state
+ * @param   velocity_elec_hz Signed electrical speed, positive forward
+ * @param   elapsed_us Time since the last Hall transition
+ * @param   angle Output electrical angle
+ * @return  true if the Hall state is valid, false otherwise
+ */
+bool sinusoidal_hall_to_angle(uint8_t hall, float velocity_elec_hz, uint32_t elapsed_us, uint16_t *angle);
+
+/**
+ * @brief   Hall sector, and so 6-step commutation step, that an electrical angle lies in
+ * @details Inverse of sinusoidal_hall_to_angle(), for feedback without Hall sensors.
+ * @param   angle Electrical angle
+ * @return  Sector (0-5)
+ */
+uint8_t sinusoidal_angle_to_sector(uint16_t angle);
+
+/**
+ * @brief   Convert an electrical angle and amplitude into three high-side duties
+ * @details Min-max (third-harmonic) injection centres the three duties in the PWM range, so an amplitude of 1 gives
+ *          a line-to-line voltage amplitude of the full bus, as much as 6-step at full duty.
+ * @param   angle Electrical angle of the phase A voltage
+ * @param   amplitude Modulation amplitude [0.0, 1.0]
+ * @param   phase_duty Output per-phase duties [0.0, 1.0]
+ */
+void sinusoidal_angle_to_duties(uint16_t angle, float amplitude, float phase_duty[NUM_MOTOR_PHASES]);
+
+/**
+ * @brief   Split the phase currents into the parts in phase with and leading an electrical angle
+ * @param   angle Electrical angle to project on
+ * @param   phase_currents_A Phase currents
+ * @param   in_phase_A Output current amplitude in phase with the angle
+ * @param   quadrature_A Output current amplitude 90 degrees ahead of the angle
+ */
+void sinusoidal_project_currents(uint16_t angle, const float phase_currents_A[NUM_MOTOR_PHASES], float *in_phase_A,
+                                 float *quadrature_A);
+
+/** @} */
@@ -42,6 +42,15 @@ bool trapezoidal_init(const MotorConfig_t *cfg);
  */
 uint8_t trapezoidal_hall_to_step(uint8_t hall);
 
+/**
+ * @brief   Get the phases switched high and low for a trapezoidal commutation step
+ * @param   step Commutation step index (0-5)
+ * @param   high Output phase connected to the DC bus through the PWM-ed high-side switch
+ * @param   low Output phase connected to ground through the low-side switch
+ * @return  true if the step is valid, false otherwise
+ */
+bool trapezoidal_step_to_phases(uint8_t step, MotorPhase_t *high, MotorPhase_t *low);
+
 /** @} */
 
 /** @} */
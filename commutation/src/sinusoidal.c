@@ -0,0 +1,123 @@
+/*******************************************************************************************************************************
+ * @file   sinusoidal.c
+ *
+ * @brief  Source file for the sinusoidal commutation module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "sinusoidal.h"
+#include "trapezoidal.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define SINUSOIDAL_SECTOR_COUNTS (SINUSOIDAL_ANGLE_COUNTS / 6.0f)
+#define SINUSOIDAL_INV_SQRT3 0.57735027f
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+bool sinusoidal_init(const MotorConfig_t *cfg)
+{
+    (void)cfg;
+    return cfg != NULL;
+}
+
+bool sinusoidal_hall_to_angle(uint8_t hall, float velocity_elec_hz, uint32_t elapsed_us, uint16_t *angle)
+{
+    /* The trapezoidal step of a Hall state is its sector, in which the phase A back-EMF angle runs from
+     * 30 + 60 * sector to 90 + 60 * sector degrees */
+    const uint8_t sector = trapezoidal_hall_to_step(hall);
+    if (sector >= 6U || angle == NULL) {
+        return false;
+    }
+
+    float offset = (velocity_elec_hz * (float)elapsed_us * 1e-6f) * SINUSOIDAL_ANGLE_COUNTS;
+    if (velocity_elec_hz < 0.0f) {
+        offset += SINUSOIDAL_SECTOR_COUNTS;
+    } else if (velocity_elec_hz == 0.0f) {
+        offset = 0.5f * SINUSOIDAL_SECTOR_COUNTS;
+    }
+    if (offset > SINUSOIDAL_SECTOR_COUNTS) {
+        offset = SINUSOIDAL_SECTOR_COUNTS;
+    } else if (offset < 0.0f) {
+        offset = 0.0f;
+    }
+
+    const float start = (0.5f + (float)sector) * SINUSOIDAL_SECTOR_COUNTS;
+    *angle = (uint16_t)(uint32_t)(start + offset);
+    return true;
+}
+
+uint8_t sinusoidal_angle_to_sector(uint16_t angle)
+{
+    /* Sector 0 starts half a sector past zero */
+    const uint16_t offset = (uint16_t)(angle - (uint16_t)(0.5f * SINUSOIDAL_SECTOR_COUNTS));
+    return (uint8_t)(((uint32_t)offset * 6U) >> 16);
+}
+
+void sinusoidal_angle_to_duties(uint16_t angle, float amplitude, float phase_duty[NUM_MOTOR_PHASES])
+{
+    if (phase_duty == NULL) {
+        return;
+    }
+
+    if (amplitude > 1.0f) {
+        amplitude = 1.0f;
+    } else if (amplitude < 0.0f) {
+        amplitude = 0.0f;
+    }
+
+    float v[NUM_MOTOR_PHASES];
+    v[MOTOR_PHASE_A] = trig_sin(angle);
+    v[MOTOR_PHASE_B] = trig_sin((uint16_t)(angle - TRIG_ANGLE_THIRD_TURN));
+    v[MOTOR_PHASE_C] = trig_sin((uint16_t)(angle + TRIG_ANGLE_THIRD_TURN));
+
+    /* Shift the common mode so the highest and lowest phases sit symmetrically about half duty */
+    float v_max = v[0];
+    float v_min = v[0];
+    for (int i = 1; i < NUM_MOTOR_PHASES; ++i) {
+        if (v[i] > v_max) {
+            v_max = v[i];
+        }
+        if (v[i] < v_min) {
+            v_min = v[i];
+        }
+    }
+    const float common = 0.5f * (v_max + v_min);
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        phase_duty[i] = 0.5f + amplitude * SINUSOIDAL_INV_SQRT3 * (v[i] - common);
+    }
+}
+
+void sinusoidal_project_currents(uint16_t angle, const float phase_currents_A[NUM_MOTOR_PHASES], float *in_phase_A,
+                                 float *quadrature_A)
+{
+    if (phase_currents_A == NULL || in_phase_A == NULL || quadrature_A == NULL) {
+        return;
+    }
+
+    float in_phase = 0.0f;
+    float quadrature = 0.0f;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        const uint16_t phase_angle = (uint16_t)(angle - (uint16_t)i * TRIG_ANGLE_THIRD_TURN);
+        float sin_angle;
+        float cos_angle;
+        trig_sincos(phase_angle, &sin_angle, &cos_angle);
+        in_phase += phase_currents_A[i] * sin_angle;
+        quadrature += phase_currents_A[i] * cos_angle;
+    }
+    *in_phase_A = in_phase * (2.0f / 3.0f);
+    *quadrature_A = quadrature * (2.0f / 3.0f);
+}
@@ -8,6 +8,7 @@
  *******************************************************************************************************************************/
 
 /* Standard library Headers */
+#include <stddef.h>
 
 /* Inter-component Headers */
 
@@ -28,6 +29,16 @@ static const uint8_t hall_to_step[8] = {
     0xFFU  /* 111 */
 };
 
+/* Each step drives the phase with the positive back-EMF plateau high and the negative one low; step + 3 swaps them */
+static const MotorPhase_t step_to_phases[6][2] = {
+    { MOTOR_PHASE_A, MOTOR_PHASE_B }, /* Step 0 */
+    { MOTOR_PHASE_A, MOTOR_PHASE_C }, /* Step 1 */
+    { MOTOR_PHASE_B, MOTOR_PHASE_C }, /* Step 2 */
+    { MOTOR_PHASE_B, MOTOR_PHASE_A }, /* Step 3 */
+    { MOTOR_PHASE_C, MOTOR_PHASE_A }, /* Step 4 */
+    { MOTOR_PHASE_C, MOTOR_PHASE_B }  /* Step 5 */
+};
+
 /*******************************************************************************************************************************
  * Function Definitions
  *******************************************************************************************************************************/
@@ -42,3 +53,14 @@ uint8_t trapezoidal_hall_to_step(uint8_t hall)
 {
     return hall < 8U ? hall_to_step[hall] : 0xFFU;
 }
+
+bool trapezoidal_step_to_phases(uint8_t step, MotorPhase_t *high, MotorPhase_t *low)
+{
+    if (step >= 6U || high == NULL || low == NULL) {
+        return false;
+    }
+
+    *high = step_to_phases[step][0];
+    *low = step_to_phases[step][1];
+    return true;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   blackbox.h
+ *
+ * @brief  Header file for the fault black-box recorder
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup BlackBox Fault black-box recorder
+ * @brief    Ring of compact tick snapshots around the first new fault
+ * @details  Every tick writes one EscBlackBoxSample_t into a fixed ring in the ESC instance. A bit newly set in
+ *           fault_flags, or a new platform fault, triggers the record: BLACKBOX_POST_TRIGGER_SAMPLES more
+ *           snapshots are taken, then the ring freezes with the lead-up and the aftermath, and stays frozen
+ *           through esc_reset() until blackbox_rearm(). Faults after the trigger only show in the snapshots.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Empty the record and arm it
+ * @param   esc ESC instance
+ */
+void blackbox_reset(Esc_t *esc);
+
+/**
+ * @brief   Rearm a triggered record, keeping its snapshots until they are overwritten
+ * @details Faults still latched do not trigger again; only bits set after the rearm do.
+ * @param   esc ESC instance
+ */
+void blackbox_rearm(Esc_t *esc);
+
+/**
+ * @brief   Take this tick's snapshot and check for a new fault
+ * @param   esc ESC instance
+ * @param   dt_us Time since last tick in microseconds
+ */
+void blackbox_record(Esc_t *esc, uint32_t dt_us);
+
+/**
+ * @brief   Check whether the record has frozen after a trigger
+ * @param   esc ESC instance
+ * @return  true once the post-trigger snapshots are in
+ */
+bool blackbox_is_frozen(const Esc_t *esc);
+
+/**
+ * @brief   Number of snapshots held
+ * @param   esc ESC instance
+ * @return  Snapshots, up to BLACKBOX_SAMPLES
+ */
+uint32_t blackbox_get_num_samples(const Esc_t *esc);
+
+/**
+ * @brief   Position of the trigger snapshot
+ * @param   esc ESC instance
+ * @return  Index for blackbox_get_sample(), or -1 if not triggered or already overwritten
+ */
+int32_t blackbox_get_trigger_index(const Esc_t *esc);
+
+/**
+ * @brief   Locate one snapshot in the ring, oldest first
+ * @param   esc ESC instance
+ * @param   index Snapshot index, 0 for the oldest held
+ * @return  The snapshot, or NULL if index is not below blackbox_get_num_samples()
+ */
+const EscBlackBoxSample_t *blackbox_peek_sample(const Esc_t *esc, uint32_t index);
+
+/**
+ * @brief   Read one snapshot, oldest first
+ * @param   esc ESC instance
+ * @param   index Snapshot index, 0 for the oldest held
+ * @param   sample Output snapshot
+ * @return  true if index is below blackbox_get_num_samples()
+ */
+bool blackbox_get_sample(const Esc_t *esc, uint32_t index, EscBlackBoxSample_t *sample);
+
+/** @} */
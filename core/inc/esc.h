@@ -15,6 +15,9 @@
 #include <math.h>
 
 /* Inter-component Headers */
+#include "hal_motor.h"
+#include "pid.h"
+#include "thermal.h"
 
 /* Intra-component Headers */
 #include "motor.h"
@@ -25,13 +28,13 @@
 #define HALL_INVALID ((uint8_t)0xFFU)
 
 /* Preprocessor definitions for config validity, subject to change. */
-/* Set to zero temporarily */
 #define OVERTEMP_THRESHOLD 75.0f /*75 degrees celcius*/
 #define UNDERVOLT_LOCKOUT 0.0f
-#define OVERVOLT_LOCKOUT 0.0f
+#define OVERVOLT_LOCKOUT 60.0f /*60 volts, below the 100 V FET rating*/
 #define MAX_PWM_DUTY 2000.0f /*2000 microseconds*/
-#define MAX_RPM 0.0f
-#define MAX_PHASE_CURRENT 0.0f 
+#define MAX_RPM 6000.0f
+#define MAX_PHASE_CURRENT 100.0f /*100 amps*/
+#define MAX_DEAD_TIME_NS 2000U /*2 microseconds*/
 
 /* Preprocessor definitions for ESC deadbands, subject to change. */
 #define DEADBAND_THROTTLE 0.01f
@@ -41,10 +44,119 @@
 #define THROTTLE_CMD_MAX 1.0f
 #define THROTTLE_CMD_MIN -1.0f
 
+/* Preprocessor definitions for max and min brake values*/
+#define BRAKE_CMD_MAX 1.0f
+#define BRAKE_CMD_MIN 0.0f
+
 /* Preprocessor definitions for useful constants */
 #define HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION 6.0f
 #define MICROSECONDS_PER_MINUTE 60000000.0f
 #define MIN_PERIOD_BETWEEN_HALL_TRANSITIONS_US 10U /*10 microseconds*/
+#define MICROSECONDS_PER_SECOND 1000000.0f
+#define HALL_SPEED_TIMEOUT_US 100000U /*Speed reads zero after 100 ms without a Hall transition*/
+
+/* Preprocessor definitions for direction reversal and current limiting, subject to change. */
+#define REVERSAL_SPEED_THRESHOLD_RPM 60.0f /*Braking ends and the sequence flips below this speed*/
+#define CURRENT_LIMIT_FRACTION 0.8f /*Regulate to 80% of max_phase_current_A so overshoot stays below the trip*/
+#define CURRENT_LIMIT_KP 0.03f  /*Duty per amp*/
+#define CURRENT_LIMIT_KI 15.0f  /*Duty per amp-second*/
+#define BEMF_DUTY_LEARNING_RATE 0.01f
+
+/* Preprocessor definitions for regenerative braking, subject to change. */
+#define REGEN_OVLO_MARGIN_V 5.0f       /*Regen current reaches zero this far below vbus_ovlo_V*/
+#define REGEN_FOLDBACK_BAND_V 5.0f     /*Regen current folds back linearly over this band below the margin*/
+#define DYNAMIC_BRAKE_OVLO_MARGIN_V 5.0f /*Dynamic braking releases this far below vbus_ovlo_V*/
+
+/* Preprocessor definitions for sinusoidal commutation, subject to change. */
+#define SINE_LEAD_RATE_PER_S 20.0f         /*Lead angle correction per second per radian of current angle error*/
+#define SINE_MAX_LEAD_DEG 60.0f            /*Electrical lead angle limit*/
+#define SINE_LEAD_MIN_CURRENT_FRACTION 0.05f /*Lead holds below this torque current, as a fraction of max_phase_current_A*/
+
+/* Preprocessor definitions for field weakening and MTPA, subject to change. */
+#define FIELD_WEAKENING_DUTY 0.95f             /*Sinusoidal duty above which the field weakening current rises*/
+#define FIELD_WEAKENING_RATE_A_PER_S 2000.0f   /*Field weakening current slew per unit of error*/
+#define FIELD_WEAKENING_CURRENT_FRACTION 0.95f /*Current vector held to this fraction of the limit*/
+#define MTPA_TABLE_POINTS 17U                  /*MTPA table entries, torque current from zero to max_phase_current_A*/
+
+/* Preprocessor definitions for dead-time compensation, subject to change. */
+#define DEAD_TIME_COMP_CURRENT_FRACTION 0.02f /*Correction ramps in up to this fraction of max_phase_current_A*/
+
+/* Preprocessor definitions for the fault black box, subject to change. */
+#define BLACKBOX_SAMPLES 256U              /*Tick snapshots held, before and after the trigger*/
+#define BLACKBOX_POST_TRIGGER_SAMPLES 64U  /*Snapshots taken after the trigger before the record freezes*/
+#define BLACKBOX_HAL_FAULT_ACTIVE 0x80U    /*Snapshot hal_fault bit: nFAULT asserted, whatever the fault type*/
+
+/* Preprocessor definitions for the software oscilloscope, subject to change. */
+#define SCOPE_MAX_CHANNELS 4U              /*Signals captured per frame*/
+#define SCOPE_BUFFER_SAMPLES 4096U         /*Capture buffer, shared by the channels: 1024 frames at four*/
+
+/* Preprocessor definitions for the parameter store, subject to change. */
+#define ESC_CONFIG_VERSION 2U              /*Stored EscConfig_t layout; bump on any change so old copies are ignored*/
+
+/* Preprocessor definitions for sensorless startup and the flux observer, subject to change. */
+#define SENSORLESS_OBSERVER_RATE_PER_S 1000.0f /*Rate at which the observer pulls its flux to flux_linkage_Wb*/
+#define SENSORLESS_PLL_KP 2000.0f             /*PLL speed per radian of angle error, 1000 rad/s critically damped*/
+#define SENSORLESS_PLL_KI 1.0e6f              /*PLL speed change per second per radian of angle error*/
+#define SENSORLESS_ALIGN_TIME_US 400000U      /*Parking the rotor with the current vector takes this long*/
+#define SENSORLESS_STARTUP_CURRENT_FRACTION 0.5f /*Open-loop current, as a fraction of max_phase_current_A*/
+#define SENSORLESS_OPEN_LOOP_ACCEL_RPM_PER_S 500.0f /*Open-loop speed ramp*/
+#define SENSORLESS_HANDOVER_RPM 300.0f        /*Open-loop speed at which the observer may take over*/
+#define SENSORLESS_DROPOUT_RPM 150.0f         /*Below this speed the observer hands back to the startup*/
+#define SENSORLESS_CONVERGE_TIME_US 20000U    /*The observer must track the open loop for this long to take over*/
+#define SENSORLESS_CONVERGE_SPEED_TOLERANCE 0.2f /*PLL speed within this fraction of the open-loop speed*/
+#define SENSORLESS_CONVERGE_FLUX_TOLERANCE 0.25f /*Observer flux within this fraction of flux_linkage_Wb*/
+#define SENSORLESS_STARTUP_TIMEOUT_US 1000000U /*Open loop at the handover speed this long without converging restarts*/
+#define SENSORLESS_MAX_STARTS 3U              /*Failed startups in a row that latch ESC_FAULT_STALL*/
+#define SENSORLESS_COAST_TIMEOUT_US 50000U    /*Bridge off longer than this forgets the speed*/
+#define SENSORLESS_CATCH_CURRENT_FRACTION 0.1f /*Catch pulse end current, as a fraction of max_phase_current_A*/
+#define SENSORLESS_CATCH_TIMEOUT_US 2000U     /*A catch pulse short of its current this long finds the rotor at rest*/
+#define SENSORLESS_CATCH_GAP_US 300U          /*Between catch pulses; under half a turn at MAX_RPM with the pulses*/
+
+/* Preprocessor definitions for motor parameter identification, subject to change. */
+#define MOTOR_ID_LOW_CURRENT_FRACTION 0.2f   /*First resistance point, as a fraction of max_phase_current_A*/
+#define MOTOR_ID_HIGH_CURRENT_FRACTION 0.4f  /*Second resistance point, reached by the inductance voltage step*/
+#define MOTOR_ID_RAMP_DUTY_PER_S 0.2f        /*Test voltage ramp, slow against the winding time constant*/
+#define MOTOR_ID_SETTLE_US 200000U           /*Rotor at rest on the first point this long before measuring*/
+#define MOTOR_ID_REST_CURRENT_FRACTION 0.005f /*Quadrature current of a rotor at rest on the test vector, at most*/
+#define MOTOR_ID_REST_TIMEOUT_US 5000000U    /*A rotor still swinging on the test vector this long fails*/
+#define MOTOR_ID_STEP_WINDOW_US 50000U       /*Step response integrated over this long, many winding time constants*/
+#define MOTOR_ID_AVERAGE_US 20000U           /*Current and bus voltage averaged over this long at each point*/
+#define MOTOR_ID_SPIN_CURRENT_FRACTION 0.5f  /*Open-loop spin current, as a fraction of max_phase_current_A*/
+#define MOTOR_ID_SPIN_ACCEL_RPM_PER_S 500.0f /*Open-loop speed ramp*/
+#define MOTOR_ID_SPIN_RPM 600.0f             /*Speed the flux linkage is measured at*/
+#define MOTOR_ID_SPIN_HOLD_US 300000U        /*Open loop at speed this long before the coast, for the hunting to die*/
+#define MOTOR_ID_PULSE_CURRENT_FRACTION 0.2f /*Flux pulse end current, as a fraction of max_phase_current_A*/
+#define MOTOR_ID_PULSE_MAX_US 3000U          /*Longest flux pulse, for windings too slow to reach the pulse current*/
+#define MOTOR_ID_PULSE_MIN_FRACTION 0.03f    /*A longest flux pulse short of this current finds no rotation*/
+#define MOTOR_ID_PULSE_GAP_US 1000U          /*Between flux pulses; with the longest pulse, under half a turn*/
+#define MOTOR_ID_PULSES 13U                  /*Flux pulses, every pair after the first giving a speed and a flux*/
+#define MOTOR_ID_SPEED_TOLERANCE 0.2f        /*Pulse speed within this fraction of the open-loop speed*/
+#define MOTOR_ID_CURRENT_BANDWIDTH_RAD_S 8000.0f /*Current loop crossover the gains are derived for, PWM rate / 16*/
+
+/* Preprocessor definitions for stall detection, subject to change. */
+#define STALL_CURRENT_FRACTION 0.1f      /*Drive current, as a fraction of max_phase_current_A, that counts as pushing*/
+#define STALL_HOLD_CURRENT_FRACTION 0.25f /*Holding current after the cut-back, as a fraction of max_phase_current_A*/
+#define STALL_CUTBACK_TIME_US 200000U    /*Pushing without a Hall edge for this long cuts back to the holding current*/
+#define STALL_FAULT_TIME_US 2000000U     /*Still stalled this long latches ESC_FAULT_STALL*/
+
+/* Preprocessor definitions for battery limiting, subject to change. */
+#define BATTERY_LIMIT_MIN_DUTY 0.05f /*Floor on the duty used to map battery current to phase current*/
+#define BATTERY_SAG_FILTER_TAU_S 0.005f /*Bus voltage filter of the sag foldback, well above the medium task period*/
+
+/* Preprocessor definitions for the multi-rate scheduler, subject to change. Rates are in PWM periods (esc_step calls). */
+#define ESC_SCHED_MEDIUM_DIVIDER 10U  /*Throttle ramp and setpoints every 10th period, 2 kHz at 20 kHz PWM*/
+#define ESC_SCHED_MEDIUM_OFFSET 1U    /*Period within the divider the medium task runs in*/
+#define ESC_SCHED_SLOW_DIVIDER 200U   /*Supervision and telemetry every 200th period, 100 Hz at 20 kHz PWM*/
+#define ESC_SCHED_SLOW_OFFSET 5U      /*Chosen so the slow task never shares a period with the medium task*/
+#define ESC_SCHED_TELEMETRY_OFFSET 105U /*Telemetry runs at the slow rate, half a slow period after supervision*/
+#define ESC_SCHED_FAST_BUDGET_NS 20000U   /*20 microseconds of the 50 microsecond PWM period*/
+#define ESC_SCHED_MEDIUM_BUDGET_NS 5000U
+#define ESC_SCHED_SLOW_BUDGET_NS 10000U
+#define ESC_SCHED_TELEMETRY_BUDGET_NS 5000U
+#define ESC_SCHED_BUDGET_CHECKS 1     /*Time ticks and tasks with hal_time_get_cycles(), 0 compiles out the budget checks and deadline monitor*/
+
+/* Preprocessor definitions for the throttle ramp, subject to change. */
+#define THROTTLE_RAMP_PER_S 10.0f     /*Throttle slew rate, full throttle reached in 100 ms*/
 
 /**
  * @defgroup ESC ESC storage class
@@ -67,6 +179,8 @@ typedef enum {
 typedef enum {
     ESC_COMMUTATION_METHOD_TRAP, /**< Trapezoidal (6-step) */
     ESC_COMMUTATION_METHOD_FOC,  /**< Field-Oriented Control */
+    ESC_COMMUTATION_METHOD_SINE, /**< Sinusoidal, from the Hall-interpolated or observer angle; braking stays
+                                      6-step with Hall sensors */
     NUM_ESC_COMMUTATION_METHODS
 } EscCommutationMethod_t;
 
@@ -75,17 +189,266 @@ typedef enum {
  */
 typedef enum {
     ESC_FEEDBACK_MECHANISM_SENSORED,   /**< Sensored Feedback with Hall Effect Sensors */
-    ESC_FEEDBACK_MECHANISM_SENSORLESS, /**< Sensorless Feedback with Back Electromotive Force (BEMF) */
+    ESC_FEEDBACK_MECHANISM_SENSORLESS, /**< Sensorless Feedback from a Back-EMF Flux Observer, Sinusoidal Drive Only */
     NUM_ESC_FEEDBACK_MECHANISMS
 } EscFeedbackMechanism_t;
 
+/**
+ * @brief   ESC direction state machine states
+ */
+typedef enum {
+    ESC_DIRECTION_STATE_FORWARD, /**< Driving with the forward commutation sequence */
+    ESC_DIRECTION_STATE_REVERSE, /**< Driving with the reversed (step + 3) commutation sequence */
+    ESC_DIRECTION_STATE_BRAKING, /**< Braking towards the reversal speed before flipping the sequence */
+    NUM_ESC_DIRECTION_STATES
+} EscDirectionState_t;
+
+/**
+ * @brief   Sensorless startup state machine states
+ */
+typedef enum {
+    ESC_SENSORLESS_STATE_IDLE,      /**< Bridge off; the observer coasts on the PLL speed */
+    ESC_SENSORLESS_STATE_CATCH,     /**< Windings shorted in pulses to find the angle and speed of a spinning rotor */
+    ESC_SENSORLESS_STATE_ALIGN,     /**< Current ramping up at a fixed angle to park the rotor */
+    ESC_SENSORLESS_STATE_OPEN_LOOP, /**< Current vector accelerating to the handover speed, the rotor following */
+    ESC_SENSORLESS_STATE_RUN,       /**< Driving on the observer angle */
+    NUM_ESC_SENSORLESS_STATES
+} EscSensorlessState_t;
+
+/**
+ * @brief   Sensorless flux observer, PLL and startup state
+ * @details Angles are electrical, in TRIG_ANGLE_COUNTS counts per revolution, and like the Hall-interpolated angle
+ *          give the rotor position as the phase of the forward phase A back-EMF.
+ */
+typedef struct {
+    EscSensorlessState_t state;    /**< Startup state machine */
+    float flux_Wb[2];              /**< Observer state: stator flux linkage, alpha and beta */
+    float flux_magnitude_Wb;       /**< Magnitude of the estimated rotor flux */
+    float current_prev_A[2];       /**< Alpha-beta current at the previous tick */
+    uint16_t observer_angle;       /**< Rotor angle from the observer flux */
+    float pll_angle;               /**< PLL rotor angle, in counts [0, TRIG_ANGLE_COUNTS) */
+    float pll_speed_rad_s;         /**< PLL electrical speed, positive forward */
+    float open_loop_angle;         /**< Open-loop angle, in counts [0, TRIG_ANGLE_COUNTS) */
+    float open_loop_speed_rad_s;   /**< Open-loop electrical speed, signed with the driven direction */
+    float current_A;               /**< Startup current target, 0 while running on the observer */
+    uint32_t state_time_us;        /**< Time in the current state */
+    uint32_t converged_us;         /**< Time the observer has tracked the open loop */
+    uint8_t failed_starts;         /**< Startups in a row that timed out */
+    bool drive_requested;          /**< The output stage was asked to motor last period */
+    bool catch_short;              /**< Catch pulse output: short the windings this period */
+    uint8_t catch_pulses;          /**< Catch pulses completed */
+    uint16_t catch_angle;          /**< Current angle at the end of the first catch pulse */
+    uint32_t catch_time_us;        /**< Time since the end of the first catch pulse */
+} EscSensorless_t;
+
+/**
+ * @brief   Motor parameter identification sequence states
+ */
+typedef enum {
+    ESC_MOTOR_ID_STATE_IDLE,       /**< Not run since the last reset */
+    ESC_MOTOR_ID_STATE_RAMP,       /**< Test voltage ramping at a fixed angle through both test currents */
+    ESC_MOTOR_ID_STATE_RESISTANCE, /**< Holding the voltage of the lower test current */
+    ESC_MOTOR_ID_STATE_INDUCTANCE, /**< Stepped to the voltage of the upper test current, integrating the response */
+    ESC_MOTOR_ID_STATE_SPIN,       /**< Current vector accelerating open-loop, Hall edges counted against its angle */
+    ESC_MOTOR_ID_STATE_FLUX,       /**< Coasting, the windings shorted in pulses to measure the back-EMF */
+    ESC_MOTOR_ID_STATE_DONE,       /**< Parameters identified and written into the configuration */
+    ESC_MOTOR_ID_STATE_FAILED,     /**< Aborted, see the error */
+    NUM_ESC_MOTOR_ID_STATES
+} EscMotorIdState_t;
+
+/**
+ * @brief   Motor parameter identification failure reasons
+ */
+typedef enum {
+    ESC_MOTOR_ID_ERROR_NONE,        /**< No failure */
+    ESC_MOTOR_ID_ERROR_FAULT,       /**< A fault latched */
+    ESC_MOTOR_ID_ERROR_NO_CURRENT,  /**< Full duty does not reach the test current */
+    ESC_MOTOR_ID_ERROR_NO_REST,     /**< The rotor kept swinging on the test vector */
+    ESC_MOTOR_ID_ERROR_PARAMETERS,  /**< The resistance or inductance came out non-positive */
+    ESC_MOTOR_ID_ERROR_HALL,        /**< Not HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION forward edges per turn */
+    ESC_MOTOR_ID_ERROR_NO_ROTATION, /**< The rotor did not follow the open loop */
+    NUM_ESC_MOTOR_ID_ERRORS
+} EscMotorIdError_t;
+
+/**
+ * @brief   Motor parameter identification state and results
+ * @details Voltages are the phase peak voltages of the sinusoidal duty, currents the peak phase currents of the
+ *          vector, as in the flux observer.
+ */
+typedef struct {
+    EscMotorIdState_t state;       /**< Sequence state */
+    EscMotorIdError_t error;       /**< Failure reason once FAILED */
+    uint32_t state_time_us;        /**< Time in the current state */
+    float duty;                    /**< Test or spin voltage, as sinusoidal duty */
+    float low_duty;                /**< Duty at which the ramp passed the lower test current, 0 before */
+    float high_duty;               /**< Duty at which the ramp passed the upper test current */
+    float current_sum_A;           /**< Current accumulated over the present average or step window */
+    float vbus_sum_V;              /**< Bus voltage accumulated over the present average */
+    uint32_t samples;              /**< Samples in the present average */
+    uint32_t rest_us;              /**< Time the rotor has been at rest on the test vector */
+    float low_current_A;           /**< Mean current at the lower test voltage */
+    float low_vbus_V;              /**< Mean bus voltage at the lower test voltage */
+    float step_sum_A;              /**< Current samples summed over the step window */
+    uint32_t step_samples;         /**< Samples in the step window */
+    uint32_t step_time_us;         /**< Length of the step window */
+    Pid_t current_pid;             /**< Spin current regulator, on the derived gains */
+    float angle;                   /**< Open-loop angle, in counts [0, TRIG_ANGLE_COUNTS) */
+    float speed_rad_s;             /**< Open-loop electrical speed */
+    float turned_rad;              /**< Electrical angle the open loop has turned */
+    int32_t hall_edges;            /**< Hall edges over the open loop, forward positive */
+    uint8_t hall_prev;             /**< Hall sector at the last edge */
+    uint8_t pulses;                /**< Flux pulses completed */
+    uint32_t pulse_ticks;          /**< Periods the present pulse has been applied */
+    uint32_t pulse_length_ticks;   /**< Length of every pulse, set by the first; 0 before */
+    uint32_t pulse_us;             /**< Time the present pulse has been applied */
+    uint32_t gap_us;               /**< Time since the end of the last pulse */
+    uint16_t pulse_angle;          /**< Current angle at the end of the last pulse */
+    float flux_sum_Wb;             /**< Flux linkage accumulated over the pulse pairs */
+    float speed_sum_rad_s;         /**< Speed magnitude accumulated over the pulse pairs */
+
+    float resistance_Ohm;          /**< Identified per-phase resistance, including one inverter switch */
+    float inductance_H;            /**< Identified per-phase inductance */
+    float flux_linkage_Wb;         /**< Identified flux linkage, back-EMF fundamental peak per electrical rad/s */
+    float hall_edges_per_turn;     /**< Hall edges per open-loop electrical turn, 0 without Hall feedback */
+    float current_kp;              /**< Derived current loop proportional gain, duty per amp */
+    float current_ki;              /**< Derived current loop integral gain, duty per amp-second */
+} EscMotorId_t;
+
+/**
+ * @brief   Fault black-box tick snapshot, quantized to keep the record small
+ */
+typedef struct {
+    uint32_t time_us;              /**< Time since the black box was reset, wrapping */
+    int16_t phase_current_cA[NUM_MOTOR_PHASES]; /**< Phase currents, in 10 mA */
+    uint16_t vbus_cV;              /**< DC bus voltage, in 10 mV */
+    int16_t temperature_dC;        /**< Temperature, in 0.1 C */
+    uint16_t duty;                 /**< Applied duty, 0 to 65535 for 0 to MAX_PWM_DUTY */
+    uint16_t elec_angle;           /**< Electrical angle, in counts */
+    uint8_t hall_abc;              /**< Hall state */
+    uint8_t fault_flags;           /**< EscFault_t bits latched */
+    uint8_t hal_fault;             /**< HalFault_t, with BLACKBOX_HAL_FAULT_ACTIVE while nFAULT is asserted */
+    uint8_t direction_state;       /**< EscDirectionState_t, with bit 7 set while the bridge is enabled */
+} EscBlackBoxSample_t;
+
+/**
+ * @brief   Fault black box: a ring of tick snapshots that freezes BLACKBOX_POST_TRIGGER_SAMPLES after a new fault
+ */
+typedef struct {
+    EscBlackBoxSample_t samples[BLACKBOX_SAMPLES]; /**< Snapshot ring */
+    uint32_t head;                 /**< Next slot to write */
+    uint32_t count;                /**< Snapshots held, up to BLACKBOX_SAMPLES */
+    uint32_t time_us;              /**< Time since reset */
+    uint8_t prev_fault_flags;      /**< Fault flags at the last snapshot */
+    uint8_t prev_hal_fault;        /**< HAL fault at the last snapshot */
+    bool triggered;                /**< A new fault has been seen since the last rearm */
+    bool frozen;                   /**< The post-trigger snapshots are in and recording has stopped */
+    uint8_t trigger_fault_flags;   /**< Fault flags that were new at the trigger */
+    uint8_t trigger_hal_fault;     /**< HAL fault at the trigger */
+    uint32_t trigger_age;          /**< Snapshots taken since the trigger snapshot */
+} EscBlackBox_t;
+
+/**
+ * @brief   Software oscilloscope signals, the registry of ESC state a capture can select
+ */
+typedef enum {
+    ESC_SCOPE_SIGNAL_CURRENT_A,        /**< Phase A current, A */
+    ESC_SCOPE_SIGNAL_CURRENT_B,        /**< Phase B current, A */
+    ESC_SCOPE_SIGNAL_CURRENT_C,        /**< Phase C current, A */
+    ESC_SCOPE_SIGNAL_VBUS,             /**< DC bus voltage, V */
+    ESC_SCOPE_SIGNAL_HALL,             /**< Hall state */
+    ESC_SCOPE_SIGNAL_DUTY,             /**< Control loop duty, 0 to MAX_PWM_DUTY */
+    ESC_SCOPE_SIGNAL_PHASE_DUTY_A,     /**< Phase A duty applied, [0, 1] */
+    ESC_SCOPE_SIGNAL_PHASE_DUTY_B,     /**< Phase B duty applied, [0, 1] */
+    ESC_SCOPE_SIGNAL_PHASE_DUTY_C,     /**< Phase C duty applied, [0, 1] */
+    ESC_SCOPE_SIGNAL_ELEC_ANGLE,       /**< Electrical angle, counts */
+    ESC_SCOPE_SIGNAL_SINE_LEAD,        /**< Sinusoidal lead angle, counts */
+    ESC_SCOPE_SIGNAL_DRIVE_CURRENT,    /**< Drive (in-phase) current, A */
+    ESC_SCOPE_SIGNAL_QUADRATURE_CURRENT, /**< Current ahead of the back-EMF, A */
+    ESC_SCOPE_SIGNAL_ADVANCE_CURRENT,  /**< MTPA and field weakening target for it, A */
+    ESC_SCOPE_SIGNAL_SPEED,            /**< Mechanical speed, rpm */
+    ESC_SCOPE_SIGNAL_THROTTLE,         /**< Ramped throttle */
+    ESC_SCOPE_SIGNAL_DC_CURRENT,       /**< Estimated battery current, A */
+    ESC_SCOPE_SIGNAL_PLL_ANGLE,        /**< Sensorless PLL angle, counts */
+    ESC_SCOPE_SIGNAL_PLL_SPEED,        /**< Sensorless PLL speed, electrical rad/s */
+    ESC_SCOPE_SIGNAL_FAULT_FLAGS,      /**< EscFault_t bits latched */
+    NUM_ESC_SCOPE_SIGNALS
+} EscScopeSignal_t;
+
+/**
+ * @brief   Software oscilloscope trigger conditions
+ */
+typedef enum {
+    ESC_SCOPE_TRIGGER_NONE,            /**< Trigger as soon as the pre-trigger frames are in */
+    ESC_SCOPE_TRIGGER_RISING,          /**< Trigger signal crosses the level upwards */
+    ESC_SCOPE_TRIGGER_FALLING,         /**< Trigger signal crosses the level downwards */
+    ESC_SCOPE_TRIGGER_EITHER,          /**< Trigger signal crosses the level either way */
+    NUM_ESC_SCOPE_TRIGGERS
+} EscScopeTrigger_t;
+
+/**
+ * @brief   Software oscilloscope capture states
+ */
+typedef enum {
+    ESC_SCOPE_STATE_IDLE,              /**< Not armed */
+    ESC_SCOPE_STATE_ARMED,             /**< Filling the pre-trigger frames and waiting for the trigger */
+    ESC_SCOPE_STATE_TRIGGERED,         /**< Filling the post-trigger frames */
+    ESC_SCOPE_STATE_DONE,              /**< Buffer complete, waiting to be read out */
+    NUM_ESC_SCOPE_STATES
+} EscScopeState_t;
+
+/**
+ * @brief   Software oscilloscope capture settings
+ */
+typedef struct {
+    uint8_t num_channels;              /**< Signals per frame, 1 to SCOPE_MAX_CHANNELS */
+    EscScopeSignal_t channels[SCOPE_MAX_CHANNELS]; /**< Signal of each channel */
+    EscScopeTrigger_t trigger;         /**< Trigger condition */
+    EscScopeSignal_t trigger_signal;   /**< Signal the trigger watches, captured or not */
+    float trigger_level;               /**< Level the trigger signal crosses */
+    uint16_t decimation;               /**< Ticks per frame, at least 1 */
+    uint16_t pre_trigger_frames;       /**< Frames kept from before the trigger, below the buffer depth */
+} EscScopeConfig_t;
+
+/**
+ * @brief   Software oscilloscope state and capture buffer
+ */
+typedef struct {
+    EscScopeConfig_t config;           /**< Settings of the present capture */
+    EscScopeState_t state;             /**< Capture state */
+    float buffer[SCOPE_BUFFER_SAMPLES]; /**< Frames of config.num_channels samples, as a ring while armed */
+    uint32_t depth;                    /**< Frames the buffer holds at config.num_channels */
+    uint32_t head;                     /**< Next frame to write */
+    uint32_t count;                    /**< Frames held */
+    uint32_t post_frames;              /**< Frames still to take after the trigger */
+    uint32_t trigger_age;              /**< Frames taken since the trigger frame */
+    uint16_t ticks;                    /**< Ticks since the last frame */
+    float trigger_prev;                /**< Trigger signal at the last frame */
+    uint32_t last_cycles;              /**< Cycles of the last armed tick */
+    uint32_t max_cycles;               /**< Most cycles of any armed tick since arming */
+} EscScope_t;
+
+/* Per-phase switch enable mask helpers */
+#define ESC_PHASE_MASK(phase) ((uint8_t)(1U << (phase)))
+#define ESC_PHASE_MASK_ALL ((uint8_t)0x07U)
+
 /**
  * @brief   ESC three-phase inverter command output class
+ * @details The 6-step fields (duty, commutation_step, brake) are what the control loop decides; the per-phase
+ *          fields are what the PWM HAL applies. A phase with both switches enabled is switched complementarily,
+ *          with only the high side it freewheels through the low-side diode, with only the low side it is held
+ *          low, and with neither it floats.
  */
 typedef struct {
     bool enable;              /**< Enable/Disable Three-Phase Inverter */
     float duty;               /**< PWM Duty Cycle */
     uint8_t commutation_step; /**< 6-step Commutation Index (0–5) */
+    bool brake;               /**< Dynamic Braking: low-side switches on, high-side off, duty ignored */
+
+    float phase_duty[NUM_MOTOR_PHASES]; /**< Per-Phase High-Side Duty Cycle [0.0, 1.0] */
+    uint8_t high_enable_mask; /**< Per-Phase High-Side Switch Enable, bit ESC_PHASE_MASK(phase) */
+    uint8_t low_enable_mask;  /**< Per-Phase Low-Side Switch Enable, bit ESC_PHASE_MASK(phase) */
+    uint16_t dead_time_ns;    /**< Dead Time Inserted Before Each Complementary Switch Turns On */
+    bool center_aligned;      /**< Center-Aligned (up/down counting) Instead of Edge-Aligned PWM */
 } EscInverterCmd_t;
 
 typedef struct {
@@ -94,6 +457,7 @@ typedef struct {
     float vbus_uvlo_V;         /**< Undervoltage lockout threshold */
     float vbus_ovlo_V;         /**< Overvoltage lockout threshold */
     float max_duty;            /**< Maximum PWM Duty Cycle */
+    float max_regen_current_A; /**< Maximum phase current while braking regeneratively */
 } EscLimits_t;
 
 typedef enum {
@@ -103,8 +467,138 @@ typedef enum {
     ESC_FAULT_OVERTEMP     = (1U << 2),
     ESC_FAULT_OVERCURRENT  = (1U << 3),
     ESC_FAULT_HALL_INVALID = (1U << 4),
+    ESC_FAULT_STALL        = (1U << 5),
 } EscFault_t;
 
+/**
+ * @brief   ESC PWM output configuration class
+ */
+typedef struct {
+    uint16_t dead_time_ns;           /**< Gate driver dead time, at most MAX_DEAD_TIME_NS */
+    bool center_aligned;             /**< Center-aligned PWM */
+    bool synchronous_rectification;  /**< Switch the PWM-ed phase complementarily in 6-step drive */
+    bool dead_time_compensation;     /**< Correct complementary phase duties for dead time and switch drops */
+    float diode_forward_V;           /**< Switch body-diode forward drop, conducting through the dead time */
+} EscPwmConfig_t;
+
+/**
+ * @brief   ESC scheduler tasks, in the order they run within a PWM period
+ */
+typedef enum {
+    ESC_TASK_FAST,   /**< Feedback, commutation, current and voltage protection, current loop and outputs, every period */
+    ESC_TASK_MEDIUM, /**< Battery limits, stall detection, throttle ramp and setpoints, every ESC_SCHED_MEDIUM_DIVIDER periods */
+    ESC_TASK_SLOW,   /**< Thermal model and derating, thermal and undervoltage supervision, every ESC_SCHED_SLOW_DIVIDER periods */
+    ESC_TASK_TELEMETRY, /**< Telemetry snapshot, every ESC_SCHED_SLOW_DIVIDER periods; shed in degraded mode */
+    NUM_ESC_TASKS
+} EscTask_t;
+
+/**
+ * @brief   ESC scheduler per-task state and execution statistics
+ */
+typedef struct {
+    uint32_t countdown;        /**< Periods until the task next runs */
+    uint32_t elapsed_us;       /**< Time accumulated since the task last ran, passed to it as dt_us */
+    uint32_t runs;             /**< Number of runs */
+    uint32_t last_cycles;      /**< Execution time of the last run, in hal_time_get_cycles() cycles */
+    uint32_t max_cycles;       /**< Longest run, in hal_time_get_cycles() cycles */
+    uint32_t budget_overruns;  /**< Runs that took longer than the task budget */
+} EscTaskState_t;
+
+/**
+ * @brief   ESC control-loop deadline monitor statistics, times in hal_time_get_cycles() cycles
+ */
+typedef struct {
+    uint32_t ticks;                 /**< Monitored esc_step() calls */
+    uint32_t overruns;              /**< Calls that ran past their deadline */
+    uint32_t last_cycles;           /**< Entry-to-exit time of the last call */
+    uint32_t max_cycles;            /**< Longest entry-to-exit time */
+    uint32_t worst_overrun_cycles;  /**< Entry-to-exit time of the longest overrunning call */
+    EscTask_t worst_task;           /**< Longest-running task within that call */
+    uint32_t worst_task_cycles;     /**< Run time of that task */
+    uint32_t window_ticks;          /**< Calls so far in the current degrade window */
+    uint32_t window_overruns;       /**< Overruns so far in the current degrade window */
+    bool degraded;                  /**< Degraded mode latched: sheddable tasks dropped, 6-step commutation forced */
+} EscDeadlineStats_t;
+
+/**
+ * @brief   ESC deadline monitor configuration class
+ */
+typedef struct {
+    uint32_t deadline_ns;           /**< Allowed entry-to-exit time of esc_step(), 0 for the whole dt_us */
+    uint16_t degrade_overruns;      /**< Overruns within one window that latch degraded mode, 0 to never degrade */
+    uint16_t degrade_window_ticks;  /**< Degrade window length in esc_step() calls */
+} EscDeadlineConfig_t;
+
+/**
+ * @brief   ESC telemetry snapshot, refreshed by the telemetry task
+ */
+typedef struct {
+    float vbus_V;              /**< Bus voltage */
+    float temperature_C;       /**< Power stage temperature */
+    float velocity_mech_rpm;   /**< Estimated mechanical speed */
+    float drive_current_A;     /**< Drive current: high phase of the step, or in-phase current in sine drive */
+    float throttle;            /**< Ramped throttle */
+    float winding_temp_C;      /**< Estimated winding temperature */
+    float fet_temp_C;          /**< Estimated inverter switch temperature */
+    float thermal_derate;      /**< Current limit derating factor [0.0, 1.0] */
+    float dc_current_A;        /**< Estimated battery current, positive discharging */
+    float input_power_W;       /**< Estimated input power, positive discharging */
+    uint32_t fault_flags;      /**< Active fault flags */
+    uint32_t sequence;         /**< Snapshots taken since init, so a reader can tell a new one */
+} EscTelemetry_t;
+
+/**
+ * @brief   ESC thermal model configuration class
+ * @details The winding estimate is the measured motor temperature plus the modelled rise of the copper above the
+ *          sensor, which the sensor only shows after its lag. The inverter estimate is the modelled rise of the
+ *          switches above ambient. Either model is off while its resistance is zero.
+ */
+typedef struct {
+    float ambient_temp_C;            /**< Ambient temperature, the reference for the inverter estimate */
+    float winding_resistance_Ohm;    /**< Per-phase winding resistance at THERMAL_COPPER_REFERENCE_C */
+    float winding_r_th_K_per_W;      /**< Thermal resistance from the windings to the temperature sensor */
+    float winding_c_th_J_per_K;      /**< Heat capacity of the windings */
+    float max_winding_temp_C;        /**< Estimated winding temperature at which the current limit reaches zero */
+    float fet_rds_on_Ohm;            /**< Inverter switch on-resistance */
+    float fet_r_th_K_per_W;          /**< Thermal resistance from the inverter switches to ambient */
+    float fet_c_th_J_per_K;          /**< Heat capacity of the inverter switches and heatsink */
+    float max_fet_temp_C;            /**< Estimated switch temperature at which the current limit reaches zero */
+    float derate_band_C;             /**< Band below each maximum over which the current limit derates linearly */
+} EscThermalConfig_t;
+
+/**
+ * @brief   ESC battery limit configuration class
+ * @details Battery current is estimated as the sum over phases of high-side duty times phase current, so a battery
+ *          current limit allows a phase current of limit / duty: full phase current at low speed, less at high duty.
+ */
+typedef struct {
+    float max_discharge_current_A; /**< Battery current limit while motoring, 0 for none */
+    float max_charge_current_A;    /**< Battery current limit while braking regeneratively, 0 for none */
+    float max_power_W;             /**< Input power limit while motoring, 0 for none */
+    float sag_foldback_band_V;     /**< Motoring folds back linearly to zero over this band above vbus_uvlo_V, 0 for none */
+    float dc_link_capacitance_F;   /**< Inverter DC-link capacitance, bounding each dynamic brake release, 0 for no bound */
+} EscBatteryConfig_t;
+
+/**
+ * @brief   ESC current loop configuration class
+ * @details Gains of the drive current limiter and the regenerative brake and floor regulators, which act on the
+ *          sinusoidal or 6-step duty. Motor identification derives them from the winding resistance and inductance.
+ */
+typedef struct {
+    float kp;                      /**< Duty per amp, 0 for CURRENT_LIMIT_KP */
+    float ki;                      /**< Duty per amp-second, 0 for CURRENT_LIMIT_KI */
+} EscCurrentLoopConfig_t;
+
+/**
+ * @brief   ESC field weakening configuration class
+ * @details Sinusoidal drive only. Once the duty runs out, current is driven ahead of the back-EMF, along the negative
+ *          d-axis where it opposes the rotor flux, so the speed can rise further at the same voltage. It counts
+ *          against the phase current limit like the torque current.
+ */
+typedef struct {
+    float max_current_A;           /**< Largest field weakening current, 0 for no field weakening */
+} EscFieldWeakeningConfig_t;
+
 /**
  * @brief   ESC configuration class
  */
@@ -114,6 +608,12 @@ typedef struct {
     EscFeedbackMechanism_t feedback_mechanism;
 
     EscLimits_t limits;
+    EscPwmConfig_t pwm;
+    EscDeadlineConfig_t deadline;
+    EscThermalConfig_t thermal;
+    EscBatteryConfig_t battery;
+    EscCurrentLoopConfig_t current_loop;
+    EscFieldWeakeningConfig_t field_weakening;
 
     MotorConfig_t motor_config;
 } EscConfig_t;
@@ -123,17 +623,82 @@ typedef struct {
  */
 typedef struct {
     EscConfig_t config;            /**< ESC configuration */
+    HalMotor_t hal_motor;          /**< Inverter of the board this instance drives */
 
     MotorState_t motor_state;      /**< Motor measured state */
     EscInverterCmd_t inverter_cmd; /**< Inverter command output */
 
     /* Internal State During Runtime */
     float throttle_cmd;            /**< Last Throttle Command [-1.0, 1.0] */
+    float brake_cmd;               /**< Last Brake Command [0.0, 1.0] */
+    float throttle_ramped;         /**< Throttle Command After the Slew Limit, What the Control Loop Follows */
     float velocity_setpoint_rpm;   /**< Desired Velocity (RPM) Value */
     float torque_setpoint_A;       /**< Desired Torque (Phase Current) Value */
-    float velocity_mech_rpm;       /**< Estimated Mechanical Speed */
+    float velocity_mech_rpm;       /**< Estimated Mechanical Speed (signed, positive forward) */
     uint32_t fault_flags;          /**< Active/Latching Faults Bitmask */
 
+    /* Hall Sequence Tracking */
+    int8_t rotor_direction;        /**< Rotor Direction from Hall Sequence (+1, -1, 0 if unknown) */
+    uint8_t hall_prev;             /**< Hall State at Last Transition, or HALL_INVALID */
+    uint32_t hall_prev_timestamp_ticks; /**< Timestamp of Last Hall Transition, in Timer Ticks */
+    uint32_t hall_elapsed_us;      /**< Time Since Last Hall Transition */
+    uint16_t elec_angle;           /**< Hall-Interpolated or Observer Electrical Angle for Sinusoidal Commutation */
+    float sine_lead;               /**< Sinusoidal Lead Angle in the Direction of Rotation, in Electrical Angle Counts */
+    float field_weakening_current_A; /**< Field Weakening Current, 90 Degrees Ahead of the Back-EMF */
+    float mtpa_current_A[MTPA_TABLE_POINTS]; /**< MTPA Current 90 Degrees Ahead of the Back-EMF, by Torque Current */
+    float advance_current_A;       /**< Current Ahead of the Back-EMF the Lead Steers To, MTPA plus FW */
+    float dead_time_duty[NUM_MOTOR_PHASES]; /**< Dead-Time and Switch-Drop Correction Added to Each Phase Duty */
+
+    /* Sensorless Feedback */
+    EscSensorless_t sensorless;    /**< Flux Observer, PLL and Startup */
+
+    /* Motor Identification */
+    EscMotorId_t motor_id;         /**< Parameter Identification Sequence and Results */
+
+    /* Fault Black Box */
+    EscBlackBox_t blackbox;        /**< Pre- and Post-Trigger Snapshots of the Last Fault */
+
+    /* Software Oscilloscope */
+    EscScope_t scope;              /**< Triggered Capture of Selected Signals */
+
+    /* Direction and Current Control */
+    EscDirectionState_t direction_state; /**< Direction State Machine */
+    float drive_current_A;         /**< High Phase Current of the Step, or In-Phase Current in Sine Drive (+ motoring) */
+    float quadrature_current_A;    /**< Current 90 Degrees Ahead of the Back-EMF in Sine Drive, 0 in 6-Step */
+    float phase_current_max_A;     /**< Largest Phase Current Magnitude */
+    float bemf_duty_per_rpm;       /**< Learned Duty per RPM, used to preload the brake regulator */
+    Pid_t current_pid;             /**< Drive Current Limiter / Brake Current Regulator */
+    Pid_t regen_floor_pid;         /**< Duty Floor Limiting Regeneration While Throttling Down */
+    bool dynamic_braking;          /**< True while braking falls back to shorting the windings */
+
+    /* Thermal Model */
+    float current_sq_sum_A2;       /**< Sum over phases of the squared current, accumulated every fast tick */
+    uint32_t current_sq_samples;   /**< Fast ticks accumulated into current_sq_sum_A2 */
+    ThermalNode_t winding_thermal; /**< Winding rise above the motor temperature sensor */
+    ThermalNode_t fet_thermal;     /**< Inverter switch rise above ambient */
+    float winding_temp_C;          /**< Estimated Winding Temperature */
+    float fet_temp_C;              /**< Estimated Inverter Switch Temperature */
+    float thermal_derate;          /**< Current Limit Derating Factor [0.0, 1.0] */
+
+    /* Battery Limiting */
+    float dc_current_sum_A;        /**< Estimated battery current, accumulated every fast tick */
+    float dc_duty_sum;             /**< Applied duty, accumulated every fast tick */
+    uint32_t dc_samples;           /**< Fast ticks accumulated into the sums */
+    float dc_current_A;            /**< Estimated Battery Current (positive discharging) */
+    float input_power_W;           /**< Estimated Input Power (positive discharging) */
+    float battery_drive_limit_A;   /**< Phase Current Limit from the Battery Current, Power and Sag Limits */
+    float battery_charge_limit_A;  /**< Regenerative Phase Current Limit from the Battery Charge Current Limit */
+    float vbus_filtered_V;         /**< Bus Voltage Filtered for the Sag Foldback */
+
+    /* Stall Detection */
+    uint32_t stall_time_us;        /**< Time Spent Pushing Current Without a Hall Edge */
+    bool stall_cutback;            /**< True while the drive current is cut back to the holding current */
+
+    /* Multi-Rate Scheduler */
+    EscTaskState_t tasks[NUM_ESC_TASKS]; /**< Per-Task Schedule and Execution Statistics */
+    EscTelemetry_t telemetry;      /**< Telemetry Snapshot from the Telemetry Task */
+    EscDeadlineStats_t deadline;   /**< Control-Loop Deadline Monitor */
+
     bool is_initialized;           /**< ESC Initialized Flag */
 } Esc_t;
 
@@ -144,20 +709,35 @@ typedef struct {
 // TODO STARTS: Con/Destructors sorta
 /**
  * @brief   Initialize ESC with a configuration
+ * @details All state lives in the instance, so any number of instances can run side by side, each on its own
+ *          inverter.
  * @param   esc ESC instance to initialize
+ * @param   hal_motor Inverter the instance drives
  * @param   cfg Configuration to copy into ESC
  * @return  true if initialization succeeded, false otherwise
  */
-bool esc_init(Esc_t *esc, const EscConfig_t *cfg);
+bool esc_init(Esc_t *esc, HalMotor_t hal_motor, const EscConfig_t *cfg);
 
 /**
- * @brief   Reset ESC runtime state (clears faults and disables outputs)
+ * @brief   Replace the configuration of an initialized ESC, restarting its control state
+ * @details As esc_init() on the same inverter, except that the fault black box and the software oscilloscope keep
+ *          their records and settings. A rejected configuration leaves the ESC as it was.
+ * @param   esc ESC instance
+ * @param   cfg Configuration to copy into ESC
+ * @return  true if the configuration was taken, false if it is invalid or the ESC is not initialized
+ */
+bool esc_reconfigure(Esc_t *esc, const EscConfig_t *cfg);
+
+/**
+ * @brief   Reset ESC runtime state (clears faults, leaves degraded mode and disables outputs)
+ * @details The fault black box keeps its record, to be read after the fault is cleared.
  * @param   esc ESC instance
  */
 void esc_reset(Esc_t *esc);
 
 /**
  * @brief   Validate a configuration structure
+ * @details Every floating-point field must be finite, and the phase current limit above zero.
  * @param   cfg Config to validate
  * @return  true if valid
  */
@@ -166,7 +746,9 @@ bool esc_config_is_valid(const EscConfig_t *cfg);
 
 // TODO STARTS: Control Loop (calls static funcs in esc.c)
 /**
- * @brief   Main ESC update tick, which is called at a TBD frequency
+ * @brief   Main ESC update tick, called once per PWM period
+ * @details Runs the fast task every call and the medium and slow tasks on their dividers of the call count, after
+ *          the fast task so the inverter command is ready as early as possible in the period.
  * @param   esc ESC instance
  * @param   dt_us Time since last tick in microseconds
  */
@@ -181,12 +763,35 @@ void esc_step(Esc_t *esc, uint32_t dt_us);
  */
 void esc_set_throttle(Esc_t *esc, float throttle_cmd);
 
+/**
+ * @brief   Set brake command, which takes priority over throttle while the rotor is moving
+ * @details Braking is regenerative up to max_regen_current_A, folded back as vbus approaches vbus_ovlo_V, and
+ *          falls back to dynamic braking (windings shorted) for the remainder.
+ * @param   esc ESC instance
+ * @param   brake_cmd Brake command in range [0.0, 1.0], as a fraction of the phase current limit
+ */
+void esc_set_brake(Esc_t *esc, float brake_cmd);
+
 /**
  * @brief   Update motor measured state (copied into esc->motor_state)
  * @param   esc ESC instance
  * @param   state Latest motor state sample
  */
 void esc_set_motor_state(Esc_t *esc, const MotorState_t *state);
+
+/**
+ * @brief   Start identifying the motor parameters, which takes over the bridge until it finishes
+ * @details Measures the resistance from the voltage between two DC test currents, the inductance from the current
+ *          response to the step between them, and the flux linkage from the current that short pulses of the
+ *          windings build up while the rotor coasts from an open-loop spin, where Hall feedback also checks the
+ *          edge count per electrical turn. On success the resistance, inductance and flux linkage are written
+ *          into config.motor_config and the current loop gains derived from them into config.current_loop; the
+ *          pole pair count is not observable from the windings and stays as configured. The rotor must be free
+ *          to turn. Throttle and brake commands are ignored until the sequence finishes.
+ * @param   esc ESC instance
+ * @return  true if started, false if faulted or the bridge is driving or braking
+ */
+bool esc_start_motor_id(Esc_t *esc);
 // TODO ENDS.
 
 // TODO STARTS: Getters
@@ -204,12 +809,33 @@ EscInverterCmd_t esc_get_inverter_cmd(const Esc_t *esc);
  */
 bool esc_is_faulted(const Esc_t *esc);
 
+/**
+ * @brief   Get the latest telemetry snapshot
+ * @param   esc ESC instance
+ * @return  Snapshot from the last telemetry task run, or {0} if invalid esc
+ */
+EscTelemetry_t esc_get_telemetry(const Esc_t *esc);
+
 /**
  * @brief   Get current fault flags
  * @param   esc ESC instance
  * @return  Fault bitmask, or ESC_FAULT_NONE if invalid or not initialized esc
  */
 EscFault_t esc_get_fault_flags(const Esc_t *esc);
+
+/**
+ * @brief   Get the control-loop deadline monitor statistics
+ * @param   esc ESC instance
+ * @return  Deadline statistics, or {0} if invalid or not initialized esc
+ */
+EscDeadlineStats_t esc_get_deadline_stats(const Esc_t *esc);
+
+/**
+ * @brief   Get the motor identification state and results
+ * @param   esc ESC instance
+ * @return  Identification state, or {0} if invalid or not initialized esc
+ */
+EscMotorId_t esc_get_motor_id(const Esc_t *esc);
 // TODO ENDS.
 
 /** @} */
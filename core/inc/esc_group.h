@@ -0,0 +1,73 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   esc_group.h
+ *
+ * @brief  Header file for the multi-motor ESC scheduler
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "hal_motor.h"
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup EscGroup Multi-motor ESC scheduler
+ * @brief    Steps one ESC instance per inverter from a single timer interrupt
+ * @details  The interrupt runs NUM_HAL_MOTORS times per PWM period, each time just after the update event of the
+ *           next inverter's carrier (see HAL_PWM_PHASE_US()). Call n of a period reads the HAL of HAL_MOTOR_n,
+ *           steps the instance on it by a full HAL_PWM_PERIOD_US and applies its command, which then latches at
+ *           that inverter's next update event. The instances share no state, so the control work of each one
+ *           lands in its own slot of the period, as their DC-link current pulses do.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Multi-motor scheduler state
+ */
+typedef struct {
+    Esc_t *escs[NUM_HAL_MOTORS];         /**< Instance on each inverter, NULL if the slot is idle */
+    uint8_t next;                        /**< Inverter of the next slot */
+    uint32_t last_cycles[NUM_HAL_MOTORS]; /**< Duration of each inverter's last tick in hal_time_get_cycles() cycles */
+    uint32_t max_cycles[NUM_HAL_MOTORS];  /**< Longest tick of each inverter since esc_group_init() */
+} EscGroup_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initializes a scheduler with every slot idle
+ * @param   group Scheduler instance
+ */
+void esc_group_init(EscGroup_t *group);
+
+/**
+ * @brief   Puts an initialized ESC instance in the slot of its inverter
+ * @param   group Scheduler instance
+ * @param   esc ESC instance, stepped from then on
+ * @return  false if another instance already drives the same inverter
+ */
+bool esc_group_add(EscGroup_t *group, Esc_t *esc);
+
+/**
+ * @brief   Timer interrupt body: runs the next slot and moves on
+ * @details An idle slot returns at once.
+ * @param   group Scheduler instance
+ * @return  Inverter of the slot just run
+ */
+HalMotor_t esc_group_tick(EscGroup_t *group);
+
+/** @} */
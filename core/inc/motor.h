@@ -13,6 +13,7 @@
 #include <stdint.h>
 
 /* Inter-component Headers */
+#include "hal_time.h"
 
 /* Intra-component Headers */
 
@@ -41,20 +42,27 @@ typedef struct {
     float temperature_C;                        /**< Motor temperature */
 
     uint8_t hall_abc;                           /**< 3-bit Hall State */
-    uint32_t hall_timestamp_us;                 /**< Timestamp of Last Hall Transition */
+    uint32_t hall_timestamp_ticks;              /**< Timer Ticks (low 32 bits) of Last Hall Transition */
 } MotorState_t;
 
 /**
  * @brief   Motor configuration class
  */
 typedef struct {
-    uint8_t num_pole_pairs;  /**< Number of Pole Pairs */
+    uint8_t num_pole_pairs;      /**< Number of Pole Pairs */
+    float phase_resistance_Ohm;  /**< Per-Phase Resistance Including One Inverter Switch, for the Flux Observer */
+    float phase_inductance_H;    /**< Per-Phase Inductance, Along the Rotor Flux (d-Axis) on a Salient Motor */
+    float q_axis_inductance_H;   /**< Per-Phase Inductance Across the Rotor Flux (q-Axis), 0 When Not Salient */
+    float flux_linkage_Wb;       /**< Rotor Flux Linkage: Back-EMF Fundamental Peak per Electrical rad/s */
 } MotorConfig_t;
 
 /*******************************************************************************************************************************
  * Private defines and enums
  *******************************************************************************************************************************/
 
+/* Timestamp timer resolution, the HAL timebase */
+#define MOTOR_TIMESTAMP_TICKS_PER_US HAL_TIME_TICKS_PER_US
+
 /*******************************************************************************************************************************
  * Variables
  *******************************************************************************************************************************/
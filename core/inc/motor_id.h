@@ -0,0 +1,67 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   motor_id.h
+ *
+ * @brief  Header file for the motor parameter identification module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup MotorId Motor parameter identification module
+ * @brief    Resistance, inductance and flux linkage identification through the inverter and phase current sensing
+ * @details  The test vector sits at a fixed angle while the resistance and inductance are measured, so the rotor
+ *           parks on it and its back-EMF drops out. Dead time and switch drops shift the applied voltage by an
+ *           amount that only depends on the current signs, so the resistance is taken from the difference between
+ *           two test currents of the same signs, and the inductance from the time constant of the step between
+ *           them, which the same offset cannot change. The flux linkage needs a turning rotor: the vector spins it
+ *           up open-loop, and while it coasts the windings are shorted from zero current in pulses of equal length,
+ *           whose end currents give the back-EMF through the winding impedance and, pair by pair, the speed.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Clear the identification state and results
+ * @param   esc ESC instance
+ */
+void motor_id_reset(Esc_t *esc);
+
+/**
+ * @brief   Start the identification sequence
+ * @param   esc ESC instance
+ * @return  true if started, false if faulted or the bridge is enabled
+ */
+bool motor_id_start(Esc_t *esc);
+
+/**
+ * @brief   Step the identification sequence and set the inverter command for the next period
+ * @details Uses the inverter command applied over the last period and the currents sampled at its end. The
+ *          command is a sinusoidal duty at esc->elec_angle, or a short of the windings through the low side.
+ * @param   esc ESC instance
+ * @param   dt_us Time since last tick in microseconds
+ */
+void motor_id_update(Esc_t *esc, uint32_t dt_us);
+
+/**
+ * @brief   Check whether the identification sequence has the bridge
+ * @param   esc ESC instance
+ * @return  true from the start until done or failed
+ */
+bool motor_id_is_running(const Esc_t *esc);
+
+/** @} */
@@ -0,0 +1,146 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   param_store.h
+ *
+ * @brief  Header file for the parameter store
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "flash.h"
+#include "hal_motor.h"
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup ParamStore Parameter store
+ * @brief    Keyed, versioned, CRC-checked values kept in the HAL flash region across power cycles
+ * @details  The store is a log. Each write appends a record to the active sector: the value, then a header with the
+ *           key, the caller's layout version, the length and a CRC over all of them. The value is programmed
+ *           first, so a record only becomes valid when its header is complete. The newest valid record of a key
+ *           wins. A write that finds the active sector full compacts instead. It copies the newest record of every
+ *           other key and the new record into the next sector in turn, and then programs that sector's header
+ *           with the next generation number. The sector with the highest valid generation is the active one.
+ *           This spreads the erases over all sectors. A power loss at any point leaves either the old or the new
+ *           value, never a mix.
+ *
+ *           Mounting scans the active sector once and indexes the newest record of each key. Reads then copy
+ *           straight out of the memory-mapped flash. A torn record stops the scan; the sector keeps its good
+ *           records but takes no more, and the next write compacts.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define PARAM_STORE_MAGIC 0x50435345UL       /* "ESCP" */
+#define PARAM_STORE_FORMAT_VERSION 1U        /* Layout of sectors and records */
+#define PARAM_STORE_MAX_KEYS 8U              /* Keys 0 to PARAM_STORE_MAX_KEYS - 1 */
+#define PARAM_STORE_MAX_VALUE_SIZE 1024U     /* Largest value, bytes */
+
+/**
+ * @brief   Keys of the values the firmware keeps
+ */
+typedef enum {
+    PARAM_STORE_KEY_ESC_CONFIG = 0,          /**< EscConfig_t of HAL_MOTOR_0, version ESC_CONFIG_VERSION */
+    PARAM_STORE_KEY_ESC_CONFIG_LAST = PARAM_STORE_KEY_ESC_CONFIG + NUM_HAL_MOTORS - 1, /**< Of the last inverter */
+} ParamStoreKey_t;
+
+/**
+ * @brief   Header at the start of every sector in use, programmed last when the sector is filled by compaction
+ */
+typedef struct {
+    uint32_t magic;                          /**< PARAM_STORE_MAGIC */
+    uint32_t generation;                     /**< One more than the sector compacted from */
+    uint16_t format_version;                 /**< PARAM_STORE_FORMAT_VERSION */
+    uint16_t sector_size;                    /**< HAL_FLASH_SECTOR_SIZE */
+    uint16_t max_keys;                       /**< PARAM_STORE_MAX_KEYS */
+    uint16_t crc;                            /**< CRC-16 of the fields above */
+} ParamStoreSectorHeader_t;
+
+/**
+ * @brief   Header of a record, programmed after its value, which follows it padded to HAL_FLASH_WRITE_SIZE
+ */
+typedef struct {
+    uint16_t key;                            /**< Key, all ones in erased flash */
+    uint16_t version;                        /**< Caller's layout version of the value */
+    uint16_t len;                            /**< Value length in bytes */
+    uint16_t crc;                            /**< CRC-16 of key, version, len and the value */
+} ParamStoreRecordHeader_t;
+
+/**
+ * @brief   RAM index of the mounted store
+ */
+typedef struct {
+    bool mounted;                            /**< Mounted; all other calls fail until then */
+    bool sealed;                             /**< Active sector takes no more records; the next write compacts */
+    uint32_t sector;                         /**< Active sector */
+    uint32_t generation;                     /**< Generation of the active sector, 0 before the first write */
+    uint32_t write_offset;                   /**< Next free byte in the active sector */
+    uint16_t record_offset[PARAM_STORE_MAX_KEYS]; /**< Newest record of each key in the active sector, 0 for none */
+} ParamStore_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Find the active sector and index its records
+ * @details Flash with no valid sector mounts as an empty store.
+ * @param   store Store index
+ * @return  false if there is no flash region
+ */
+bool param_store_mount(ParamStore_t *store);
+
+/**
+ * @brief   Read a value
+ * @param   store Mounted store
+ * @param   key Key
+ * @param   version Layout version the caller expects
+ * @param   data Buffer for the value
+ * @param   len Length the caller expects
+ * @return  true if the key holds a value of this version and length
+ */
+bool param_store_read(const ParamStore_t *store, uint16_t key, uint16_t version, void *data, uint16_t len);
+
+/**
+ * @brief   Write a value, replacing the key's previous one atomically
+ * @param   store Mounted store
+ * @param   key Key
+ * @param   version Layout version of the value
+ * @param   data Value
+ * @param   len Length in bytes, at most PARAM_STORE_MAX_VALUE_SIZE
+ * @return  true once the value is committed; false leaves the previous value, or none
+ */
+bool param_store_write(ParamStore_t *store, uint16_t key, uint16_t version, const void *data, uint16_t len);
+
+/**
+ * @brief   Load the stored configuration of an inverter
+ * @details The record goes through esc_config_is_valid(), so one with an out-of-range, NaN or infinite field, or no
+ *          phase current limit, is ignored as if none were stored.
+ * @param   store Mounted store
+ * @param   motor Inverter
+ * @param   cfg Configuration, written only if a valid one is stored
+ * @return  true if cfg was loaded
+ */
+bool param_store_load_config(const ParamStore_t *store, HalMotor_t motor, EscConfig_t *cfg);
+
+/**
+ * @brief   Store the configuration of an inverter for the next boot
+ * @param   store Mounted store
+ * @param   motor Inverter
+ * @param   cfg Configuration
+ * @return  false if cfg is not valid or was not committed
+ */
+bool param_store_save_config(ParamStore_t *store, HalMotor_t motor, const EscConfig_t *cfg);
+
+/** @} */
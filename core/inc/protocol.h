@@ -0,0 +1,306 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   protocol.h
+ *
+ * @brief  Header file for the binary command and telemetry protocol
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "cobs.h"
+
+/* Intra-component Headers */
+#include "esc.h"
+#include "param_store.h"
+
+/**
+ * @defgroup Protocol Binary command and telemetry protocol
+ * @brief    Framed requests, replies and telemetry stream over any byte link (UART, or CAN as a byte stream)
+ * @details  A frame is a message type byte, a sequence byte, the payload and a CRC-16/CCITT-FALSE of those, most
+ *           significant byte first, COBS-encoded and ended by a zero. A request of type T gets one reply of type
+ *           T | PROTOCOL_REPLY_FLAG with the same sequence, whose payload starts with a ProtocolStatus_t. Streamed
+ *           telemetry frames carry their own sequence, one up per frame, so the host can count what it missed.
+ *           Frames that fail the COBS or CRC check are dropped without a reply.
+ *
+ *           Multi-byte fields are little-endian and floats are IEEE-754 binary32. ESC structs travel packed field by
+ *           field in declaration order, with enums and bools as one byte and no padding, so the wire format does not
+ *           depend on the compiler's struct layout; protocol_pack_config() and the functions next to it write and
+ *           read them. Outgoing frames are encoded straight from the ESC's telemetry snapshot, configuration, scope
+ *           buffer and black box into the transmit buffer, and incoming frames are decoded in place and dispatched
+ *           from there, in the caller's receive buffer when a whole frame arrives in one piece.
+ *
+ *           READ_SCOPE takes the first frame (u16) and replies with the capture state (u8), channels (u8), frames
+ *           held (u16), trigger frame (i16, -1 for none), the first frame (u16), the frames that follow (u8) and
+ *           their samples. READ_BLACKBOX takes the first snapshot (u16) and replies with the frozen flag (u8), the
+ *           trigger fault flags (u8) and HAL fault (u8), snapshots held (u16), trigger snapshot (i16), the first
+ *           snapshot (u16), the snapshots that follow (u8) and the packed EscBlackBoxSample_t snapshots.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define PROTOCOL_VERSION 1U
+#define PROTOCOL_MAX_PAYLOAD 256U          /* Largest payload; longer readouts are split over several requests */
+#define PROTOCOL_HEADER_SIZE 2U            /* Type and sequence */
+#define PROTOCOL_CRC_SIZE 2U
+#define PROTOCOL_MAX_FRAME COBS_MAX_ENCODED_SIZE(PROTOCOL_HEADER_SIZE + PROTOCOL_MAX_PAYLOAD + PROTOCOL_CRC_SIZE)
+#define PROTOCOL_TX_BUFFER_SIZE (4U * PROTOCOL_MAX_FRAME) /* Frames waiting for the transport */
+#define PROTOCOL_REPLY_FLAG 0x80U          /* Set in the type of a reply */
+#define PROTOCOL_CONFIG_SIZE 133U          /* Packed EscConfig_t */
+#define PROTOCOL_TELEMETRY_SIZE 48U        /* Packed EscTelemetry_t */
+#define PROTOCOL_SCOPE_CONFIG_SIZE 15U     /* Packed EscScopeConfig_t */
+#define PROTOCOL_SCOPE_SAMPLE_SIZE 4U      /* One channel of a scope frame, an f32 */
+#define PROTOCOL_BLACKBOX_SAMPLE_SIZE 22U  /* Packed EscBlackBoxSample_t */
+
+/**
+ * @brief   Message types
+ */
+typedef enum {
+    PROTOCOL_MSG_PING = 0x01,             /**< No payload; replies with PROTOCOL_VERSION (u8) */
+    PROTOCOL_MSG_SET_THROTTLE = 0x02,     /**< Throttle command (f32) */
+    PROTOCOL_MSG_SET_BRAKE = 0x03,        /**< Brake command (f32) */
+    PROTOCOL_MSG_GET_CONFIG = 0x04,       /**< No payload; replies with the EscConfig_t in use */
+    PROTOCOL_MSG_SET_CONFIG = 0x05,       /**< EscConfig_t; reconfigures the ESC, only with the bridge off */
+    PROTOCOL_MSG_GET_TELEMETRY = 0x06,    /**< No payload; replies with the EscTelemetry_t snapshot */
+    PROTOCOL_MSG_STREAM_TELEMETRY = 0x07, /**< Enable (u8): send each new snapshot as a TELEMETRY frame */
+    PROTOCOL_MSG_ARM_SCOPE = 0x08,        /**< EscScopeConfig_t */
+    PROTOCOL_MSG_READ_SCOPE = 0x09,       /**< First frame (u16) */
+    PROTOCOL_MSG_READ_BLACKBOX = 0x0A,    /**< First snapshot (u16) */
+    PROTOCOL_MSG_SAVE_CONFIG = 0x0B,      /**< No payload; stores the EscConfig_t in use, only with the bridge off */
+    PROTOCOL_MSG_TELEMETRY = 0x40,        /**< Streamed EscTelemetry_t, not a reply */
+} ProtocolMsg_t;
+
+/**
+ * @brief   Reply status, the first payload byte of every reply
+ */
+typedef enum {
+    PROTOCOL_STATUS_OK,                   /**< Done */
+    PROTOCOL_STATUS_UNKNOWN,              /**< Unknown message type */
+    PROTOCOL_STATUS_LENGTH,               /**< Payload length wrong for the type */
+    PROTOCOL_STATUS_REJECTED,             /**< Value out of range, or not allowed in the present state */
+} ProtocolStatus_t;
+
+/**
+ * @brief   Decoded frame, pointing into the buffer it was decoded in
+ */
+typedef struct {
+    uint8_t type;                          /**< ProtocolMsg_t, with PROTOCOL_REPLY_FLAG in a reply */
+    uint8_t sequence;                      /**< Sequence number */
+    const uint8_t *payload;                /**< Payload */
+    size_t len;                            /**< Payload length */
+} ProtocolFrame_t;
+
+/**
+ * @brief   Frame encoder, writing into the caller's buffer as the frame is assembled
+ */
+typedef struct {
+    CobsEncoder_t cobs;                    /**< Encoder of the frame bytes */
+    uint16_t crc;                          /**< CRC so far */
+} ProtocolWriter_t;
+
+/**
+ * @brief   Handler of one received frame
+ */
+typedef void (*ProtocolHandler_t)(void *ctx, const ProtocolFrame_t *frame);
+
+/**
+ * @brief   Frame receiver: splits a byte stream into frames and checks them
+ */
+typedef struct {
+    uint8_t buf[PROTOCOL_MAX_FRAME];       /**< Encoded bytes of a frame that arrived in pieces */
+    size_t len;                            /**< Bytes held in buf */
+    bool overflow;                         /**< Frame in progress too long, dropped at its delimiter */
+    uint32_t frames;                       /**< Frames received and checked */
+    uint32_t errors;                       /**< Frames dropped for a bad encoding, length or CRC */
+    uint32_t overflows;                    /**< Frames dropped for being too long */
+} ProtocolRx_t;
+
+/**
+ * @brief   ESC end of the protocol
+ */
+typedef struct {
+    Esc_t *esc;                            /**< ESC instance served */
+    ParamStore_t *store;                   /**< Store SAVE_CONFIG writes to, NULL for none */
+    ProtocolRx_t rx;                       /**< Request receiver */
+    uint8_t tx[PROTOCOL_TX_BUFFER_SIZE];   /**< Encoded frames for the transport */
+    size_t tx_head;                        /**< First byte not yet taken by the transport */
+    size_t tx_len;                         /**< End of the encoded frames */
+    bool streaming;                        /**< Send each new telemetry snapshot */
+    uint32_t telemetry_sent;               /**< Sequence of the last snapshot sent */
+    uint8_t stream_sequence;               /**< Sequence of the next TELEMETRY frame */
+    uint32_t tx_frames;                    /**< Frames queued */
+    uint32_t tx_dropped;                   /**< Frames dropped for lack of transmit buffer */
+} Protocol_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Start a frame
+ * @param   writer Frame encoder
+ * @param   out Output buffer
+ * @param   size Output buffer size, PROTOCOL_MAX_FRAME is always enough
+ * @param   type Message type
+ * @param   sequence Sequence number
+ */
+void protocol_frame_begin(ProtocolWriter_t *writer, uint8_t *out, size_t size, uint8_t type, uint8_t sequence);
+
+/**
+ * @brief   Append payload to a frame
+ * @param   writer Frame encoder
+ * @param   data Payload bytes
+ * @param   len Length of data in bytes
+ */
+void protocol_frame_write(ProtocolWriter_t *writer, const void *data, size_t len);
+
+/**
+ * @brief   Close a frame
+ * @param   writer Frame encoder
+ * @return  Encoded length including the delimiter, 0 if the output buffer overflowed
+ */
+size_t protocol_frame_end(ProtocolWriter_t *writer);
+
+/**
+ * @brief   Decode and check one frame in place
+ * @param   buf Encoded frame without its delimiter, overwritten with the decoded frame
+ * @param   len Encoded length
+ * @param   frame Output frame, pointing into buf
+ * @return  true if the encoding, length and CRC are good
+ */
+bool protocol_frame_decode(uint8_t *buf, size_t len, ProtocolFrame_t *frame);
+
+/**
+ * @brief   Pack an ESC configuration for the wire
+ * @param   cfg Configuration
+ * @param   out Output, PROTOCOL_CONFIG_SIZE bytes
+ */
+void protocol_pack_config(const EscConfig_t *cfg, uint8_t *out);
+
+/**
+ * @brief   Unpack an ESC configuration from the wire, without checking it
+ * @param   data Packed configuration, PROTOCOL_CONFIG_SIZE bytes
+ * @param   cfg Output configuration
+ */
+void protocol_unpack_config(const uint8_t *data, EscConfig_t *cfg);
+
+/**
+ * @brief   Pack a telemetry snapshot for the wire
+ * @param   telemetry Snapshot
+ * @param   out Output, PROTOCOL_TELEMETRY_SIZE bytes
+ */
+void protocol_pack_telemetry(const EscTelemetry_t *telemetry, uint8_t *out);
+
+/**
+ * @brief   Unpack a telemetry snapshot from the wire
+ * @param   data Packed snapshot, PROTOCOL_TELEMETRY_SIZE bytes
+ * @param   telemetry Output snapshot
+ */
+void protocol_unpack_telemetry(const uint8_t *data, EscTelemetry_t *telemetry);
+
+/**
+ * @brief   Pack scope capture settings for the wire
+ * @param   cfg Capture settings
+ * @param   out Output, PROTOCOL_SCOPE_CONFIG_SIZE bytes
+ */
+void protocol_pack_scope_config(const EscScopeConfig_t *cfg, uint8_t *out);
+
+/**
+ * @brief   Unpack scope capture settings from the wire, without checking them
+ * @param   data Packed settings, PROTOCOL_SCOPE_CONFIG_SIZE bytes
+ * @param   cfg Output settings
+ */
+void protocol_unpack_scope_config(const uint8_t *data, EscScopeConfig_t *cfg);
+
+/**
+ * @brief   Pack one scope sample for the wire
+ * @param   value Sample
+ * @param   out Output, PROTOCOL_SCOPE_SAMPLE_SIZE bytes
+ */
+void protocol_pack_scope_sample(float value, uint8_t *out);
+
+/**
+ * @brief   Pack a black-box snapshot for the wire
+ * @param   sample Snapshot
+ * @param   out Output, PROTOCOL_BLACKBOX_SAMPLE_SIZE bytes
+ */
+void protocol_pack_blackbox_sample(const EscBlackBoxSample_t *sample, uint8_t *out);
+
+/**
+ * @brief   Unpack a black-box snapshot from the wire
+ * @param   data Packed snapshot, PROTOCOL_BLACKBOX_SAMPLE_SIZE bytes
+ * @param   sample Output snapshot
+ */
+void protocol_unpack_blackbox_sample(const uint8_t *data, EscBlackBoxSample_t *sample);
+
+/**
+ * @brief   Empty a receiver and clear its counters
+ * @param   rx Receiver
+ */
+void protocol_rx_reset(ProtocolRx_t *rx);
+
+/**
+ * @brief   Pass received bytes through a receiver, calling the handler for each good frame
+ * @details A frame wholly inside data is decoded where it lies, so data is overwritten.
+ * @param   rx Receiver
+ * @param   data Received bytes
+ * @param   len Number of bytes
+ * @param   handler Frame handler
+ * @param   ctx Handler context
+ */
+void protocol_rx_feed(ProtocolRx_t *rx, uint8_t *data, size_t len, ProtocolHandler_t handler, void *ctx);
+
+/**
+ * @brief   Start the ESC end of the protocol, not streaming
+ * @param   protocol Protocol instance
+ * @param   esc ESC instance to serve
+ */
+void protocol_init(Protocol_t *protocol, Esc_t *esc);
+
+/**
+ * @brief   Handle bytes from the link, queueing the replies
+ * @param   protocol Protocol instance
+ * @param   data Received bytes, overwritten as frames are decoded in place
+ * @param   len Number of bytes
+ */
+void protocol_receive(Protocol_t *protocol, uint8_t *data, size_t len);
+
+/**
+ * @brief   Queue a TELEMETRY frame if streaming and the snapshot is new; call after esc_step()
+ * @param   protocol Protocol instance
+ */
+void protocol_update(Protocol_t *protocol);
+
+/**
+ * @brief   Queue a TELEMETRY frame of the present snapshot
+ * @param   protocol Protocol instance
+ * @return  true if queued, false if the transmit buffer is full
+ */
+bool protocol_send_telemetry(Protocol_t *protocol);
+
+/**
+ * @brief   Frames waiting for the transport, contiguous so they can be handed to a DMA transfer
+ * @param   protocol Protocol instance
+ * @param   len Output number of bytes
+ * @return  First byte
+ */
+const uint8_t *protocol_get_tx(const Protocol_t *protocol, size_t *len);
+
+/**
+ * @brief   Release bytes the transport has sent
+ * @param   protocol Protocol instance
+ * @param   len Number of bytes, from the start of protocol_get_tx()
+ */
+void protocol_consume_tx(Protocol_t *protocol, size_t len);
+
+/** @} */
@@ -0,0 +1,103 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   scope.h
+ *
+ * @brief  Header file for the software oscilloscope
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup Scope Software oscilloscope
+ * @brief    Triggered capture of ESC signals at up to the loop rate, into a buffer in the ESC instance
+ * @details  A capture selects up to SCOPE_MAX_CHANNELS signals from the EscScopeSignal_t registry, a trigger on
+ *           any registry signal and a decimation. While armed, every decimation-th tick writes one frame into a
+ *           ring; once the pre-trigger frames are in, the trigger condition is checked on each frame, and after it
+ *           fires the remaining frames fill the buffer and the capture stops. The other ticks only count, so an
+ *           armed tick costs at most SCOPE_MAX_CHANNELS + 1 signal reads; with ESC_SCHED_BUDGET_CHECKS the cycles
+ *           of each armed tick are kept in last_cycles and max_cycles.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Stop any capture and empty the buffer
+ * @param   esc ESC instance
+ */
+void scope_reset(Esc_t *esc);
+
+/**
+ * @brief   Start a capture
+ * @param   esc ESC instance
+ * @param   cfg Capture settings
+ * @return  true if armed, false if the settings are out of range
+ */
+bool scope_arm(Esc_t *esc, const EscScopeConfig_t *cfg);
+
+/**
+ * @brief   Take this tick's frame if one is due and check the trigger
+ * @param   esc ESC instance
+ */
+void scope_update(Esc_t *esc);
+
+/**
+ * @brief   Read a registry signal
+ * @param   esc ESC instance
+ * @param   signal Signal to read
+ * @return  Signal value, 0 for an unknown signal
+ */
+float scope_read_signal(const Esc_t *esc, EscScopeSignal_t signal);
+
+/**
+ * @brief   Capture state
+ * @param   esc ESC instance
+ * @return  Present state
+ */
+EscScopeState_t scope_get_state(const Esc_t *esc);
+
+/**
+ * @brief   Number of frames held
+ * @param   esc ESC instance
+ * @return  Frames, up to the buffer depth
+ */
+uint32_t scope_get_num_frames(const Esc_t *esc);
+
+/**
+ * @brief   Position of the trigger frame
+ * @param   esc ESC instance
+ * @return  Index for scope_get_frame(), or -1 before the trigger
+ */
+int32_t scope_get_trigger_index(const Esc_t *esc);
+
+/**
+ * @brief   Locate one frame in the buffer, oldest first
+ * @param   esc ESC instance
+ * @param   index Frame index, 0 for the oldest held
+ * @return  The frame's samples, one per channel, or NULL if index is not below scope_get_num_frames()
+ */
+const float *scope_peek_frame(const Esc_t *esc, uint32_t index);
+
+/**
+ * @brief   Read one frame, oldest first
+ * @param   esc ESC instance
+ * @param   index Frame index, 0 for the oldest held
+ * @param   values Output, one value per channel
+ * @return  true if index is below scope_get_num_frames()
+ */
+bool scope_get_frame(const Esc_t *esc, uint32_t index, float values[SCOPE_MAX_CHANNELS]);
+
+/** @} */
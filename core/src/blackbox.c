@@ -0,0 +1,184 @@
+/*******************************************************************************************************************************
+ * @file   blackbox.c
+ *
+ * @brief  Source file for the fault black-box recorder
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "fault.h"
+
+/* Intra-component Headers */
+#include "blackbox.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define BLACKBOX_CURRENT_SCALE 100.0f     /* Counts per amp */
+#define BLACKBOX_VOLTAGE_SCALE 100.0f     /* Counts per volt */
+#define BLACKBOX_TEMPERATURE_SCALE 10.0f  /* Counts per degree */
+#define BLACKBOX_DUTY_SCALE (65535.0f / MAX_PWM_DUTY)
+#define BLACKBOX_BRIDGE_ENABLED 0x80U     /* Snapshot direction_state bit: inverter enabled */
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Scale and round to the nearest count, saturating at the field's range
+ */
+static int32_t _blackbox_quantize(float value, float scale, int32_t min, int32_t max)
+{
+    const float counts = value * scale;
+    if (counts <= (float)min) {
+        return min;
+    }
+    if (counts >= (float)max) {
+        return max;
+    }
+    return (int32_t)((counts >= 0.0f) ? counts + 0.5f : counts - 0.5f);
+}
+
+/**
+ * @brief   HAL fault as held in a snapshot
+ */
+static uint8_t _blackbox_hal_fault(const Esc_t *esc)
+{
+    const HalMotor_t motor = esc->hal_motor;
+    return (uint8_t)((uint8_t)hal_fault_get(motor) | (hal_fault_is_active(motor) ? BLACKBOX_HAL_FAULT_ACTIVE : 0U));
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void blackbox_reset(Esc_t *esc)
+{
+    if (esc == NULL) {
+        return;
+    }
+
+    EscBlackBox_t *bb = &esc->blackbox;
+    bb->head = 0U;
+    bb->count = 0U;
+    bb->time_us = 0U;
+    bb->prev_fault_flags = 0U;
+    bb->prev_hal_fault = 0U;
+    bb->triggered = false;
+    bb->frozen = false;
+    bb->trigger_fault_flags = 0U;
+    bb->trigger_hal_fault = 0U;
+    bb->trigger_age = 0U;
+}
+
+void blackbox_rearm(Esc_t *esc)
+{
+    if (esc == NULL) {
+        return;
+    }
+
+    EscBlackBox_t *bb = &esc->blackbox;
+    bb->triggered = false;
+    bb->frozen = false;
+    bb->trigger_fault_flags = 0U;
+    bb->trigger_hal_fault = 0U;
+    bb->trigger_age = 0U;
+    bb->prev_fault_flags = (uint8_t)esc->fault_flags;
+    bb->prev_hal_fault = _blackbox_hal_fault(esc);
+}
+
+void blackbox_record(Esc_t *esc, uint32_t dt_us)
+{
+    EscBlackBox_t *bb = &esc->blackbox;
+    if (bb->frozen) {
+        return;
+    }
+
+    bb->time_us += dt_us;
+    const MotorState_t *state = &esc->motor_state;
+    EscBlackBoxSample_t *sample = &bb->samples[bb->head];
+    sample->time_us = bb->time_us;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        sample->phase_current_cA[i] =
+            (int16_t)_blackbox_quantize(state->phase_currents_A[i], BLACKBOX_CURRENT_SCALE, INT16_MIN, INT16_MAX);
+    }
+    sample->vbus_cV = (uint16_t)_blackbox_quantize(state->vbus_V, BLACKBOX_VOLTAGE_SCALE, 0, UINT16_MAX);
+    sample->temperature_dC =
+        (int16_t)_blackbox_quantize(state->temperature_C, BLACKBOX_TEMPERATURE_SCALE, INT16_MIN, INT16_MAX);
+    sample->duty = (uint16_t)_blackbox_quantize(esc->inverter_cmd.duty, BLACKBOX_DUTY_SCALE, 0, UINT16_MAX);
+    sample->elec_angle = esc->elec_angle;
+    sample->hall_abc = state->hall_abc;
+    sample->fault_flags = (uint8_t)esc->fault_flags;
+    sample->hal_fault = _blackbox_hal_fault(esc);
+    sample->direction_state =
+        (uint8_t)((uint8_t)esc->direction_state | (esc->inverter_cmd.enable ? BLACKBOX_BRIDGE_ENABLED : 0U));
+
+    bb->head = (bb->head + 1U < BLACKBOX_SAMPLES) ? bb->head + 1U : 0U;
+    if (bb->count < BLACKBOX_SAMPLES) {
+        bb->count++;
+    }
+
+    /* The trigger snapshot is the first to show the new fault */
+    const uint8_t new_faults = (uint8_t)(sample->fault_flags & ~bb->prev_fault_flags);
+    const bool new_hal_fault = (sample->hal_fault != 0U) && (sample->hal_fault != bb->prev_hal_fault);
+    bb->prev_fault_flags = sample->fault_flags;
+    bb->prev_hal_fault = sample->hal_fault;
+    if (bb->triggered) {
+        bb->trigger_age++;
+        bb->frozen = (bb->trigger_age >= BLACKBOX_POST_TRIGGER_SAMPLES);
+    } else if (new_faults != 0U || new_hal_fault) {
+        bb->triggered = true;
+        bb->trigger_fault_flags = new_faults;
+        bb->trigger_hal_fault = sample->hal_fault;
+        bb->trigger_age = 0U;
+    }
+}
+
+bool blackbox_is_frozen(const Esc_t *esc)
+{
+    return (esc != NULL) && esc->blackbox.frozen;
+}
+
+uint32_t blackbox_get_num_samples(const Esc_t *esc)
+{
+    return (esc != NULL) ? esc->blackbox.count : 0U;
+}
+
+int32_t blackbox_get_trigger_index(const Esc_t *esc)
+{
+    if (esc == NULL || !esc->blackbox.triggered || esc->blackbox.trigger_age >= esc->blackbox.count) {
+        return -1;
+    }
+    return (int32_t)(esc->blackbox.count - 1U - esc->blackbox.trigger_age);
+}
+
+const EscBlackBoxSample_t *blackbox_peek_sample(const Esc_t *esc, uint32_t index)
+{
+    if (esc == NULL || index >= esc->blackbox.count) {
+        return NULL;
+    }
+
+    /* Once the ring has wrapped the oldest snapshot is the one about to be overwritten */
+    const EscBlackBox_t *bb = &esc->blackbox;
+    uint32_t slot = (bb->count < BLACKBOX_SAMPLES) ? index : bb->head + index;
+    if (slot >= BLACKBOX_SAMPLES) {
+        slot -= BLACKBOX_SAMPLES;
+    }
+    return &bb->samples[slot];
+}
+
+bool blackbox_get_sample(const Esc_t *esc, uint32_t index, EscBlackBoxSample_t *sample)
+{
+    const EscBlackBoxSample_t *held = blackbox_peek_sample(esc, index);
+    if (held == NULL || sample == NULL) {
+        return false;
+    }
+    *sample = *held;
+    return true;
+}
@@ -8,20 +8,96 @@
  *******************************************************************************************************************************/
 
 /* Standard library Headers */
+#include <math.h>
+#include <stddef.h>
 
 /* Inter-component Headers */
+#include "hal_time.h"
+#include "pwm.h"
+#include "trig.h"
 
 /* Intra-component Headers */
+#include "blackbox.h"
 #include "esc.h"
+#include "motor_id.h"
+#include "scope.h"
 
 #include "trapezoidal.h"
+#include "sinusoidal.h"
 #include "sensored.h"
+#include "sensorless.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define ESC_SQRT3 1.7320508f
+
+/* Scheduler budgets are checked in hal_time_get_cycles() cycles */
+#define ESC_SCHED_CYCLES(ns) ((uint32_t)(((uint64_t)(ns) * HAL_TIME_CYCLES_PER_US) / 1000U))
+
+#if (ESC_SCHED_MEDIUM_OFFSET >= ESC_SCHED_MEDIUM_DIVIDER) || (ESC_SCHED_SLOW_OFFSET >= ESC_SCHED_SLOW_DIVIDER) || \
+    (ESC_SCHED_TELEMETRY_OFFSET >= ESC_SCHED_SLOW_DIVIDER)
+#error "Scheduler task offsets must be smaller than their dividers"
+#endif
+
+#if (ESC_SCHED_SLOW_DIVIDER % ESC_SCHED_MEDIUM_DIVIDER) != 0U
+#error "The slow divider must be a multiple of the medium divider"
+#endif
+
+#if ((ESC_SCHED_SLOW_OFFSET % ESC_SCHED_MEDIUM_DIVIDER) == ESC_SCHED_MEDIUM_OFFSET) || \
+    ((ESC_SCHED_TELEMETRY_OFFSET % ESC_SCHED_MEDIUM_DIVIDER) == ESC_SCHED_MEDIUM_OFFSET) || \
+    (ESC_SCHED_TELEMETRY_OFFSET == ESC_SCHED_SLOW_OFFSET)
+#error "The divided tasks must not share a PWM period"
+#endif
+
+#if (ESC_SCHED_FAST_BUDGET_NS + ESC_SCHED_MEDIUM_BUDGET_NS) > (HAL_PWM_PERIOD_US * 1000U) || \
+    (ESC_SCHED_FAST_BUDGET_NS + ESC_SCHED_SLOW_BUDGET_NS) > (HAL_PWM_PERIOD_US * 1000U) || \
+    (ESC_SCHED_FAST_BUDGET_NS + ESC_SCHED_TELEMETRY_BUDGET_NS) > (HAL_PWM_PERIOD_US * 1000U)
+#error "The fast task and any divided task must fit in one PWM period"
+#endif
+
+/**
+ * @brief   Scheduler task table entry
+ */
+typedef struct {
+    void (*run)(Esc_t *esc, uint32_t dt_us); /**< Task body, given the time since its last run */
+    uint32_t divider;                        /**< Runs every divider PWM periods */
+    uint32_t offset;                         /**< PWM period within the divider it runs in */
+    uint32_t budget_cycles;                  /**< Execution budget */
+    bool sheddable;                          /**< Dropped in degraded mode */
+} EscTaskDesc_t;
 
 /*******************************************************************************************************************************
  * Private Function Definitions
  *******************************************************************************************************************************/
 
 // TODO STARTS: Feedback and Commutation Helpers
+/**
+ * @brief   Commutation method in effect; degraded mode falls back to the cheapest one
+ * @details Sensorless feedback sees the rotor only through sinusoidal drive, so it keeps it when degraded. Motor
+ *          identification drives its test vectors sinusoidally whatever the configuration.
+ */
+static EscCommutationMethod_t _esc_commutation_method(const Esc_t *esc)
+{
+    if (motor_id_is_running(esc)) {
+        return ESC_COMMUTATION_METHOD_SINE;
+    }
+    if (esc->deadline.degraded && esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORED) {
+        return ESC_COMMUTATION_METHOD_TRAP;
+    }
+    return esc->config.commutation_method;
+}
+
+/**
+ * @brief   Check whether sensorless feedback has yet to hand the drive over to its observer
+ */
+static bool _esc_sensorless_starting(const Esc_t *esc)
+{
+    return esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS &&
+           esc->sensorless.state != ESC_SENSORLESS_STATE_RUN;
+}
+
 /**
  * @brief   Update feedback-derived estimates
  */
@@ -37,28 +113,219 @@ static void _esc_update_feedback(Esc_t *esc, uint32_t dt_us)
             break;
 
         case ESC_FEEDBACK_MECHANISM_SENSORLESS:
-            /* Sensorless feedback is not implemented yet. */
+            sensorless_update_feedback(esc, dt_us);
             break;
 
         default:
             break;
     }
+
+    /* Current through the step applied last tick, positive when it produces torque in the driven direction */
+    MotorPhase_t high;
+    MotorPhase_t low;
+    esc->drive_current_A = 0.0f;
+    esc->quadrature_current_A = 0.0f;
+    esc->phase_current_max_A = 0.0f;
+    float current_sq_A2 = 0.0f;
+    float dc_current_A = 0.0f;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        const float i_A = esc->motor_state.phase_currents_A[i];
+        if (fabsf(i_A) > esc->phase_current_max_A) {
+            esc->phase_current_max_A = fabsf(i_A);
+        }
+        current_sq_A2 += i_A * i_A;
+        /* A phase draws from the bus while its high side conducts, and a floating phase still carrying current
+         * out of the motor returns it to the bus through its high-side diode */
+        dc_current_A += (esc->inverter_cmd.phase_duty[i] - esc->dead_time_duty[i]) * i_A;
+        if (((esc->inverter_cmd.high_enable_mask | esc->inverter_cmd.low_enable_mask) & ESC_PHASE_MASK(i)) == 0U &&
+            i_A < 0.0f) {
+            dc_current_A += i_A;
+        }
+    }
+    /* The thermal model runs at the slow rate and the battery limits at the medium rate on the means of these */
+    esc->current_sq_sum_A2 += current_sq_A2;
+    esc->current_sq_samples++;
+    esc->dc_current_sum_A += dc_current_A;
+    if (esc->inverter_cmd.enable && !esc->inverter_cmd.brake) {
+        esc->dc_duty_sum += esc->inverter_cmd.duty / MAX_PWM_DUTY;
+    }
+    esc->dc_samples++;
+    if (esc->inverter_cmd.enable &&
+        trapezoidal_step_to_phases(esc->inverter_cmd.commutation_step, &high, &low)) {
+        esc->drive_current_A = esc->motor_state.phase_currents_A[high];
+    }
+}
+
+/**
+ * @brief   Drive current limit from the phase current, thermal, battery and stall limits
+ */
+static float _esc_drive_current_limit(const Esc_t *esc)
+{
+    float limit_A = esc->config.limits.max_phase_current_A * CURRENT_LIMIT_FRACTION * esc->thermal_derate;
+    if (esc->battery_drive_limit_A < limit_A) {
+        limit_A = esc->battery_drive_limit_A;
+    }
+    if (esc->stall_cutback) {
+        const float hold_A = esc->config.limits.max_phase_current_A * STALL_HOLD_CURRENT_FRACTION;
+        limit_A = (hold_A < limit_A) ? hold_A : limit_A;
+    }
+    return limit_A;
+}
+
+/**
+ * @brief   MTPA field-opposing current for a torque current, interpolated from the table
+ */
+static float _esc_mtpa_current(const Esc_t *esc, float torque_A)
+{
+    const float position = torque_A / esc->config.limits.max_phase_current_A * (float)(MTPA_TABLE_POINTS - 1U);
+    if (position <= 0.0f) {
+        return 0.0f;
+    }
+    if (position >= (float)(MTPA_TABLE_POINTS - 1U)) {
+        return esc->mtpa_current_A[MTPA_TABLE_POINTS - 1U];
+    }
+    const uint32_t k = (uint32_t)position;
+    return esc->mtpa_current_A[k] + (position - (float)k) * (esc->mtpa_current_A[k + 1U] - esc->mtpa_current_A[k]);
+}
+
+/**
+ * @brief   Raise the field weakening current while the duty has no headroom left
+ * @details The sinusoidal duty only reaches FIELD_WEAKENING_DUTY when the current limiter has nothing to limit, so the
+ *          current grows while it stays there and winds back down once the limiter or the throttle pulls the duty
+ *          below. Past the base speed less duty means more current, not less, so the limiter cannot hold the current
+ *          vector there: the field weakening itself backs off as the vector reaches FIELD_WEAKENING_CURRENT_FRACTION
+ *          of the drive limit, trading torque current for the field weakening current it keeps.
+ * @param   current_A Current vector magnitude
+ */
+static void _esc_update_field_weakening(Esc_t *esc, float current_A, uint32_t dt_us)
+{
+    float error = esc->inverter_cmd.duty / MAX_PWM_DUTY - FIELD_WEAKENING_DUTY;
+    const float limit_A = _esc_drive_current_limit(esc);
+    if (limit_A > 0.0f) {
+        const float headroom = (FIELD_WEAKENING_CURRENT_FRACTION * limit_A - current_A) / limit_A;
+        error = (headroom < error) ? headroom : error;
+    }
+    esc->field_weakening_current_A += FIELD_WEAKENING_RATE_A_PER_S * error * (float)dt_us / MICROSECONDS_PER_SECOND;
+    if (esc->field_weakening_current_A > esc->config.field_weakening.max_current_A) {
+        esc->field_weakening_current_A = esc->config.field_weakening.max_current_A;
+    }
+    if (esc->field_weakening_current_A < 0.0f) {
+        esc->field_weakening_current_A = 0.0f;
+    }
+}
+
+/**
+ * @brief   Take the drive current from the sinusoidal phase currents and trim the lead angle to steer their angle
+ * @details The drive current is the part of the currents in phase with the back-EMF: a single phase changes sign
+ *          within every sector in sinusoidal drive. At speed the winding inductance makes the current lag the applied
+ *          voltage by up to 90 degrees, so the voltage has to lead the back-EMF by an angle that grows with the load.
+ *          The lead integrates the angle of the measured current against its target, so it needs no motor
+ *          parameters; with the current too small to give an angle, or outside sinusoidal motoring, it holds.
+ *          The target is in phase with the back-EMF, advanced by the MTPA table on a salient motor and by field
+ *          weakening once the duty runs out.
+ *          Sensorless feedback brakes sinusoidally too, with the drive current taken in the rotor's direction.
+ * @param   angle Electrical angle at the current sample
+ */
+static void _esc_update_sine_current(Esc_t *esc, uint16_t angle, uint32_t dt_us)
+{
+    const bool braking = (esc->direction_state == ESC_DIRECTION_STATE_BRAKING);
+    if (!esc->inverter_cmd.enable || esc->inverter_cmd.brake ||
+        (braking && esc->config.feedback_mechanism != ESC_FEEDBACK_MECHANISM_SENSORLESS)) {
+        esc->field_weakening_current_A = 0.0f;
+        esc->advance_current_A = 0.0f;
+        return;
+    }
+
+    const bool reverse = braking ? (esc->rotor_direction < 0) : (esc->direction_state == ESC_DIRECTION_STATE_REVERSE);
+    float in_phase_A;
+    float quadrature_A;
+    sinusoidal_project_currents(reverse ? (uint16_t)(angle + SINUSOIDAL_ANGLE_HALF_TURN) : angle,
+                                esc->motor_state.phase_currents_A, &in_phase_A, &quadrature_A);
+    esc->drive_current_A = in_phase_A;
+    esc->quadrature_current_A = reverse ? -quadrature_A : quadrature_A;
+    /* The open-loop startup sets its own angle */
+    if (braking || _esc_sensorless_starting(esc)) {
+        esc->field_weakening_current_A = 0.0f;
+        esc->advance_current_A = 0.0f;
+        return;
+    }
+
+    /* Current to lead the back-EMF by, opposing the rotor flux: MTPA and field weakening */
+    _esc_update_field_weakening(esc, trig_sqrt(in_phase_A * in_phase_A + quadrature_A * quadrature_A), dt_us);
+    esc->advance_current_A = _esc_mtpa_current(esc, in_phase_A) + esc->field_weakening_current_A;
+    if (in_phase_A < esc->config.limits.max_phase_current_A * SINE_LEAD_MIN_CURRENT_FRACTION) {
+        return;
+    }
+
+    /* Tangent of the current angle from its target, positive when the current leads in the direction of rotation */
+    float error = (esc->quadrature_current_A - esc->advance_current_A) / in_phase_A;
+    if (error > 1.0f) {
+        error = 1.0f;
+    } else if (error < -1.0f) {
+        error = -1.0f;
+    }
+
+    const float max_lead =
+        SINE_MAX_LEAD_DEG * (SINUSOIDAL_ANGLE_COUNTS / 360.0f) + (float)trig_atan2(esc->advance_current_A, in_phase_A);
+    esc->sine_lead -= SINE_LEAD_RATE_PER_S * error * (float)dt_us / MICROSECONDS_PER_SECOND *
+                      SINUSOIDAL_ANGLE_COUNTS_PER_RAD;
+    if (esc->sine_lead > max_lead) {
+        esc->sine_lead = max_lead;
+    } else if (esc->sine_lead < 0.0f) {
+        esc->sine_lead = 0.0f;
+    }
 }
 
 /**
  * @brief   Update inverter commutation step
  */
-static void _esc_update_commutation(Esc_t *esc)
+static void _esc_update_commutation(Esc_t *esc, uint32_t dt_us)
 {
     if (esc == NULL || esc->is_initialized == false) {
         return;
     }
 
-    switch (esc->config.commutation_method) {
+    const uint8_t hall = esc->motor_state.hall_abc & 0x07U;
+    switch (_esc_commutation_method(esc)) {
         case ESC_COMMUTATION_METHOD_TRAP:
-            esc->inverter_cmd.commutation_step = trapezoidal_hall_to_step(esc->motor_state.hall_abc & 0x07U);
+            esc->inverter_cmd.commutation_step = trapezoidal_hall_to_step(hall);
             break;
 
+        case ESC_COMMUTATION_METHOD_SINE: {
+            if (esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS) {
+                /* The observer angle is already filtered and projected by its PLL */
+                const uint16_t angle = sensorless_get_angle(esc, 0U);
+                esc->inverter_cmd.commutation_step = sinusoidal_angle_to_sector(angle);
+                _esc_update_sine_current(esc, angle, dt_us);
+                esc->elec_angle = sensorless_get_angle(esc, dt_us);
+                break;
+            }
+            /* The 6-step index still drives the current bookkeeping and braking */
+            esc->inverter_cmd.commutation_step = trapezoidal_hall_to_step(hall);
+            /* Near standstill the speed estimate is too stale to interpolate on, or even to give the direction:
+             * hold the sector centre */
+            float velocity_elec_hz = 0.0f;
+            if (fabsf(esc->velocity_mech_rpm) > REVERSAL_SPEED_THRESHOLD_RPM) {
+                velocity_elec_hz = esc->velocity_mech_rpm * (float)esc->config.motor_config.num_pole_pairs / 60.0f;
+            }
+            /* Time the transition from its timestamp: counted in ticks it would be up to a period late, a
+             * voltage angle error of several degrees at full speed */
+            uint32_t elapsed_us = esc->hall_elapsed_us;
+            if (elapsed_us < HALL_SPEED_TIMEOUT_US) {
+                elapsed_us = hal_time_elapsed_ticks32((uint32_t)hal_time_get_ticks(),
+                                                      esc->motor_state.hall_timestamp_ticks) / HAL_TIME_TICKS_PER_US;
+            }
+            uint16_t angle;
+            if (!sinusoidal_hall_to_angle(hall, velocity_elec_hz, elapsed_us, &angle)) {
+                break;
+            }
+            _esc_update_sine_current(esc, angle, dt_us);
+            /* The duties apply over the next period, so drive the angle at its middle */
+            esc->elec_angle = (uint16_t)(angle + (int32_t)(velocity_elec_hz * (float)dt_us * 0.5e-6f *
+                                                           SINUSOIDAL_ANGLE_COUNTS));
+            break;
+        }
+
         case ESC_COMMUTATION_METHOD_FOC:
             /* FOC commutation not implemented yet. */
             break;
@@ -71,11 +338,101 @@ static void _esc_update_commutation(Esc_t *esc)
 
 // TODO STARTS: Control and Output Helpers
 /**
- * @brief   Update control target from throttle command
+ * @brief   Update the battery current and power estimates and the phase current limits they imply
  */
-static void _esc_update_setpoint(Esc_t *esc) {
-    /* Check fault flags */
+static void _esc_update_battery(Esc_t *esc, uint32_t dt_us) {
+    const EscBatteryConfig_t *cfg = &esc->config.battery;
+    const float vbus_V = esc->motor_state.vbus_V;
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+    float duty = BATTERY_LIMIT_MIN_DUTY;
+    if (esc->dc_samples > 0U) {
+        esc->dc_current_A = esc->dc_current_sum_A / (float)esc->dc_samples;
+        const float mean_duty = esc->dc_duty_sum / (float)esc->dc_samples;
+        if (mean_duty > duty) {
+            duty = mean_duty;
+        }
+    }
+    esc->dc_current_sum_A = 0.0f;
+    esc->dc_duty_sum = 0.0f;
+    esc->dc_samples = 0U;
+    esc->input_power_W = vbus_V * esc->dc_current_A;
+
+    /* Battery current is duty times phase current, so each battery limit maps to a phase current limit */
+    float drive_A = esc->config.limits.max_phase_current_A;
+    if (cfg->max_discharge_current_A > 0.0f && cfg->max_discharge_current_A / duty < drive_A) {
+        drive_A = cfg->max_discharge_current_A / duty;
+    }
+    if (cfg->max_power_W > 0.0f && vbus_V > 0.0f && cfg->max_power_W / (vbus_V * duty) < drive_A) {
+        drive_A = cfg->max_power_W / (vbus_V * duty);
+    }
+
+    /* Back off as the bus sags towards UVLO so the pack recovers instead of tripping. The bus follows the battery
+     * current within a millisecond, so the foldback acts on a filtered voltage to keep its loop from ringing. */
+    esc->vbus_filtered_V += (vbus_V - esc->vbus_filtered_V) * dt_s / (BATTERY_SAG_FILTER_TAU_S + dt_s);
+    if (cfg->sag_foldback_band_V > 0.0f) {
+        float headroom = (esc->vbus_filtered_V - esc->config.limits.vbus_uvlo_V) / cfg->sag_foldback_band_V;
+        if (headroom > 1.0f) {
+            headroom = 1.0f;
+        }
+        if (headroom < 0.0f) {
+            headroom = 0.0f;
+        }
+        drive_A *= headroom;
+    }
+    esc->battery_drive_limit_A = drive_A;
+
+    /* Regeneration runs just under the back-EMF duty; the applied duty would swing with every switch between
+     * regenerative and dynamic braking and make the limit chatter */
+    float regen_duty = esc->bemf_duty_per_rpm * fabsf(esc->velocity_mech_rpm);
+    if (regen_duty < BATTERY_LIMIT_MIN_DUTY) {
+        regen_duty = BATTERY_LIMIT_MIN_DUTY;
+    }
+    float charge_A = esc->config.limits.max_phase_current_A;
+    if (cfg->max_charge_current_A > 0.0f && cfg->max_charge_current_A / regen_duty < charge_A) {
+        charge_A = cfg->max_charge_current_A / regen_duty;
+    }
+    esc->battery_charge_limit_A = charge_A;
+}
+
+/**
+ * @brief   Detect a stalled or locked rotor and cut the drive current back, then fault
+ * @details The rotor counts as stalled while it is driven with more than STALL_CURRENT_FRACTION of the phase current
+ *          limit and no Hall edge has arrived for HALL_SPEED_TIMEOUT_US. After STALL_CUTBACK_TIME_US the current is
+ *          held at STALL_HOLD_CURRENT_FRACTION, enough to hold against a load without cooking one winding pair, and
+ *          after STALL_FAULT_TIME_US ESC_FAULT_STALL latches. A Hall edge or releasing the drive starts over.
+ */
+static void _esc_update_stall(Esc_t *esc, uint32_t dt_us) {
+    const bool motoring = esc->inverter_cmd.enable && !esc->inverter_cmd.brake &&
+                          esc->direction_state != ESC_DIRECTION_STATE_BRAKING && !motor_id_is_running(esc);
+    const bool pushing = motoring &&
+        esc->drive_current_A >= esc->config.limits.max_phase_current_A * STALL_CURRENT_FRACTION;
+    const bool no_edges = (esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORED) &&
+                          (esc->hall_elapsed_us >= HALL_SPEED_TIMEOUT_US);
+
+    if (!pushing || !no_edges) {
+        esc->stall_time_us = 0U;
+        esc->stall_cutback = false;
+        return;
+    }
+
+    if (esc->stall_time_us < STALL_FAULT_TIME_US) {
+        esc->stall_time_us += dt_us;
+    }
+    if (esc->stall_time_us >= STALL_CUTBACK_TIME_US) {
+        esc->stall_cutback = true;
+    }
+    if (esc->stall_time_us >= STALL_FAULT_TIME_US) {
+        esc->fault_flags |= ESC_FAULT_STALL;
+    }
+}
+
+/**
+ * @brief   Slew the throttle towards the command and update the control target from it
+ */
+static void _esc_update_setpoint(Esc_t *esc, uint32_t dt_us) {
+    /* Check fault flags, a cleared fault ramps up again from zero */
     if (esc->fault_flags != ESC_FAULT_NONE) {
+        esc->throttle_ramped = 0.0f;
         esc->velocity_setpoint_rpm = 0.0f;
         esc->torque_setpoint_A = 0.0f;
         return;
@@ -90,6 +447,17 @@ static void _esc_update_setpoint(Esc_t *esc) {
         throttle = THROTTLE_CMD_MIN;
     }
 
+    /* Slew limit */
+    const float max_step = THROTTLE_RAMP_PER_S * (float)dt_us / MICROSECONDS_PER_SECOND;
+    float step = throttle - esc->throttle_ramped;
+    if (step > max_step) {
+        step = max_step;
+    } else if (step < -max_step) {
+        step = -max_step;
+    }
+    esc->throttle_ramped += step;
+    throttle = esc->throttle_ramped;
+
     /* Deadband */
     if (fabsf(throttle) < DEADBAND_THROTTLE) {
         throttle = 0.0f;
@@ -102,24 +470,16 @@ static void _esc_update_setpoint(Esc_t *esc) {
 }
 
 /**
- * @brief   Check safety limits and update fault state
+ * @brief   Check the limits that must trip within one PWM period and update fault state
  */
 static void _esc_check_limits(Esc_t *esc) {
-    /* Check undervolt lockout */
-    if (esc->motor_state.vbus_V < esc->config.limits.vbus_uvlo_V) {
-        esc->fault_flags |= ESC_FAULT_UVLO;
-    }
-    /* Check overvolt lockout */
+    /* Check overvolt lockout, fast because regeneration can pump the bus up within a few periods */
     if (esc->motor_state.vbus_V > esc->config.limits.vbus_ovlo_V) {
         esc->fault_flags |= ESC_FAULT_OVLO;
     }
-    /* Check overtemp */
-    if (esc->motor_state.temperature_C > esc->config.limits.max_temp_C) {
-        esc->fault_flags |= ESC_FAULT_OVERTEMP;
-    }
-    /* Check all phase currents against maximum and update fault flags*/
+    /* Check all phase current magnitudes against maximum and update fault flags*/
     for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
-        if (esc->motor_state.phase_currents_A[i] > 
+        if (fabsf(esc->motor_state.phase_currents_A[i]) > 
             esc->config.limits.max_phase_current_A) {
             esc->fault_flags |= ESC_FAULT_OVERCURRENT;
             break;
@@ -131,17 +491,233 @@ static void _esc_check_limits(Esc_t *esc) {
     return;
 }
 
+/**
+ * @brief   Advance the winding and inverter thermal models and update the current derating factor
+ */
+static void _esc_update_thermal(Esc_t *esc, uint32_t dt_us) {
+    const EscThermalConfig_t *cfg = &esc->config.thermal;
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+    const float current_sq_A2 = (esc->current_sq_samples > 0U) ?
+        esc->current_sq_sum_A2 / (float)esc->current_sq_samples : 0.0f;
+    esc->current_sq_sum_A2 = 0.0f;
+    esc->current_sq_samples = 0U;
+
+    float derate = 1.0f;
+    if (cfg->winding_resistance_Ohm > 0.0f) {
+        /* Copper loss at the resistance of the present estimate */
+        const float r_Ohm = thermal_copper_resistance(cfg->winding_resistance_Ohm, esc->winding_temp_C);
+        const float rise_K = thermal_node_update(&esc->winding_thermal, current_sq_A2 * r_Ohm, dt_s);
+        esc->winding_temp_C = esc->motor_state.temperature_C + rise_K;
+        derate = thermal_derate(esc->winding_temp_C, cfg->max_winding_temp_C, cfg->derate_band_C);
+    } else {
+        esc->winding_temp_C = esc->motor_state.temperature_C;
+    }
+
+    if (cfg->fet_rds_on_Ohm > 0.0f) {
+        /* Every phase current flows through one switch (or its diode) of its leg */
+        const float rise_K = thermal_node_update(&esc->fet_thermal, current_sq_A2 * cfg->fet_rds_on_Ohm, dt_s);
+        esc->fet_temp_C = cfg->ambient_temp_C + rise_K;
+        const float fet_derate = thermal_derate(esc->fet_temp_C, cfg->max_fet_temp_C, cfg->derate_band_C);
+        if (fet_derate < derate) {
+            derate = fet_derate;
+        }
+    } else {
+        esc->fet_temp_C = cfg->ambient_temp_C;
+    }
+
+    esc->thermal_derate = derate;
+}
+
+/**
+ * @brief   Check the slowly changing limits and update fault state
+ */
+static void _esc_check_supervision(Esc_t *esc) {
+    /* Check undervolt lockout */
+    if (esc->motor_state.vbus_V < esc->config.limits.vbus_uvlo_V) {
+        esc->fault_flags |= ESC_FAULT_UVLO;
+    }
+    /* Check overtemp */
+    if (esc->motor_state.temperature_C > esc->config.limits.max_temp_C) {
+        esc->fault_flags |= ESC_FAULT_OVERTEMP;
+    }
+}
+
+/**
+ * @brief   Check whether the rotor turns past base speed, its back-EMF peak above what the bus can oppose
+ * @details Only field weakening gets there. Shorting the windings to brake would then let the back-EMF push the
+ *          short-circuit current back into the bus through the diodes, past any regulator.
+ */
+static bool _esc_above_base_speed(const Esc_t *esc) {
+    const float speed_rad_s = fabsf(esc->velocity_mech_rpm) * (float)esc->config.motor_config.num_pole_pairs *
+                              (SINUSOIDAL_ANGLE_COUNTS / SINUSOIDAL_ANGLE_COUNTS_PER_RAD / 60.0f);
+    return ESC_SQRT3 * esc->config.motor_config.flux_linkage_Wb * speed_rad_s > esc->motor_state.vbus_V;
+}
+
+/**
+ * @brief   Update the direction state machine from the commanded direction
+ * @details A command against the rotor's motion brakes first and only flips the commutation sequence once the
+ *          speed has dropped below REVERSAL_SPEED_THRESHOLD_RPM, instead of plugging at speed. A brake request
+ *          brakes whatever the commanded direction and holds the state once the rotor has stopped.
+ */
+static void _esc_update_direction(Esc_t *esc, int8_t cmd_dir, bool brake_requested) {
+    const float speed_rpm = fabsf(esc->velocity_mech_rpm);
+    const bool moving = (esc->rotor_direction != 0) && (speed_rpm > REVERSAL_SPEED_THRESHOLD_RPM);
+
+    const bool brake = brake_requested ? moving : (moving && esc->rotor_direction == -cmd_dir);
+    if (brake) {
+        if (esc->direction_state != ESC_DIRECTION_STATE_BRAKING) {
+            /* Preload the regulator near the back-EMF so braking starts close to zero current */
+            pid_reset(&esc->current_pid, esc->bemf_duty_per_rpm * speed_rpm);
+            esc->dynamic_braking = false;
+            esc->direction_state = ESC_DIRECTION_STATE_BRAKING;
+        }
+        return;
+    }
+
+    /* Braking is over (stopped, or the request went away): fall back to the rotor's own direction, with the limiter
+     * rising from the back-EMF so the drive does not start with a full-duty step into a slow rotor */
+    if (esc->direction_state == ESC_DIRECTION_STATE_BRAKING) {
+        pid_reset(&esc->current_pid, esc->bemf_duty_per_rpm * speed_rpm);
+        pid_reset(&esc->regen_floor_pid, 0.0f);
+        esc->dynamic_braking = false;
+        esc->direction_state = (esc->rotor_direction < 0) ? ESC_DIRECTION_STATE_REVERSE : ESC_DIRECTION_STATE_FORWARD;
+    }
+
+    /* Coasting or a brake request at standstill holds the current state */
+    if (cmd_dir == 0 || brake_requested) {
+        return;
+    }
+
+    const EscDirectionState_t target = (cmd_dir > 0) ? ESC_DIRECTION_STATE_FORWARD : ESC_DIRECTION_STATE_REVERSE;
+    if (esc->direction_state != target) {
+        /* The rotor may still turn the old way at up to REVERSAL_SPEED_THRESHOLD_RPM, its back-EMF adding to the
+         * drive: the limiter rises from zero duty instead of plugging it with a full-duty step */
+        pid_reset(&esc->current_pid, 0.0f);
+        pid_reset(&esc->regen_floor_pid, 0.0f);
+        esc->direction_state = target;
+    }
+}
+
+/**
+ * @brief   Regenerative braking current allowed at the present bus voltage
+ * @details Folds back linearly to zero as vbus approaches vbus_ovlo_V so returned energy never trips ESC_FAULT_OVLO.
+ */
+static float _esc_regen_current_limit(const Esc_t *esc) {
+    const float zero_at_V = esc->config.limits.vbus_ovlo_V - REGEN_OVLO_MARGIN_V;
+    float headroom = (zero_at_V - esc->motor_state.vbus_V) / REGEN_FOLDBACK_BAND_V;
+    if (headroom > 1.0f) {
+        headroom = 1.0f;
+    }
+    if (headroom < 0.0f) {
+        headroom = 0.0f;
+    }
+    const float limit_A = esc->config.limits.max_regen_current_A * headroom * esc->thermal_derate;
+    return (esc->battery_charge_limit_A < limit_A) ? esc->battery_charge_limit_A : limit_A;
+}
+
+/**
+ * @brief   Drive current as the current limits see it, positive when motoring
+ * @details In sinusoidal drive a duty below the back-EMF at speed sets up current that mostly leads it and brakes
+ *          nothing, and a duty above it current that lags. Counting the leading current as returned and the lagging
+ *          as drive current gives the limits the sign of the duty error even where the in-phase current is small.
+ *          The lead that MTPA and field weakening ask for is not a duty error.
+ */
+static float _esc_net_current(const Esc_t *esc) {
+    return esc->drive_current_A - (esc->quadrature_current_A - esc->advance_current_A);
+}
+
+/**
+ * @brief   Line-to-line back-EMF peak as a fraction of the bus voltage, from the motor flux linkage
+ */
+static float _esc_bemf_ratio(const Esc_t *esc) {
+    if (esc->motor_state.vbus_V <= 0.0f) {
+        return 1.0f;
+    }
+    const float speed_rad_s = fabsf(esc->velocity_mech_rpm) * (float)esc->config.motor_config.num_pole_pairs *
+                              (SINUSOIDAL_ANGLE_COUNTS / SINUSOIDAL_ANGLE_COUNTS_PER_RAD / 60.0f);
+    const float ratio = ESC_SQRT3 * esc->config.motor_config.flux_linkage_Wb * speed_rad_s / esc->motor_state.vbus_V;
+    return (ratio < 1.0f) ? ratio : 1.0f;
+}
+
+/**
+ * @brief   Phase current rise over one period with the windings shorted, at most the back-EMF over two windings
+ */
+static float _esc_short_current_rise(const Esc_t *esc, float dt_s) {
+    const float inductance_H = esc->config.motor_config.phase_inductance_H;
+    if (inductance_H <= 0.0f) {
+        return 0.0f;
+    }
+    return _esc_bemf_ratio(esc) * esc->motor_state.vbus_V * dt_s / (2.0f * inductance_H);
+}
+
+/**
+ * @brief   Largest current a dynamic brake chop may build before its release
+ * @details A release drives the current of two windings into the bus against the bus voltage less the back-EMF, so
+ *          it returns 0.5 * 2L * I^2 / (1 - back-EMF ratio). With the DC-link capacitance known the current is held
+ *          to what the capacitor can take before the release voltage, whether or not the pack accepts charge.
+ */
+static float _esc_dynamic_brake_current_limit(const Esc_t *esc, float brake_A) {
+    const float capacitance_F = esc->config.battery.dc_link_capacitance_F;
+    const float inductance_H = esc->config.motor_config.phase_inductance_H;
+    if (capacitance_F <= 0.0f || inductance_H <= 0.0f) {
+        return brake_A;
+    }
+
+    const float release_V = esc->config.limits.vbus_ovlo_V - DYNAMIC_BRAKE_OVLO_MARGIN_V;
+    const float vbus_V = esc->motor_state.vbus_V;
+    const float headroom_V2 = release_V * release_V - vbus_V * vbus_V;
+    if (headroom_V2 <= 0.0f) {
+        return 0.0f;
+    }
+    const float limit_A = sqrtf(capacitance_F * headroom_V2 * (1.0f - _esc_bemf_ratio(esc)) / (2.0f * inductance_H));
+    return (limit_A < brake_A) ? limit_A : brake_A;
+}
+
+/**
+ * @brief   Compute the braking duty for the requested braking current
+ * @return  Duty in [0, 1]; sets inverter_cmd.brake and inverter_cmd.enable for dynamic braking
+ */
+static float _esc_update_brake(Esc_t *esc, float brake_A, float dt_s) {
+    esc->current_pid.out_max = 1.0f;
+
+    if (brake_A <= _esc_regen_current_limit(esc)) {
+        if (esc->dynamic_braking) {
+            pid_reset(&esc->current_pid, esc->bemf_duty_per_rpm * fabsf(esc->velocity_mech_rpm));
+            esc->dynamic_braking = false;
+        }
+
+        /* Regenerative: duty held under the back-EMF, reverse current returned to the bus */
+        esc->inverter_cmd.brake = false;
+        esc->inverter_cmd.enable = true;
+        return pid_update(&esc->current_pid, -brake_A - _esc_net_current(esc), dt_s);
+    }
+
+    /* Dynamic braking fallback: short the windings through the low side, chopped against the brake current.
+     * Every chop returns the winding energy to the bus through the diodes, so the brake releases near OVLO. */
+    esc->dynamic_braking = true;
+    esc->inverter_cmd.brake = true;
+    esc->inverter_cmd.enable = (esc->phase_current_max_A + _esc_short_current_rise(esc, dt_s) <
+                                _esc_dynamic_brake_current_limit(esc, brake_A)) &&
+                               (esc->motor_state.vbus_V < esc->config.limits.vbus_ovlo_V - DYNAMIC_BRAKE_OVLO_MARGIN_V);
+    return 0.0f;
+}
+
 /**
  * @brief   Update inverter command outputs
  */
-static void _esc_update_output(Esc_t *esc) {
+static void _esc_update_output(Esc_t *esc, uint32_t dt_us) {
+    esc->sensorless.drive_requested = false;
+
     /* Check fault flags */
     if (esc->fault_flags != ESC_FAULT_NONE) {
+        esc->inverter_cmd.enable = false;
+        esc->inverter_cmd.brake = false;
+        esc->inverter_cmd.duty = 0.0f;
         return;
     }
 
     /* Clamp throttle to max values */
-    float throttle = esc->throttle_cmd;
+    float throttle = esc->throttle_ramped;
     if (throttle > THROTTLE_CMD_MAX) {
         throttle = THROTTLE_CMD_MAX;
     }
@@ -149,105 +725,441 @@ static void _esc_update_output(Esc_t *esc) {
         throttle = THROTTLE_CMD_MIN;
     }
 
-    /* Find direction based on throttle input */
-    bool reverse = 0;
-    if (throttle < 0.0f) {
-        reverse = 1;
+    /* Take duty as abs of throttle, direction from its sign */
+    const float duty = fabsf(throttle);
+    int8_t cmd_dir = (throttle < 0.0f) ? -1 : 1;
+
+    /* Deadband */
+    if (duty < DEADBAND_DUTY) {
+        cmd_dir = 0;
     }
+    bool brake_requested = (esc->brake_cmd >= DEADBAND_DUTY);
 
-    /* Take duty as abs of throttle */
-    float duty;
-    if (throttle >= 0.0f) {
-        duty = throttle;
-    } else {
-        duty = -throttle; 
+    /* Coast down to base speed before braking out of field weakening */
+    if (esc->direction_state != ESC_DIRECTION_STATE_BRAKING && esc->config.field_weakening.max_current_A > 0.0f &&
+        (brake_requested || cmd_dir == -esc->rotor_direction) && _esc_above_base_speed(esc)) {
+        cmd_dir = 0;
+        brake_requested = false;
     }
 
-    /* Deadband */
-    if (duty < DEADBAND_DUTY) {
+    _esc_update_direction(esc, cmd_dir, brake_requested);
+
+    /* Coast with the bridge off inside the deadband, or once a brake request has stopped the rotor */
+    if (esc->direction_state != ESC_DIRECTION_STATE_BRAKING && (cmd_dir == 0 || brake_requested)) {
+        esc->inverter_cmd.enable = false;
+        esc->inverter_cmd.brake = false;
+        esc->inverter_cmd.duty = 0.0f;
         return;
     }
 
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+    const float limit_A = esc->config.limits.max_phase_current_A * CURRENT_LIMIT_FRACTION * esc->thermal_derate;
     uint8_t step = esc->inverter_cmd.commutation_step;
+    float applied_duty;
+
+    switch (esc->direction_state) {
+        case ESC_DIRECTION_STATE_BRAKING:
+            /* Follow the rotor's own sequence; braking strength comes from the brake or the reversing throttle */
+            if (esc->rotor_direction < 0) {
+                step = (step + 3) % 6;
+            }
+            applied_duty = _esc_update_brake(esc, (brake_requested ? esc->brake_cmd : duty) * limit_A, dt_s);
+            break;
+
+        case ESC_DIRECTION_STATE_REVERSE:
+            /* Update direction by 180 degree electrical shift */
+            step = (step + 3) % 6;
+            /* Fall through */
+        case ESC_DIRECTION_STATE_FORWARD:
+        default:
+            esc->sensorless.drive_requested = true;
+            if (esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS &&
+                (esc->sensorless.state == ESC_SENSORLESS_STATE_IDLE ||
+                 esc->sensorless.state == ESC_SENSORLESS_STATE_CATCH)) {
+                /* The bridge stays off until the startup has looked for the rotor with its short pulses. The
+                 * limiter and the regenerative floor wait at the back-EMF duty, amplitude 1 being a phase voltage of
+                 * vbus / sqrt(3), so the drive picks a spinning rotor up without a current step whatever the
+                 * throttle. */
+                const float bemf_duty = (esc->motor_state.vbus_V > 0.0f)
+                                            ? ESC_SQRT3 * esc->config.motor_config.flux_linkage_Wb *
+                                                  fabsf(esc->sensorless.pll_speed_rad_s) / esc->motor_state.vbus_V
+                                            : 0.0f;
+                pid_reset(&esc->current_pid, bemf_duty);
+                pid_reset(&esc->regen_floor_pid, bemf_duty);
+                esc->inverter_cmd.brake = true;
+                esc->inverter_cmd.enable =
+                    (esc->sensorless.state == ESC_SENSORLESS_STATE_CATCH) && esc->sensorless.catch_short;
+                applied_duty = 0.0f;
+                break;
+            }
+            /* Cap the limiter at the requested duty so its integrator never winds up above it. Throttling down
+             * below the back-EMF regenerates, so the cap is held up as far as needed to keep the returned current
+             * within the regenerative limit. Only a rotor turning the driven way at speed can regenerate; below
+             * that the drive current swings negative on commutation alone. */
+            float floor_duty = 0.0f;
+            if (esc->rotor_direction == cmd_dir && fabsf(esc->velocity_mech_rpm) > REVERSAL_SPEED_THRESHOLD_RPM) {
+                floor_duty =
+                    pid_update(&esc->regen_floor_pid, -_esc_regen_current_limit(esc) - _esc_net_current(esc), dt_s);
+            } else {
+                pid_reset(&esc->regen_floor_pid, 0.0f);
+            }
+            esc->current_pid.out_max = (floor_duty > duty) ? floor_duty : duty;
+            /* Battery current, power and sag limits and the stall cut-back apply to motoring only */
+            float drive_limit_A = _esc_drive_current_limit(esc);
+            /* While motoring, limit the largest phase current: right after a commutation at low speed the shared
+             * phase carries the new and the freewheeling current together */
+            const float net_A = _esc_net_current(esc);
+            float measured_A = (net_A > 0.0f) ? esc->phase_current_max_A : net_A;
+            /* A sensorless start drives the startup current whatever the throttle, on the current vector's size */
+            const bool starting = _esc_sensorless_starting(esc);
+            if (starting) {
+                pid_reset(&esc->regen_floor_pid, 0.0f);
+                esc->current_pid.out_max = 1.0f;
+                drive_limit_A = (esc->sensorless.current_A < drive_limit_A) ? esc->sensorless.current_A : drive_limit_A;
+                measured_A = esc->phase_current_max_A;
+            }
+            applied_duty = pid_update(&esc->current_pid, drive_limit_A - measured_A, dt_s);
+            esc->inverter_cmd.enable = true;
+            esc->inverter_cmd.brake = false;
 
-    /* WARNING: Reverse handelling may change in future. */
-    /* Update direction by 180 degree electrical shift */
-    if (reverse) {
-        step = (step + 3) % 6;
+            /* Learn the duty-to-speed ratio while driving so braking can start near the back-EMF */
+            if (!starting && esc->rotor_direction == cmd_dir && esc->field_weakening_current_A <= 0.0f &&
+                fabsf(esc->velocity_mech_rpm) > REVERSAL_SPEED_THRESHOLD_RPM) {
+                const float ratio = applied_duty / fabsf(esc->velocity_mech_rpm);
+                esc->bemf_duty_per_rpm += BEMF_DUTY_LEARNING_RATE * (ratio - esc->bemf_duty_per_rpm);
+            }
+            break;
     }
 
     /* Update inverter_cmd */
-    esc->inverter_cmd.enable = true;
-    esc->inverter_cmd.duty = duty * MAX_PWM_DUTY; /* Scaling to MAX_PWM_DUTY */
+    esc->inverter_cmd.duty = applied_duty * MAX_PWM_DUTY; /* Scaling to MAX_PWM_DUTY */
     esc->inverter_cmd.commutation_step = step;
 
     return;
 }
 // TODO ENDS.
 
-/*******************************************************************************************************************************
- * Public Function Definitions
- *******************************************************************************************************************************/
-void esc_step(Esc_t *esc, uint32_t dt_us)
-{
-    if (esc == NULL){
-        return; //null pntr check
+/**
+ * @brief   Expand the 6-step command, or the sine angle when motoring, into per-phase switch states for the PWM HAL
+ * @details Regenerative braking always switches the PWM-ed phase complementarily: with only the high side the
+ *          reverse current freewheels through its body diode to the bus and the duty has no control over it.
+ *          Sensorless feedback brakes sinusoidally as well, as its observer needs all three terminal voltages.
+ */
+static void _esc_update_phase_outputs(Esc_t *esc) {
+    EscInverterCmd_t *cmd = &esc->inverter_cmd;
+
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        cmd->phase_duty[i] = 0.0f;
+        esc->dead_time_duty[i] = 0.0f;
     }
+    cmd->high_enable_mask = 0U;
+    cmd->low_enable_mask = 0U;
+    cmd->dead_time_ns = esc->config.pwm.dead_time_ns;
+    cmd->center_aligned = esc->config.pwm.center_aligned;
 
-    if (!esc->is_initialized){
-        
-        return; 
+    if (!cmd->enable) {
+        return;
     }
 
-    if (dt_us == 0U){
+    /* Dynamic braking shorts all windings through the low side */
+    if (cmd->brake) {
+        cmd->low_enable_mask = ESC_PHASE_MASK_ALL;
         return;
     }
 
-    _esc_update_feedback(esc, dt_us);
-    _esc_update_setpoint(esc);
-    _esc_update_commutation(esc);
-    _esc_check_limits(esc);
-    _esc_update_output(esc);
+    MotorPhase_t high;
+    MotorPhase_t low;
+    if (!trapezoidal_step_to_phases(cmd->commutation_step, &high, &low)) {
+        cmd->enable = false;
+        return;
+    }
+
+    /* Sinusoidal motoring switches all three legs complementarily around half duty */
+    const bool braking = (esc->direction_state == ESC_DIRECTION_STATE_BRAKING);
+    if (_esc_commutation_method(esc) == ESC_COMMUTATION_METHOD_SINE &&
+        (!braking || esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS)) {
+        /* Reverse drives half a turn around and leads the other way; braking follows the rotor without lead */
+        const bool reverse =
+            braking ? (esc->rotor_direction < 0) : (esc->direction_state == ESC_DIRECTION_STATE_REVERSE);
+        const uint16_t lead = braking ? 0U : (uint16_t)esc->sine_lead;
+        const uint16_t angle = reverse ?
+            (uint16_t)(esc->elec_angle + SINUSOIDAL_ANGLE_HALF_TURN - lead) : (uint16_t)(esc->elec_angle + lead);
+        sinusoidal_angle_to_duties(angle, cmd->duty / MAX_PWM_DUTY, cmd->phase_duty);
+        cmd->high_enable_mask = ESC_PHASE_MASK_ALL;
+        cmd->low_enable_mask = ESC_PHASE_MASK_ALL;
+        return;
+    }
+
+    cmd->phase_duty[high] = cmd->duty / MAX_PWM_DUTY;
+    cmd->high_enable_mask = ESC_PHASE_MASK(high);
+    cmd->low_enable_mask = ESC_PHASE_MASK(low);
+    if (esc->config.pwm.synchronous_rectification || esc->direction_state == ESC_DIRECTION_STATE_BRAKING) {
+        cmd->low_enable_mask |= ESC_PHASE_MASK(high);
+    }
 }
 
-void esc_set_throttle(Esc_t *esc, const float throttle_cmd) {
-    /* Validate esc input */
-    if (esc == NULL || esc->is_initialized == false) {
+/**
+ * @brief   Correct the complementary phase duties for the dead time and the switch drops
+ * @details Through the dead time a leg's diode sets its voltage: the low side's for current out of the leg, losing
+ *          the dead time from the high-side pulse and a diode drop below ground, the high side's for current into
+ *          it, adding both. The on-resistance drop follows the current. The correction is the same voltage the other
+ *          way, ramped in across DEAD_TIME_COMP_CURRENT_FRACTION of the current limit so a noisy sign near the zero
+ *          crossing does not chatter. A leg parked at 0% or 100% never switches and is left alone.
+ */
+static void _esc_compensate_dead_time(Esc_t *esc) {
+    EscInverterCmd_t *cmd = &esc->inverter_cmd;
+    const float vbus_V = esc->motor_state.vbus_V;
+    if (!esc->config.pwm.dead_time_compensation || !cmd->enable || cmd->brake || vbus_V <= 0.0f) {
         return;
     }
-    /* Clamp throttle command to valid range [THROTTLE_CMD_MIN, THROTTLE_CMD_MAX] */
-    if (throttle_cmd > THROTTLE_CMD_MAX) {
-        esc->throttle_cmd = THROTTLE_CMD_MAX;
-    } else if (throttle_cmd < THROTTLE_CMD_MIN) {
-        esc->throttle_cmd = THROTTLE_CMD_MIN;
-    } else {
-        esc->throttle_cmd = throttle_cmd;
+
+    const float dead_fraction = (float)esc->config.pwm.dead_time_ns * 1e-9f * (float)HAL_PWM_FREQUENCY_HZ;
+    const float dead_duty = dead_fraction * (1.0f + 2.0f * esc->config.pwm.diode_forward_V / vbus_V);
+    const float band_A = esc->config.limits.max_phase_current_A * DEAD_TIME_COMP_CURRENT_FRACTION;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        const float duty = cmd->phase_duty[i];
+        if ((cmd->high_enable_mask & cmd->low_enable_mask & ESC_PHASE_MASK(i)) == 0U || duty <= 0.0f || duty >= 1.0f) {
+            continue;
+        }
+
+        const float i_A = esc->motor_state.phase_currents_A[i];
+        float sign = i_A / band_A;
+        if (sign > 1.0f) {
+            sign = 1.0f;
+        } else if (sign < -1.0f) {
+            sign = -1.0f;
+        }
+        float compensated = duty + sign * dead_duty + i_A * esc->config.thermal.fet_rds_on_Ohm / vbus_V;
+        if (compensated > 1.0f) {
+            compensated = 1.0f;
+        } else if (compensated < 0.0f) {
+            compensated = 0.0f;
+        }
+        cmd->phase_duty[i] = compensated;
+        esc->dead_time_duty[i] = compensated - duty;
     }
 }
 
-void esc_set_motor_state(Esc_t *esc, const MotorState_t *state) {
-    /* Validate esc input */
-    if (esc == NULL || esc->is_initialized == false || state == NULL) {
+/**
+ * @brief   Refresh the telemetry snapshot
+ */
+static void _esc_update_telemetry(Esc_t *esc) {
+    esc->telemetry.vbus_V = esc->motor_state.vbus_V;
+    esc->telemetry.temperature_C = esc->motor_state.temperature_C;
+    esc->telemetry.velocity_mech_rpm = esc->velocity_mech_rpm;
+    esc->telemetry.drive_current_A = esc->drive_current_A;
+    esc->telemetry.throttle = esc->throttle_ramped;
+    esc->telemetry.winding_temp_C = esc->winding_temp_C;
+    esc->telemetry.fet_temp_C = esc->fet_temp_C;
+    esc->telemetry.thermal_derate = esc->thermal_derate;
+    esc->telemetry.dc_current_A = esc->dc_current_A;
+    esc->telemetry.input_power_W = esc->input_power_W;
+    esc->telemetry.fault_flags = esc->fault_flags;
+    esc->telemetry.sequence++;
+}
+
+/**
+ * @brief   Tabulate the MTPA field-opposing current against the torque current from the motor's saliency
+ * @details With Lq above Ld the rotor adds a reluctance torque 3/2 p (Ld - Lq) id iq, which a negative id turns
+ *          positive. Torque per amp peaks at -id = sqrt(lambda^2 / (4 dL^2) + iq^2) - lambda / (2 dL), dL = Lq - Ld;
+ *          without saliency the table is zero.
+ */
+static void _esc_init_mtpa(Esc_t *esc) {
+    const MotorConfig_t *motor = &esc->config.motor_config;
+    const float saliency_H = motor->q_axis_inductance_H - motor->phase_inductance_H;
+    for (uint32_t k = 0U; k < MTPA_TABLE_POINTS; ++k) {
+        esc->mtpa_current_A[k] = 0.0f;
+        if (motor->q_axis_inductance_H > 0.0f && saliency_H > 0.0f) {
+            const float torque_A =
+                esc->config.limits.max_phase_current_A * (float)k / (float)(MTPA_TABLE_POINTS - 1U);
+            const float half_A = motor->flux_linkage_Wb / (2.0f * saliency_H);
+            esc->mtpa_current_A[k] = sqrtf(half_A * half_A + torque_A * torque_A) - half_A;
+        }
+    }
+}
+
+/**
+ * @brief   Set the current loop gains from the configuration, or the defaults where it has none
+ */
+static void _esc_init_current_loops(Esc_t *esc) {
+    const float kp = (esc->config.current_loop.kp > 0.0f) ? esc->config.current_loop.kp : CURRENT_LIMIT_KP;
+    const float ki = (esc->config.current_loop.ki > 0.0f) ? esc->config.current_loop.ki : CURRENT_LIMIT_KI;
+    pid_init(&esc->current_pid, kp, ki, 0.f, 0.f, 1.f);
+    pid_reset(&esc->current_pid, 1.f);
+    pid_init(&esc->regen_floor_pid, kp, ki, 0.f, 0.f, 1.f);
+}
+
+/**
+ * @brief   Fast task: everything the inverter command of the next period depends on
+ * @details Motor identification takes the place of commutation and the control loop while it runs. The black box
+ *          snapshots the tick last, with the command it produced.
+ */
+static void _esc_task_fast(Esc_t *esc, uint32_t dt_us) {
+    _esc_update_feedback(esc, dt_us);
+    if (motor_id_is_running(esc)) {
+        _esc_check_limits(esc);
+        motor_id_update(esc, dt_us);
+        /* New motor parameters: new gains, and an observer seeded with the new flux linkage */
+        if (esc->motor_id.state == ESC_MOTOR_ID_STATE_DONE) {
+            _esc_init_current_loops(esc);
+            _esc_init_mtpa(esc);
+            sensorless_reset(esc);
+        }
+        _esc_update_phase_outputs(esc);
+        blackbox_record(esc, dt_us);
+        scope_update(esc);
         return;
     }
-    esc->motor_state = *state;
+    _esc_update_commutation(esc, dt_us);
+    _esc_check_limits(esc);
+    _esc_update_output(esc, dt_us);
+    _esc_update_phase_outputs(esc);
+    _esc_compensate_dead_time(esc);
+    blackbox_record(esc, dt_us);
+    scope_update(esc);
+}
+
+/**
+ * @brief   Medium task: battery limits, stall detection, throttle ramp and speed/torque setpoints
+ */
+static void _esc_task_medium(Esc_t *esc, uint32_t dt_us) {
+    _esc_update_battery(esc, dt_us);
+    _esc_update_stall(esc, dt_us);
+    _esc_update_setpoint(esc, dt_us);
 }
 
+/**
+ * @brief   Slow task: thermal model and derating, thermal and undervoltage supervision
+ */
+static void _esc_task_slow(Esc_t *esc, uint32_t dt_us) {
+    _esc_update_thermal(esc, dt_us);
+    _esc_check_supervision(esc);
+}
 
-bool esc_init(Esc_t *esc, const EscConfig_t *cfg) {
-    if (esc == NULL || cfg == NULL) {
-        return false;
+/**
+ * @brief   Telemetry task
+ */
+static void _esc_task_telemetry(Esc_t *esc, uint32_t dt_us) {
+    (void)dt_us;
+    _esc_update_telemetry(esc);
+}
+
+/* Task table, in run order within a PWM period. Only telemetry is sheddable: the medium and slow tasks hold the
+ * battery, stall, thermal and undervoltage protection, which a controller running late needs as much as one on time.
+ * Degraded mode makes up the time in the fast task instead, with 6-step commutation. */
+static const EscTaskDesc_t esc_tasks[NUM_ESC_TASKS] = {
+    [ESC_TASK_FAST]      = { _esc_task_fast,      1U,                       0U,
+                             ESC_SCHED_CYCLES(ESC_SCHED_FAST_BUDGET_NS),      false },
+    [ESC_TASK_MEDIUM]    = { _esc_task_medium,    ESC_SCHED_MEDIUM_DIVIDER, ESC_SCHED_MEDIUM_OFFSET,
+                             ESC_SCHED_CYCLES(ESC_SCHED_MEDIUM_BUDGET_NS),    false },
+    [ESC_TASK_SLOW]      = { _esc_task_slow,      ESC_SCHED_SLOW_DIVIDER,   ESC_SCHED_SLOW_OFFSET,
+                             ESC_SCHED_CYCLES(ESC_SCHED_SLOW_BUDGET_NS),      false },
+    [ESC_TASK_TELEMETRY] = { _esc_task_telemetry, ESC_SCHED_SLOW_DIVIDER,   ESC_SCHED_TELEMETRY_OFFSET,
+                             ESC_SCHED_CYCLES(ESC_SCHED_TELEMETRY_BUDGET_NS), true },
+};
+
+/**
+ * @brief   Restart the schedule and clear the task statistics
+ */
+static void _esc_sched_reset(Esc_t *esc) {
+    for (int i = 0; i < NUM_ESC_TASKS; ++i) {
+        esc->tasks[i].countdown = esc_tasks[i].offset;
+        esc->tasks[i].elapsed_us = 0U;
+        esc->tasks[i].runs = 0U;
+        esc->tasks[i].last_cycles = 0U;
+        esc->tasks[i].max_cycles = 0U;
+        esc->tasks[i].budget_overruns = 0U;
+    }
+}
+
+/**
+ * @brief   Account one esc_step() call in the deadline monitor and latch degraded mode on repeated overruns
+ * @param   tick_cycles Entry-to-exit time of the call
+ * @param   longest_task Longest-running task in the call
+ * @param   longest_cycles Run time of that task
+ */
+static void _esc_update_deadline(Esc_t *esc, uint32_t dt_us, uint32_t tick_cycles, EscTask_t longest_task,
+                                 uint32_t longest_cycles) {
+    const EscDeadlineConfig_t *cfg = &esc->config.deadline;
+    EscDeadlineStats_t *dl = &esc->deadline;
+    const uint64_t deadline_cycles = (cfg->deadline_ns > 0U) ? (uint64_t)ESC_SCHED_CYCLES(cfg->deadline_ns)
+                                                             : (uint64_t)dt_us * HAL_TIME_CYCLES_PER_US;
+
+    dl->ticks++;
+    dl->last_cycles = tick_cycles;
+    if (tick_cycles > dl->max_cycles) {
+        dl->max_cycles = tick_cycles;
+    }
+
+    if (tick_cycles > deadline_cycles) {
+        dl->overruns++;
+        dl->window_overruns++;
+        if (tick_cycles >= dl->worst_overrun_cycles) {
+            dl->worst_overrun_cycles = tick_cycles;
+            dl->worst_task = longest_task;
+            dl->worst_task_cycles = longest_cycles;
+        }
+    }
+
+    if (cfg->degrade_overruns == 0U) {
+        return;
+    }
+    if (dl->window_overruns >= cfg->degrade_overruns) {
+        dl->degraded = true;
+    }
+    if (++dl->window_ticks >= cfg->degrade_window_ticks) {
+        dl->window_ticks = 0U;
+        dl->window_overruns = 0U;
     }
+}
 
+/**
+ * @brief   Check that no floating-point field of a configuration is NaN or infinite, which every range check passes
+ */
+static bool _esc_config_is_finite(const EscConfig_t *cfg) {
+    const float values[] = {
+        cfg->limits.max_phase_current_A, cfg->limits.max_temp_C, cfg->limits.vbus_uvlo_V, cfg->limits.vbus_ovlo_V,
+        cfg->limits.max_duty, cfg->limits.max_regen_current_A,
+        cfg->pwm.diode_forward_V,
+        cfg->thermal.ambient_temp_C, cfg->thermal.winding_resistance_Ohm, cfg->thermal.winding_r_th_K_per_W,
+        cfg->thermal.winding_c_th_J_per_K, cfg->thermal.max_winding_temp_C, cfg->thermal.fet_rds_on_Ohm,
+        cfg->thermal.fet_r_th_K_per_W, cfg->thermal.fet_c_th_J_per_K, cfg->thermal.max_fet_temp_C,
+        cfg->thermal.derate_band_C,
+        cfg->battery.max_discharge_current_A, cfg->battery.max_charge_current_A, cfg->battery.max_power_W,
+        cfg->battery.sag_foldback_band_V, cfg->battery.dc_link_capacitance_F,
+        cfg->current_loop.kp, cfg->current_loop.ki,
+        cfg->field_weakening.max_current_A,
+        cfg->motor_config.phase_resistance_Ohm, cfg->motor_config.phase_inductance_H,
+        cfg->motor_config.q_axis_inductance_H, cfg->motor_config.flux_linkage_Wb,
+    };
+    for (size_t i = 0U; i < sizeof(values) / sizeof(values[0]); ++i) {
+        if (!isfinite(values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Take on a configuration and start the control state afresh; the black box and the scope are left alone
+ */
+static bool _esc_configure(Esc_t *esc, HalMotor_t hal_motor, const EscConfig_t *cfg) {
     if (esc_config_is_valid(cfg)) {
         esc->config = *cfg;
     } else {
         return false;
     }
+    esc->hal_motor = hal_motor;
 
     if (esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORED) {
         sensored_init(&esc->config.motor_config);
     }
+    if (esc->config.feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS) {
+        sensorless_init(&esc->config.motor_config);
+    }
+    if (esc->config.commutation_method == ESC_COMMUTATION_METHOD_SINE) {
+        sinusoidal_init(&esc->config.motor_config);
+    }
 
     /* Initialize ESC motor state to zero */
     for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
@@ -256,19 +1168,76 @@ bool esc_init(Esc_t *esc, const EscConfig_t *cfg) {
     esc->motor_state.vbus_V = 0.f;
     esc->motor_state.temperature_C = 0.f;
     esc->motor_state.hall_abc = 0;
-    esc->motor_state.hall_timestamp_us = 0;
+    esc->motor_state.hall_timestamp_ticks = 0;
 
     /* Initialize ESC inverter */
     esc->inverter_cmd.enable = false;
     esc->inverter_cmd.duty = 0.f;
     esc->inverter_cmd.commutation_step = 0;
+    esc->inverter_cmd.brake = false;
+    _esc_update_phase_outputs(esc);
 
     /* Initialize variables */
     esc->throttle_cmd = 0.f;
+    esc->brake_cmd = 0.f;
+    esc->throttle_ramped = 0.f;
     esc->velocity_setpoint_rpm = 0.f;
     esc->torque_setpoint_A = 0.f;
     esc->velocity_mech_rpm = 0.f;
     esc->fault_flags = ESC_FAULT_NONE;
+
+    /* Initialize Hall sequence tracking */
+    esc->rotor_direction = 0;
+    esc->hall_prev = HALL_INVALID;
+    esc->hall_prev_timestamp_ticks = 0U;
+    esc->hall_elapsed_us = 0U;
+    esc->elec_angle = 0U;
+    esc->sine_lead = 0.f;
+    esc->field_weakening_current_A = 0.f;
+    esc->advance_current_A = 0.f;
+    _esc_init_mtpa(esc);
+    sensorless_reset(esc);
+
+    /* Initialize direction and current control */
+    esc->direction_state = ESC_DIRECTION_STATE_FORWARD;
+    esc->drive_current_A = 0.f;
+    esc->quadrature_current_A = 0.f;
+    esc->phase_current_max_A = 0.f;
+    esc->bemf_duty_per_rpm = 0.f;
+    _esc_init_current_loops(esc);
+    esc->dynamic_braking = false;
+
+    /* Initialize motor identification */
+    motor_id_reset(esc);
+
+    /* Initialize thermal model, with the windings at the sensor and the inverter at ambient */
+    esc->current_sq_sum_A2 = 0.f;
+    esc->current_sq_samples = 0U;
+    thermal_node_init(&esc->winding_thermal, esc->config.thermal.winding_r_th_K_per_W,
+                      esc->config.thermal.winding_c_th_J_per_K);
+    thermal_node_init(&esc->fet_thermal, esc->config.thermal.fet_r_th_K_per_W, esc->config.thermal.fet_c_th_J_per_K);
+    esc->winding_temp_C = 0.f;
+    esc->fet_temp_C = esc->config.thermal.ambient_temp_C;
+    esc->thermal_derate = 1.f;
+
+    /* Initialize battery limiting, open until the first estimate */
+    esc->dc_current_sum_A = 0.f;
+    esc->dc_duty_sum = 0.f;
+    esc->dc_samples = 0U;
+    esc->dc_current_A = 0.f;
+    esc->input_power_W = 0.f;
+    esc->battery_drive_limit_A = esc->config.limits.max_phase_current_A;
+    esc->battery_charge_limit_A = esc->config.limits.max_phase_current_A;
+    esc->vbus_filtered_V = 0.f;
+
+    /* Initialize stall detection */
+    esc->stall_time_us = 0U;
+    esc->stall_cutback = false;
+
+    /* Initialize scheduler and telemetry */
+    _esc_sched_reset(esc);
+    esc->telemetry = (EscTelemetry_t){0};
+    esc->deadline = (EscDeadlineStats_t){0};
     
     /* Is initialized, return */
     esc->is_initialized = true;
@@ -276,12 +1245,175 @@ bool esc_init(Esc_t *esc, const EscConfig_t *cfg) {
     return true;
 }
 
+/*******************************************************************************************************************************
+ * Public Function Definitions
+ *******************************************************************************************************************************/
+void esc_step(Esc_t *esc, uint32_t dt_us)
+{
+    if (esc == NULL){
+        return; //null pntr check
+    }
+
+    if (!esc->is_initialized){
+        
+        return; 
+    }
+
+    if (dt_us == 0U){
+        return;
+    }
+
+#if ESC_SCHED_BUDGET_CHECKS
+    /* One timestamp per task boundary: each read ends one task and starts the next */
+    const uint32_t entry = hal_time_get_cycles();
+    uint32_t prev = entry;
+    EscTask_t longest_task = ESC_TASK_FAST;
+    uint32_t longest_cycles = 0U;
+#endif
+
+    for (int i = 0; i < NUM_ESC_TASKS; ++i) {
+        const EscTaskDesc_t *desc = &esc_tasks[i];
+        EscTaskState_t *task = &esc->tasks[i];
+
+        task->elapsed_us += dt_us;
+        if (task->countdown > 0U) {
+            task->countdown--;
+            continue;
+        }
+        task->countdown = desc->divider - 1U;
+
+        if (desc->sheddable && esc->deadline.degraded) {
+            task->elapsed_us = 0U;
+            continue;
+        }
+
+        desc->run(esc, task->elapsed_us);
+#if ESC_SCHED_BUDGET_CHECKS
+        const uint32_t now = hal_time_get_cycles();
+        const uint32_t cycles = hal_time_elapsed_ticks32(now, prev);
+        prev = now;
+        if (cycles > longest_cycles) {
+            longest_cycles = cycles;
+            longest_task = (EscTask_t)i;
+        }
+        task->last_cycles = cycles;
+        if (cycles > task->max_cycles) {
+            task->max_cycles = cycles;
+        }
+        if (cycles > desc->budget_cycles) {
+            task->budget_overruns++;
+        }
+#endif
+        task->runs++;
+        task->elapsed_us = 0U;
+    }
+
+#if ESC_SCHED_BUDGET_CHECKS
+    _esc_update_deadline(esc, dt_us, hal_time_elapsed_ticks32(prev, entry), longest_task, longest_cycles);
+#endif
+}
+
+void esc_set_throttle(Esc_t *esc, const float throttle_cmd) {
+    /* Validate esc input */
+    if (esc == NULL || esc->is_initialized == false) {
+        return;
+    }
+    /* Clamp throttle command to valid range [THROTTLE_CMD_MIN, THROTTLE_CMD_MAX] */
+    if (throttle_cmd > THROTTLE_CMD_MAX) {
+        esc->throttle_cmd = THROTTLE_CMD_MAX;
+    } else if (throttle_cmd < THROTTLE_CMD_MIN) {
+        esc->throttle_cmd = THROTTLE_CMD_MIN;
+    } else {
+        esc->throttle_cmd = throttle_cmd;
+    }
+}
+
+void esc_set_brake(Esc_t *esc, const float brake_cmd) {
+    /* Validate esc input */
+    if (esc == NULL || esc->is_initialized == false) {
+        return;
+    }
+    /* Clamp brake command to valid range [BRAKE_CMD_MIN, BRAKE_CMD_MAX] */
+    if (brake_cmd > BRAKE_CMD_MAX) {
+        esc->brake_cmd = BRAKE_CMD_MAX;
+    } else if (brake_cmd < BRAKE_CMD_MIN) {
+        esc->brake_cmd = BRAKE_CMD_MIN;
+    } else {
+        esc->brake_cmd = brake_cmd;
+    }
+}
+
+void esc_set_motor_state(Esc_t *esc, const MotorState_t *state) {
+    /* Validate esc input */
+    if (esc == NULL || esc->is_initialized == false || state == NULL) {
+        return;
+    }
+    esc->motor_state = *state;
+}
+
+bool esc_start_motor_id(Esc_t *esc) {
+    /* Validate esc input */
+    if (esc == NULL || esc->is_initialized == false) {
+        return false;
+    }
+    return motor_id_start(esc);
+}
+
+
+bool esc_init(Esc_t *esc, HalMotor_t hal_motor, const EscConfig_t *cfg) {
+    if (esc == NULL || cfg == NULL || hal_motor >= NUM_HAL_MOTORS) {
+        return false;
+    }
+    if (!_esc_configure(esc, hal_motor, cfg)) {
+        return false;
+    }
+
+    /* Initialize the fault black box, armed, and the software oscilloscope, idle */
+    blackbox_reset(esc);
+    scope_reset(esc);
+    return true;
+}
+
+bool esc_reconfigure(Esc_t *esc, const EscConfig_t *cfg) {
+    if (esc == NULL || cfg == NULL || esc->is_initialized == false) {
+        return false;
+    }
+    return _esc_configure(esc, esc->hal_motor, cfg);
+}
+
 void esc_reset(Esc_t *esc) {
     /* Resetting internal state during runtime variables */
     esc->throttle_cmd = 0.f;
+    esc->brake_cmd = 0.f;
+    esc->throttle_ramped = 0.f;
     esc->velocity_setpoint_rpm = 0.f;
     esc->torque_setpoint_A = 0.f;
     esc->velocity_mech_rpm = 0.f;
+    esc->rotor_direction = 0;
+    esc->hall_prev = HALL_INVALID;
+    esc->hall_elapsed_us = 0U;
+    esc->sine_lead = 0.f;
+    esc->field_weakening_current_A = 0.f;
+    esc->advance_current_A = 0.f;
+    sensorless_reset(esc);
+    /* A reset aborts a running identification; finished results are already in the configuration */
+    if (motor_id_is_running(esc)) {
+        motor_id_reset(esc);
+        esc->inverter_cmd.enable = false;
+    }
+    esc->direction_state = ESC_DIRECTION_STATE_FORWARD;
+    esc->drive_current_A = 0.f;
+    esc->quadrature_current_A = 0.f;
+    pid_reset(&esc->current_pid, 1.f);
+    pid_reset(&esc->regen_floor_pid, 0.f);
+    esc->dynamic_braking = false;
+    esc->stall_time_us = 0U;
+    esc->stall_cutback = false;
+
+    /* Leave degraded mode with a fresh degrade window, the statistics are kept */
+    esc->deadline.degraded = false;
+    esc->deadline.window_ticks = 0U;
+    esc->deadline.window_overruns = 0U;
 
     /* Set faults to zero */
     esc->fault_flags = ESC_FAULT_NONE;
@@ -295,28 +1427,88 @@ bool esc_config_is_valid(const EscConfig_t *cfg) {
 
     /* Checking EscControlMode_t enum invalidity*/
     if (cfg->control_mode < 0 || 
-        cfg->control_mode > NUM_ESC_CONTROL_MODES) {
+        cfg->control_mode >= NUM_ESC_CONTROL_MODES) {
             return false;
     }
 
     /* Checking EscCommutationMethod_t enum invalidity */
     if (cfg->commutation_method < 0 ||
-        cfg->commutation_method > NUM_ESC_COMMUTATION_METHODS) {
+        cfg->commutation_method >= NUM_ESC_COMMUTATION_METHODS) {
             return false; 
     }
 
     /* Checking EscFeedbackMechanism_t enum invalidity */
     if (cfg->feedback_mechanism < 0 ||
-        cfg->feedback_mechanism > NUM_ESC_FEEDBACK_MECHANISMS) {
+        cfg->feedback_mechanism >= NUM_ESC_FEEDBACK_MECHANISMS) {
+            return false;
+    }
+
+    /* NaN fails every comparison below, so it would pass them all */
+    if (!_esc_config_is_finite(cfg)) {
+        return false;
+    }
+
+    /* Sensorless feedback needs sinusoidal drive and the motor parameters of its observer */
+    if (cfg->feedback_mechanism == ESC_FEEDBACK_MECHANISM_SENSORLESS &&
+        (cfg->commutation_method != ESC_COMMUTATION_METHOD_SINE || !sensorless_init(&cfg->motor_config))) {
             return false;
     }
 
     /* Checking EscLimits_t invalidity */
-    if (cfg->limits.max_phase_current_A > MAX_PHASE_CURRENT || 
+    if (cfg->limits.max_phase_current_A <= 0.0f ||
+        cfg->limits.max_phase_current_A > MAX_PHASE_CURRENT || 
         cfg->limits.max_temp_C > OVERTEMP_THRESHOLD ||
         cfg->limits.vbus_uvlo_V < UNDERVOLT_LOCKOUT ||
         cfg->limits.vbus_ovlo_V > OVERVOLT_LOCKOUT ||
-        cfg->limits.max_duty > MAX_PWM_DUTY) {
+        cfg->limits.max_duty > MAX_PWM_DUTY ||
+        cfg->limits.max_regen_current_A < 0.0f ||
+        cfg->limits.max_regen_current_A > cfg->limits.max_phase_current_A) {
+            return false;
+    }
+
+    /* Checking EscPwmConfig_t invalidity */
+    if (cfg->pwm.dead_time_ns > MAX_DEAD_TIME_NS || cfg->pwm.diode_forward_V < 0.0f) {
+            return false;
+    }
+
+    /* Checking EscThermalConfig_t invalidity, an enabled model needs a time constant and a limit */
+    if (cfg->thermal.winding_resistance_Ohm < 0.0f || cfg->thermal.fet_rds_on_Ohm < 0.0f ||
+        cfg->thermal.derate_band_C < 0.0f) {
+            return false;
+    }
+    if (cfg->thermal.winding_resistance_Ohm > 0.0f &&
+        (cfg->thermal.winding_r_th_K_per_W <= 0.0f || cfg->thermal.winding_c_th_J_per_K <= 0.0f ||
+         cfg->thermal.max_winding_temp_C <= 0.0f)) {
+            return false;
+    }
+    if (cfg->thermal.fet_rds_on_Ohm > 0.0f &&
+        (cfg->thermal.fet_r_th_K_per_W <= 0.0f || cfg->thermal.fet_c_th_J_per_K <= 0.0f ||
+         cfg->thermal.max_fet_temp_C <= 0.0f)) {
+            return false;
+    }
+
+    /* Checking EscBatteryConfig_t invalidity */
+    if (cfg->battery.max_discharge_current_A < 0.0f || cfg->battery.max_charge_current_A < 0.0f ||
+        cfg->battery.max_power_W < 0.0f || cfg->battery.sag_foldback_band_V < 0.0f ||
+        cfg->battery.dc_link_capacitance_F < 0.0f) {
+            return false;
+    }
+
+    /* Checking EscFieldWeakeningConfig_t and saliency invalidity */
+    if (cfg->field_weakening.max_current_A < 0.0f ||
+        cfg->field_weakening.max_current_A > cfg->limits.max_phase_current_A ||
+        cfg->motor_config.q_axis_inductance_H < 0.0f) {
+            return false;
+    }
+
+    /* Checking EscCurrentLoopConfig_t invalidity */
+    if (cfg->current_loop.kp < 0.0f || cfg->current_loop.ki < 0.0f) {
+            return false;
+    }
+
+    /* Checking EscDeadlineConfig_t invalidity */
+    if (cfg->deadline.degrade_overruns > 0U &&
+        cfg->deadline.degrade_window_ticks < cfg->deadline.degrade_overruns) {
             return false;
     }
 
@@ -339,9 +1531,33 @@ bool esc_is_faulted(const Esc_t *esc) {
     return (esc->fault_flags != ESC_FAULT_NONE);
 }
 
+EscTelemetry_t esc_get_telemetry(const Esc_t *esc) {
+    if (esc == NULL || esc->is_initialized == false){
+        EscTelemetry_t invalid_telemetry = {0};
+        return invalid_telemetry;
+    }
+    return esc->telemetry;
+}
+
 EscFault_t esc_get_fault_flags(const Esc_t *esc) {
     if (esc == NULL || esc->is_initialized == false){
         return ESC_FAULT_NONE;
     }
     return (EscFault_t)esc->fault_flags;
-}
\ No newline at end of file
+}
+
+EscDeadlineStats_t esc_get_deadline_stats(const Esc_t *esc) {
+    if (esc == NULL || esc->is_initialized == false){
+        EscDeadlineStats_t invalid_stats = {0};
+        return invalid_stats;
+    }
+    return esc->deadline;
+}
+
+EscMotorId_t esc_get_motor_id(const Esc_t *esc) {
+    if (esc == NULL || esc->is_initialized == false){
+        EscMotorId_t invalid_id = {0};
+        return invalid_id;
+    }
+    return esc->motor_id;
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************************************************************
+ * @file   esc_group.c
+ *
+ * @brief  Source file for the multi-motor ESC scheduler
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "adc.h"
+#include "gpio.h"
+#include "hal_time.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "esc_group.h"
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static void _esc_group_read_motor_state(HalMotor_t motor, MotorState_t *state)
+{
+    /* A failed read keeps the previous sample */
+    (void)hal_adc_get_phase_currents(motor, state->phase_currents_A);
+    (void)hal_adc_get_bus_voltage(motor, &state->vbus_V);
+    (void)hal_adc_get_temperature(motor, &state->temperature_C);
+    state->hall_abc = hal_gpio_get_hall_state(motor);
+    state->hall_timestamp_ticks = hal_gpio_get_hall_timestamp_ticks(motor);
+}
+
+/*******************************************************************************************************************************
+ * Public Function Definitions
+ *******************************************************************************************************************************/
+
+void esc_group_init(EscGroup_t *group)
+{
+    for (uint8_t m = 0U; m < NUM_HAL_MOTORS; ++m) {
+        group->escs[m] = NULL;
+        group->last_cycles[m] = 0U;
+        group->max_cycles[m] = 0U;
+    }
+    group->next = 0U;
+}
+
+bool esc_group_add(EscGroup_t *group, Esc_t *esc)
+{
+    if (esc->hal_motor >= NUM_HAL_MOTORS || group->escs[esc->hal_motor] != NULL) {
+        return false;
+    }
+    group->escs[esc->hal_motor] = esc;
+    return true;
+}
+
+HalMotor_t esc_group_tick(EscGroup_t *group)
+{
+    const HalMotor_t motor = (HalMotor_t)group->next;
+    group->next = (uint8_t)((group->next + 1U) % NUM_HAL_MOTORS);
+
+    Esc_t *esc = group->escs[motor];
+    if (esc == NULL) {
+        return motor;
+    }
+
+    const uint32_t start = hal_time_get_cycles();
+    MotorState_t state = esc->motor_state;
+    _esc_group_read_motor_state(motor, &state);
+    esc_set_motor_state(esc, &state);
+    esc_step(esc, HAL_PWM_PERIOD_US);
+    const EscInverterCmd_t cmd = esc_get_inverter_cmd(esc);
+    hal_pwm_apply_inverter_cmd(motor, &cmd);
+
+    group->last_cycles[motor] = hal_time_elapsed_ticks32(hal_time_get_cycles(), start);
+    if (group->last_cycles[motor] > group->max_cycles[motor]) {
+        group->max_cycles[motor] = group->last_cycles[motor];
+    }
+    return motor;
+}
@@ -1,7 +1,447 @@
+/*******************************************************************************************************************************
+ * @file   main.c
+ *
+ * @brief  Source file for the host executable entry point
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "histogram.h"
+#include "host_check.h"
+#include "host_cosim.h"
+#include "host_drive_cycle.h"
+#include "host_input_bench.h"
+#include "host_link.h"
+#include "host_motor_id.h"
+#include "host_multi.h"
+#include "host_params.h"
+#include "host_rt_runner.h"
+#include "host_scope.h"
+#include "host_trig_bench.h"
+
+/* Intra-component Headers */
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static void _main_print_usage(const char *prog)
+{
+    printf("usage: %s rt [-r rate_hz] [-d duration_ms] [-c cpu] [-p priority] [-t throttle] [-f trace.csv]\n"
+           "          [-b blackbox.csv]\n", prog);
+    printf("       %s cosim [-n shm_name] [-d duration_ms] [-t throttle]\n", prog);
+    printf("       %s cosim-plant|cosim-echo [-n shm_name]\n", prog);
+    printf("       %s trig-bench [-n passes]\n", prog);
+    printf("       %s motor-id [-s]\n", prog);
+    printf("       %s input-bench [-n frames]\n", prog);
+    printf("       %s link [-d duration_ms]\n", prog);
+    printf("       %s params [-f flash.bin]\n", prog);
+    printf("       %s multi [-d duration_ms] [-t throttle]\n", prog);
+    printf("       %s drive-cycle [-c cycle] [-o summary.csv] [-b baseline.csv]\n", prog);
+    printf("       %s check [-c check]\n", prog);
+    printf("       %s scope [-s ia,ib,...] [-g trigger_signal] [-e none|rising|falling|either] [-l level]\n"
+           "          [-n decimation] [-p pre_frames] [-t throttle] [-d duration_ms] [-o scope.csv]\n", prog);
+}
+
+static int _main_run_rt(int argc, char **argv)
+{
+    HostRtRunnerConfig_t cfg;
+    host_rt_runner_default_config(&cfg);
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2U) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        const char *value = argv[++i];
+        switch (argv[i - 1][1]) {
+            case 'r':
+                cfg.rate_hz = (uint32_t)strtoul(value, NULL, 10);
+                break;
+            case 'd':
+                cfg.duration_ms = (uint32_t)strtoul(value, NULL, 10);
+                break;
+            case 'c':
+                cfg.cpu = atoi(value);
+                break;
+            case 'p':
+                cfg.priority = atoi(value);
+                break;
+            case 't':
+                cfg.throttle = strtof(value, NULL);
+                break;
+            case 'f':
+                cfg.trace_path = value;
+                break;
+            case 'b':
+                cfg.blackbox_path = value;
+                break;
+            default:
+                _main_print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    HostRtRunnerStats_t *stats = malloc(sizeof(*stats));
+    if (stats == NULL) {
+        return 1;
+    }
+    const bool ok = host_rt_runner_run(&cfg, stats);
+    if (ok) {
+        host_rt_runner_print_stats(&cfg, stats);
+    }
+    free(stats);
+    return ok ? 0 : 1;
+}
+
+static int _main_run_cosim(int argc, char **argv)
+{
+    const char *name = HOST_COSIM_DEFAULT_NAME;
+    uint32_t duration_ms = 1000U;
+    float throttle = 0.3f;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2U) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        const char *value = argv[++i];
+        switch (argv[i - 1][1]) {
+            case 'n':
+                name = value;
+                break;
+            case 'd':
+                duration_ms = (uint32_t)strtoul(value, NULL, 10);
+                break;
+            case 't':
+                throttle = strtof(value, NULL);
+                break;
+            default:
+                _main_print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    /* Plant side: serve until the controller closes the link */
+    if (strcmp(argv[1], "cosim") != 0) {
+        const int64_t steps = host_cosim_run_plant(name, strcmp(argv[1], "cosim-echo") == 0);
+        if (steps < 0) {
+            fprintf(stderr, "cosim: cannot attach to %s\n", name);
+            return 1;
+        }
+        printf("cosim: served %lld steps\n", (long long)steps);
+        return 0;
+    }
+
+    Histogram_t *round_trip_ns = malloc(sizeof(*round_trip_ns));
+    if (round_trip_ns == NULL) {
+        return 1;
+    }
+    const uint32_t dt_us = 1000000U / HOST_RT_RUNNER_DEFAULT_RATE_HZ;
+    const bool ok = host_cosim_run_controller(name, duration_ms * 1000U, dt_us, throttle, round_trip_ns);
+    printf("cosim: %s after %llu steps of %u us\n", ok ? "done" : "link failed", (unsigned long long)round_trip_ns->total,
+           (unsigned)dt_us);
+    printf("cosim: round trip (ns) min %u p50 %u p99 %u p99.9 %u max %u\n",
+           (unsigned)(round_trip_ns->total ? round_trip_ns->min : 0U), (unsigned)histogram_percentile(round_trip_ns, 50.0f),
+           (unsigned)histogram_percentile(round_trip_ns, 99.0f), (unsigned)histogram_percentile(round_trip_ns, 99.9f),
+           (unsigned)round_trip_ns->max);
+    free(round_trip_ns);
+    return ok ? 0 : 1;
+}
+
+static int _main_run_trig_bench(int argc, char **argv)
+{
+    uint32_t passes = HOST_TRIG_BENCH_DEFAULT_PASSES;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || strcmp(argv[i], "-n") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        passes = (uint32_t)strtoul(argv[++i], NULL, 10);
+    }
+
+    const uint32_t failures = host_trig_bench_run(passes);
+    if (failures > 0U) {
+        printf("trig-bench: %u kernels outside their error bounds\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_input_bench(int argc, char **argv)
+{
+    uint32_t frames = HOST_INPUT_BENCH_DEFAULT_FRAMES;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || strcmp(argv[i], "-n") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+    }
+
+    const uint32_t failures = host_input_bench_run(frames);
+    if (failures > 0U) {
+        printf("input-bench: %u decoders failed\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_motor_id(int argc, char **argv)
+{
+    bool sinusoidal_bemf = false;
+
+    for (int i = 2; i < argc; ++i) {
+        if (strcmp(argv[i], "-s") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        sinusoidal_bemf = true;
+    }
+
+    const uint32_t failures = host_motor_id_run(sinusoidal_bemf);
+    if (failures > 0U) {
+        printf("motor-id: %u parameters outside %.0f%%\n", (unsigned)failures, 100.0 * HOST_MOTOR_ID_TOLERANCE);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_link(int argc, char **argv)
+{
+    uint32_t duration_ms = HOST_LINK_DEFAULT_DURATION_MS;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || strcmp(argv[i], "-d") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        duration_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+    }
+
+    const uint32_t failures = host_link_run(duration_ms);
+    if (failures > 0U) {
+        printf("link: %u checks failed\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_params(int argc, char **argv)
+{
+    const char *path = HOST_PARAMS_DEFAULT_PATH;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || strcmp(argv[i], "-f") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        path = argv[++i];
+    }
+
+    const uint32_t failures = host_params_run(path);
+    if (failures > 0U) {
+        printf("params: %u checks failed\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_multi(int argc, char **argv)
+{
+    uint32_t duration_ms = HOST_MULTI_DEFAULT_DURATION_MS;
+    float throttle = HOST_MULTI_DEFAULT_THROTTLE;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2U) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        const char *value = argv[++i];
+        switch (argv[i - 1][1]) {
+            case 'd':
+                duration_ms = (uint32_t)strtoul(value, NULL, 10);
+                break;
+            case 't':
+                throttle = strtof(value, NULL);
+                break;
+            default:
+                _main_print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    const uint32_t failures = host_multi_run(duration_ms, throttle);
+    if (failures > 0U) {
+        printf("multi: %u checks failed\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_drive_cycle(int argc, char **argv)
+{
+    HostDriveCycleConfig_t cfg = { NULL, NULL, NULL };
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2U) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        const char *value = argv[++i];
+        switch (argv[i - 1][1]) {
+            case 'c':
+                cfg.cycle = value;
+                break;
+            case 'o':
+                cfg.path = value;
+                break;
+            case 'b':
+                cfg.baseline_path = value;
+                break;
+            default:
+                _main_print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    const uint32_t failures = host_drive_cycle_run(&cfg);
+    return (failures == 0U) ? 0 : 1;
+}
+
+static int _main_run_check(int argc, char **argv)
+{
+    const char *name = NULL;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || strcmp(argv[i], "-c") != 0) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        name = argv[++i];
+    }
+
+    const uint32_t failures = host_check_run(name);
+    if (failures > 0U) {
+        printf("check: %u checks failed\n", (unsigned)failures);
+    }
+    return (failures == 0U) ? 0 : 1;
+}
+
+static bool _main_parse_scope_signals(char *list, EscScopeConfig_t *cfg)
+{
+    cfg->num_channels = 0U;
+    for (char *name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+        if (cfg->num_channels >= SCOPE_MAX_CHANNELS ||
+            !host_scope_parse_signal(name, &cfg->channels[cfg->num_channels])) {
+            return false;
+        }
+        cfg->num_channels++;
+    }
+    return cfg->num_channels > 0U;
+}
+
+static int _main_run_scope(int argc, char **argv)
+{
+    HostScopeConfig_t cfg;
+    host_scope_default_config(&cfg);
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2U) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+        char *value = argv[++i];
+        bool ok = true;
+        switch (argv[i - 1][1]) {
+            case 's':
+                ok = _main_parse_scope_signals(value, &cfg.scope);
+                break;
+            case 'g':
+                ok = host_scope_parse_signal(value, &cfg.scope.trigger_signal);
+                break;
+            case 'e':
+                ok = host_scope_parse_trigger(value, &cfg.scope.trigger);
+                break;
+            case 'l':
+                cfg.scope.trigger_level = strtof(value, NULL);
+                break;
+            case 'n':
+                cfg.scope.decimation = (uint16_t)strtoul(value, NULL, 10);
+                break;
+            case 'p':
+                cfg.scope.pre_trigger_frames = (uint16_t)strtoul(value, NULL, 10);
+                break;
+            case 't':
+                cfg.throttle = strtof(value, NULL);
+                break;
+            case 'd':
+                cfg.duration_ms = (uint32_t)strtoul(value, NULL, 10);
+                break;
+            case 'o':
+                cfg.path = value;
+                break;
+            default:
+                ok = false;
+                break;
+        }
+        if (!ok) {
+            _main_print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    return host_scope_run(&cfg) ? 0 : 1;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "rt") == 0) {
+        return _main_run_rt(argc, argv);
+    }
+    if (argc >= 2 && (strcmp(argv[1], "cosim") == 0 || strcmp(argv[1], "cosim-plant") == 0 ||
+                      strcmp(argv[1], "cosim-echo") == 0)) {
+        return _main_run_cosim(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "trig-bench") == 0) {
+        return _main_run_trig_bench(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "input-bench") == 0) {
+        return _main_run_input_bench(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "motor-id") == 0) {
+        return _main_run_motor_id(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "link") == 0) {
+        return _main_run_link(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "params") == 0) {
+        return _main_run_params(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "multi") == 0) {
+        return _main_run_multi(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "drive-cycle") == 0) {
+        return _main_run_drive_cycle(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "check") == 0) {
+        return _main_run_check(argc, argv);
+    }
+    if (argc >= 2 && strcmp(argv[1], "scope") == 0) {
+        return _main_run_scope(argc, argv);
+    }
+    if (argc >= 2) {
+        _main_print_usage(argv[0]);
+        return 1;
+    }
 
-int main() {
     printf("Hello Electrium!");
 
     return 0;
-}
\ No newline at end of file
+}
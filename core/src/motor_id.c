@@ -0,0 +1,463 @@
+/*******************************************************************************************************************************
+ * @file   motor_id.c
+ *
+ * @brief  Source file for the motor parameter identification module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "sinusoidal.h"
+#include "trapezoidal.h"
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "motor_id.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define MOTOR_ID_SQRT3 1.7320508f
+#define MOTOR_ID_INV_SQRT3 0.57735027f
+#define MOTOR_ID_TWO_PI 6.28318530718f
+#define MOTOR_ID_RAD_S_PER_RPM (MOTOR_ID_TWO_PI / 60.0f)
+#define MOTOR_ID_TEST_ANGLE ((float)TRIG_ANGLE_QUARTER_TURN) /* Phase A carries the test current, B and C half each */
+#define MOTOR_ID_DECAYED_FRACTION 0.02f /* Pulse current back on the bus below this fraction of max_phase_current_A */
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static float _motor_id_wrap_angle(float angle)
+{
+    while (angle >= TRIG_ANGLE_COUNTS) {
+        angle -= TRIG_ANGLE_COUNTS;
+    }
+    while (angle < 0.0f) {
+        angle += TRIG_ANGLE_COUNTS;
+    }
+    return angle;
+}
+
+static void _motor_id_enter(EscMotorId_t *id, EscMotorIdState_t state)
+{
+    id->state = state;
+    id->state_time_us = 0U;
+    id->current_sum_A = 0.0f;
+    id->vbus_sum_V = 0.0f;
+    id->samples = 0U;
+    id->rest_us = 0U;
+}
+
+/* Sinusoidal duty at the angle for the next period */
+static void _motor_id_drive(Esc_t *esc, float angle, float duty)
+{
+    const uint16_t angle_counts = (uint16_t)(uint32_t)angle;
+    esc->elec_angle = angle_counts;
+    esc->inverter_cmd.enable = true;
+    esc->inverter_cmd.brake = false;
+    esc->inverter_cmd.duty = duty * MAX_PWM_DUTY;
+    esc->inverter_cmd.commutation_step = sinusoidal_angle_to_sector(angle_counts);
+}
+
+/* Windings shorted through the low side for the next period, or the bridge off */
+static void _motor_id_short(Esc_t *esc, bool enable)
+{
+    esc->inverter_cmd.enable = enable;
+    esc->inverter_cmd.brake = true;
+    esc->inverter_cmd.duty = 0.0f;
+}
+
+static void _motor_id_fail(Esc_t *esc, EscMotorIdError_t error)
+{
+    _motor_id_enter(&esc->motor_id, ESC_MOTOR_ID_STATE_FAILED);
+    esc->motor_id.error = error;
+    _motor_id_short(esc, false);
+}
+
+/**
+ * @brief   Flux linkage from the current a short from zero builds up against a back-EMF turning at the speed
+ * @details The winding is a first-order lag of time constant L / R on the rotating back-EMF, so after the pulse the
+ *          current is E / L times |1 - exp(-(R / L + j w) T)| / |R / L + j w|; for a short pulse that is E T / L.
+ */
+static float _motor_id_pulse_flux(const EscMotorId_t *id, float current_A, float speed_rad_s, float pulse_s)
+{
+    const float a = id->resistance_Ohm / id->inductance_H;
+    const float decay = expf(-a * pulse_s);
+    const float gain_sq = (1.0f - 2.0f * decay * cosf(speed_rad_s * pulse_s) + decay * decay) /
+                          (a * a + speed_rad_s * speed_rad_s);
+    const float denominator = trig_sqrt(gain_sq) * fabsf(speed_rad_s);
+    return (denominator > 0.0f) ? id->inductance_H * current_A / denominator : 0.0f;
+}
+
+/**
+ * @brief   Work out the resistance and inductance from the two test points and the step between them
+ * @details The step response is I2 - (I2 - I1) r^n at the n-th sample, with r = exp(-dt / tau), so the window sums
+ *          to N I2 - (I2 - I1) r / (1 - r) once it spans many time constants, which solves for tau exactly.
+ * @return  true if both came out positive
+ */
+static bool _motor_id_solve_winding(EscMotorId_t *id, float high_current_A, float high_vbus_V)
+{
+    const float delta_V = (id->high_duty * high_vbus_V - id->low_duty * id->low_vbus_V) * MOTOR_ID_INV_SQRT3;
+    const float delta_A = high_current_A - id->low_current_A;
+    if (delta_V <= 0.0f || delta_A <= 0.0f || id->step_samples == 0U) {
+        return false;
+    }
+    id->resistance_Ohm = delta_V / delta_A;
+
+    const float q = ((float)id->step_samples * high_current_A - id->step_sum_A) / delta_A;
+    if (q <= 0.0f) {
+        return false;
+    }
+    const float sample_s = (float)id->step_time_us / MICROSECONDS_PER_SECOND / (float)id->step_samples;
+    id->inductance_H = id->resistance_Ohm * sample_s / logf(1.0f + 1.0f / q);
+
+    /* Pole-zero cancellation at the crossover: the loop is an integrator of gain kp vbus / (sqrt(3) L) */
+    const float volts_per_duty = high_vbus_V * MOTOR_ID_INV_SQRT3;
+    id->current_kp = id->inductance_H * MOTOR_ID_CURRENT_BANDWIDTH_RAD_S / volts_per_duty;
+    id->current_ki = id->resistance_Ohm * MOTOR_ID_CURRENT_BANDWIDTH_RAD_S / volts_per_duty;
+    return id->inductance_H > 0.0f;
+}
+
+/**
+ * @brief   Count the Hall edges the rotor crosses behind the open loop
+ */
+static void _motor_id_count_hall(Esc_t *esc)
+{
+    EscMotorId_t *id = &esc->motor_id;
+    if (esc->config.feedback_mechanism != ESC_FEEDBACK_MECHANISM_SENSORED) {
+        return;
+    }
+
+    const uint8_t sector = trapezoidal_hall_to_step(esc->motor_state.hall_abc & 0x07U);
+    if (sector >= 6U || sector == id->hall_prev) {
+        return;
+    }
+    if (id->hall_prev < 6U) {
+        const uint8_t delta = (uint8_t)((sector + 6U - id->hall_prev) % 6U);
+        if (delta == 1U) {
+            id->hall_edges++;
+        } else if (delta == 5U) {
+            id->hall_edges--;
+        }
+    }
+    id->hall_prev = sector;
+}
+
+/**
+ * @brief   Check the Hall edges against the turns of the open loop
+ * @details A rotor following the open loop trails it by less than half a turn, so a count more than one turn's
+ *          edges out of step means a Hall sequence at odds with the phase order, or a rotor that slipped.
+ */
+static bool _motor_id_check_hall(Esc_t *esc)
+{
+    EscMotorId_t *id = &esc->motor_id;
+    if (esc->config.feedback_mechanism != ESC_FEEDBACK_MECHANISM_SENSORED) {
+        id->hall_edges_per_turn = 0.0f;
+        return true;
+    }
+
+    const float turns = id->turned_rad / MOTOR_ID_TWO_PI;
+    id->hall_edges_per_turn = (turns > 0.0f) ? (float)id->hall_edges / turns : 0.0f;
+    return fabsf((float)id->hall_edges - HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION * turns) <=
+           HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION;
+}
+
+/**
+ * @brief   Ramp the test voltage and note where it passes each test current
+ */
+static void _motor_id_update_ramp(Esc_t *esc, float current_A, float dt_s)
+{
+    EscMotorId_t *id = &esc->motor_id;
+    const float max_A = esc->config.limits.max_phase_current_A;
+
+    if (id->low_duty == 0.0f && current_A >= max_A * MOTOR_ID_LOW_CURRENT_FRACTION) {
+        id->low_duty = id->duty;
+    }
+    if (current_A >= max_A * MOTOR_ID_HIGH_CURRENT_FRACTION) {
+        id->high_duty = id->duty;
+        id->duty = id->low_duty;
+        _motor_id_enter(id, ESC_MOTOR_ID_STATE_RESISTANCE);
+    } else {
+        id->duty += MOTOR_ID_RAMP_DUTY_PER_S * dt_s;
+        if (id->duty >= 1.0f) {
+            _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_NO_CURRENT);
+            return;
+        }
+    }
+    _motor_id_drive(esc, MOTOR_ID_TEST_ANGLE, id->duty);
+}
+
+/**
+ * @brief   Hold the lower test voltage, average the current once the rotor rests and step to the upper one
+ * @details The rotor parks a quarter turn ahead of the test vector, where its back-EMF shows as quadrature current
+ *          while it swings about it. A weakly damped rotor can take seconds to come to rest.
+ */
+static void _motor_id_update_resistance(Esc_t *esc, float current_A, float quadrature_A, uint32_t dt_us)
+{
+    EscMotorId_t *id = &esc->motor_id;
+
+    if (fabsf(quadrature_A) > esc->config.limits.max_phase_current_A * MOTOR_ID_REST_CURRENT_FRACTION) {
+        id->rest_us = 0U;
+        id->current_sum_A = 0.0f;
+        id->vbus_sum_V = 0.0f;
+        id->samples = 0U;
+        if (id->state_time_us >= MOTOR_ID_REST_TIMEOUT_US) {
+            _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_NO_REST);
+            return;
+        }
+    } else {
+        id->rest_us += dt_us;
+    }
+    if (id->rest_us > MOTOR_ID_SETTLE_US - MOTOR_ID_AVERAGE_US) {
+        id->current_sum_A += current_A;
+        id->vbus_sum_V += esc->motor_state.vbus_V;
+        id->samples++;
+    }
+    if (id->rest_us >= MOTOR_ID_SETTLE_US) {
+        id->low_current_A = id->current_sum_A / (float)id->samples;
+        id->low_vbus_V = id->vbus_sum_V / (float)id->samples;
+        id->step_sum_A = 0.0f;
+        id->step_samples = 0U;
+        id->step_time_us = 0U;
+        id->duty = id->high_duty;
+        _motor_id_enter(id, ESC_MOTOR_ID_STATE_INDUCTANCE);
+    }
+    _motor_id_drive(esc, MOTOR_ID_TEST_ANGLE, id->duty);
+}
+
+/**
+ * @brief   Sum the step response over its window, then average the current it settles at and solve the winding
+ */
+static void _motor_id_update_inductance(Esc_t *esc, float current_A, uint32_t dt_us)
+{
+    EscMotorId_t *id = &esc->motor_id;
+
+    if (id->state_time_us <= MOTOR_ID_STEP_WINDOW_US) {
+        id->step_sum_A += current_A;
+        id->step_samples++;
+        id->step_time_us += dt_us;
+    } else {
+        id->current_sum_A += current_A;
+        id->vbus_sum_V += esc->motor_state.vbus_V;
+        id->samples++;
+    }
+
+    if (id->state_time_us >= MOTOR_ID_STEP_WINDOW_US + MOTOR_ID_AVERAGE_US) {
+        if (!_motor_id_solve_winding(id, id->current_sum_A / (float)id->samples,
+                                     id->vbus_sum_V / (float)id->samples)) {
+            _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_PARAMETERS);
+            return;
+        }
+        /* The spin starts from the parked rotor, a quarter turn behind it, on the derived gains */
+        pid_init(&id->current_pid, id->current_kp, id->current_ki, 0.0f, 0.0f, 1.0f);
+        pid_reset(&id->current_pid, id->duty);
+        id->angle = MOTOR_ID_TEST_ANGLE;
+        id->speed_rad_s = 0.0f;
+        id->turned_rad = 0.0f;
+        id->hall_edges = 0;
+        id->hall_prev = trapezoidal_hall_to_step(esc->motor_state.hall_abc & 0x07U);
+        _motor_id_enter(id, ESC_MOTOR_ID_STATE_SPIN);
+    }
+    _motor_id_drive(esc, MOTOR_ID_TEST_ANGLE, id->duty);
+}
+
+/**
+ * @brief   Accelerate the current vector open-loop to MOTOR_ID_SPIN_RPM, hold it there, then let the rotor coast
+ */
+static void _motor_id_update_spin(Esc_t *esc, float current_A, float dt_s)
+{
+    EscMotorId_t *id = &esc->motor_id;
+    const float spin_rad_s =
+        MOTOR_ID_SPIN_RPM * MOTOR_ID_RAD_S_PER_RPM * (float)esc->config.motor_config.num_pole_pairs;
+    const float accel_rad_s2 =
+        MOTOR_ID_SPIN_ACCEL_RPM_PER_S * MOTOR_ID_RAD_S_PER_RPM * (float)esc->config.motor_config.num_pole_pairs;
+    const uint32_t ramp_us = (uint32_t)(MOTOR_ID_SPIN_RPM / MOTOR_ID_SPIN_ACCEL_RPM_PER_S * MICROSECONDS_PER_SECOND);
+
+    _motor_id_count_hall(esc);
+    if (id->state_time_us >= ramp_us + MOTOR_ID_SPIN_HOLD_US) {
+        if (!_motor_id_check_hall(esc)) {
+            _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_HALL);
+            return;
+        }
+        id->pulses = 0U;
+        id->pulse_ticks = 0U;
+        id->pulse_length_ticks = 0U;
+        id->pulse_us = 0U;
+        id->gap_us = 0U;
+        id->flux_sum_Wb = 0.0f;
+        id->speed_sum_rad_s = 0.0f;
+        _motor_id_enter(id, ESC_MOTOR_ID_STATE_FLUX);
+        _motor_id_short(esc, false);
+        return;
+    }
+
+    id->duty = pid_update(&id->current_pid,
+                          esc->config.limits.max_phase_current_A * MOTOR_ID_SPIN_CURRENT_FRACTION - current_A, dt_s);
+    id->speed_rad_s += accel_rad_s2 * dt_s;
+    if (id->speed_rad_s > spin_rad_s) {
+        id->speed_rad_s = spin_rad_s;
+    }
+    id->angle = _motor_id_wrap_angle(id->angle + id->speed_rad_s * dt_s * TRIG_ANGLE_COUNTS_PER_RAD);
+    id->turned_rad += id->speed_rad_s * dt_s;
+    _motor_id_drive(esc, id->angle, id->duty);
+}
+
+/**
+ * @brief   Short the coasting rotor in pulses from zero current and take the flux linkage from each pair
+ * @details The first pulse lasts until the current reaches MOTOR_ID_PULSE_CURRENT_FRACTION, or at most
+ *          MOTOR_ID_PULSE_MAX_US, and the others as long, so the angle the winding lag puts between current and
+ *          rotor is the same at every pulse end and drops out of the turn between two of them.
+ */
+static void _motor_id_update_flux(Esc_t *esc, const float i_ab[2], float current_A, uint32_t dt_us)
+{
+    EscMotorId_t *id = &esc->motor_id;
+    const float max_A = esc->config.limits.max_phase_current_A;
+
+    id->gap_us += dt_us;
+    if (!(esc->inverter_cmd.enable && esc->inverter_cmd.brake)) {
+        /* The next pulse starts once the last one's current is back on the bus */
+        id->pulse_ticks = 0U;
+        id->pulse_us = 0U;
+        _motor_id_short(esc, current_A < max_A * MOTOR_ID_DECAYED_FRACTION && id->gap_us >= MOTOR_ID_PULSE_GAP_US);
+        return;
+    }
+
+    id->pulse_ticks++;
+    id->pulse_us += dt_us;
+    if (id->pulse_length_ticks == 0U) {
+        if (current_A < max_A * MOTOR_ID_PULSE_CURRENT_FRACTION && id->pulse_us < MOTOR_ID_PULSE_MAX_US) {
+            return;
+        }
+        if (current_A < max_A * MOTOR_ID_PULSE_MIN_FRACTION) {
+            _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_NO_ROTATION);
+            return;
+        }
+        id->pulse_length_ticks = id->pulse_ticks;
+    } else if (id->pulse_ticks < id->pulse_length_ticks) {
+        return;
+    }
+
+    const uint16_t angle = trig_atan2(i_ab[1], i_ab[0]);
+    if (id->pulses > 0U) {
+        const int16_t turned = (int16_t)(uint16_t)(angle - id->pulse_angle);
+        const float speed_rad_s =
+            (float)turned / TRIG_ANGLE_COUNTS_PER_RAD / ((float)id->gap_us / MICROSECONDS_PER_SECOND);
+        id->flux_sum_Wb += _motor_id_pulse_flux(id, current_A, speed_rad_s,
+                                                (float)id->pulse_us / MICROSECONDS_PER_SECOND);
+        id->speed_sum_rad_s += fabsf(speed_rad_s);
+    }
+    id->pulse_angle = angle;
+    id->gap_us = 0U;
+    _motor_id_short(esc, false);
+    if (++id->pulses < MOTOR_ID_PULSES) {
+        return;
+    }
+
+    /* A rotor that slipped out of the open loop coasts at some other speed */
+    const float pairs = (float)(MOTOR_ID_PULSES - 1U);
+    const float spin_rad_s =
+        MOTOR_ID_SPIN_RPM * MOTOR_ID_RAD_S_PER_RPM * (float)esc->config.motor_config.num_pole_pairs;
+    if (fabsf(id->speed_sum_rad_s / pairs - spin_rad_s) > MOTOR_ID_SPEED_TOLERANCE * spin_rad_s) {
+        _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_NO_ROTATION);
+        return;
+    }
+    id->flux_linkage_Wb = id->flux_sum_Wb / pairs;
+
+    MotorConfig_t *motor = &esc->config.motor_config;
+    motor->phase_resistance_Ohm = id->resistance_Ohm;
+    motor->phase_inductance_H = id->inductance_H;
+    motor->flux_linkage_Wb = id->flux_linkage_Wb;
+    esc->config.current_loop.kp = id->current_kp;
+    esc->config.current_loop.ki = id->current_ki;
+    _motor_id_enter(id, ESC_MOTOR_ID_STATE_DONE);
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void motor_id_reset(Esc_t *esc)
+{
+    if (esc == NULL) {
+        return;
+    }
+
+    esc->motor_id = (EscMotorId_t){ 0 };
+    esc->motor_id.state = ESC_MOTOR_ID_STATE_IDLE;
+    esc->motor_id.error = ESC_MOTOR_ID_ERROR_NONE;
+}
+
+bool motor_id_start(Esc_t *esc)
+{
+    if (esc == NULL || esc->is_initialized == false || esc->fault_flags != ESC_FAULT_NONE ||
+        esc->inverter_cmd.enable || motor_id_is_running(esc)) {
+        return false;
+    }
+
+    motor_id_reset(esc);
+    _motor_id_enter(&esc->motor_id, ESC_MOTOR_ID_STATE_RAMP);
+    esc->direction_state = ESC_DIRECTION_STATE_FORWARD;
+    esc->sine_lead = 0.0f;
+    return true;
+}
+
+void motor_id_update(Esc_t *esc, uint32_t dt_us)
+{
+    if (esc == NULL || !motor_id_is_running(esc)) {
+        return;
+    }
+
+    EscMotorId_t *id = &esc->motor_id;
+    if (esc->fault_flags != ESC_FAULT_NONE) {
+        _motor_id_fail(esc, ESC_MOTOR_ID_ERROR_FAULT);
+        return;
+    }
+    if (id->state_time_us < UINT32_MAX - dt_us) {
+        id->state_time_us += dt_us;
+    }
+
+    /* Current along the test vector, and the magnitude of the current vector */
+    const float *i_abc = esc->motor_state.phase_currents_A;
+    const float i_ab[2] = { i_abc[MOTOR_PHASE_A], MOTOR_ID_INV_SQRT3 * (i_abc[MOTOR_PHASE_B] - i_abc[MOTOR_PHASE_C]) };
+    const float magnitude_A = trig_sqrt(i_ab[0] * i_ab[0] + i_ab[1] * i_ab[1]);
+    float in_phase_A;
+    float quadrature_A;
+    sinusoidal_project_currents((uint16_t)(uint32_t)MOTOR_ID_TEST_ANGLE, i_abc, &in_phase_A, &quadrature_A);
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+
+    switch (id->state) {
+        case ESC_MOTOR_ID_STATE_RAMP:
+            _motor_id_update_ramp(esc, in_phase_A, dt_s);
+            break;
+
+        case ESC_MOTOR_ID_STATE_RESISTANCE:
+            _motor_id_update_resistance(esc, in_phase_A, quadrature_A, dt_us);
+            break;
+
+        case ESC_MOTOR_ID_STATE_INDUCTANCE:
+            _motor_id_update_inductance(esc, in_phase_A, dt_us);
+            break;
+
+        case ESC_MOTOR_ID_STATE_SPIN:
+            _motor_id_update_spin(esc, magnitude_A, dt_s);
+            break;
+
+        case ESC_MOTOR_ID_STATE_FLUX:
+        default:
+            _motor_id_update_flux(esc, i_ab, magnitude_A, dt_us);
+            break;
+    }
+}
+
+bool motor_id_is_running(const Esc_t *esc)
+{
+    return esc->motor_id.state != ESC_MOTOR_ID_STATE_IDLE && esc->motor_id.state != ESC_MOTOR_ID_STATE_DONE &&
+           esc->motor_id.state != ESC_MOTOR_ID_STATE_FAILED;
+}
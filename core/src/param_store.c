@@ -0,0 +1,278 @@
+/*******************************************************************************************************************************
+ * @file   param_store.c
+ *
+ * @brief  Source file for the parameter store
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "crc.h"
+#include "flash.h"
+
+/* Intra-component Headers */
+#include "param_store.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define PARAM_STORE_ERASED_KEY 0xFFFFU
+#define PARAM_STORE_ALIGN(len) ((((uint32_t)(len)) + HAL_FLASH_WRITE_SIZE - 1U) & ~(HAL_FLASH_WRITE_SIZE - 1U))
+#define PARAM_STORE_RECORD_SIZE(len) ((uint32_t)sizeof(ParamStoreRecordHeader_t) + PARAM_STORE_ALIGN(len))
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint32_t _param_store_sector_base(uint32_t sector)
+{
+    return sector * HAL_FLASH_SECTOR_SIZE;
+}
+
+static uint16_t _param_store_sector_crc(const ParamStoreSectorHeader_t *header)
+{
+    return crc16_update(CRC16_INIT, header, offsetof(ParamStoreSectorHeader_t, crc));
+}
+
+static uint16_t _param_store_record_crc(const ParamStoreRecordHeader_t *header, const void *data)
+{
+    const uint16_t crc = crc16_update(CRC16_INIT, header, offsetof(ParamStoreRecordHeader_t, crc));
+    return crc16_update(crc, data, header->len);
+}
+
+static bool _param_store_is_blank(const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; ++i) {
+        if (data[i] != HAL_FLASH_ERASED_BYTE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _param_store_sector_is_valid(uint32_t sector, ParamStoreSectorHeader_t *header)
+{
+    memcpy(header, hal_flash_get_region() + _param_store_sector_base(sector), sizeof(*header));
+    return (header->magic == PARAM_STORE_MAGIC) && (header->format_version == PARAM_STORE_FORMAT_VERSION) &&
+           (header->sector_size == HAL_FLASH_SECTOR_SIZE) && (header->max_keys == PARAM_STORE_MAX_KEYS) &&
+           (header->crc == _param_store_sector_crc(header));
+}
+
+/**
+ * @brief   Index the records of the active sector, stopping at free space or a torn record
+ */
+static void _param_store_scan(ParamStore_t *store)
+{
+    const uint8_t *sector = hal_flash_get_region() + _param_store_sector_base(store->sector);
+    uint32_t offset = sizeof(ParamStoreSectorHeader_t);
+
+    while (offset + sizeof(ParamStoreRecordHeader_t) <= HAL_FLASH_SECTOR_SIZE) {
+        ParamStoreRecordHeader_t header;
+        memcpy(&header, &sector[offset], sizeof(header));
+        if (header.key == PARAM_STORE_ERASED_KEY && _param_store_is_blank(&sector[offset], sizeof(header))) {
+            /* A value whose header never got programmed leaves the space after it unusable */
+            store->sealed = !_param_store_is_blank(&sector[offset], HAL_FLASH_SECTOR_SIZE - offset);
+            break;
+        }
+        if (header.key >= PARAM_STORE_MAX_KEYS || header.len > PARAM_STORE_MAX_VALUE_SIZE ||
+            PARAM_STORE_RECORD_SIZE(header.len) > HAL_FLASH_SECTOR_SIZE - offset ||
+            header.crc != _param_store_record_crc(&header, &sector[offset + sizeof(header)])) {
+            store->sealed = true;
+            break;
+        }
+        store->record_offset[header.key] = (uint16_t)offset;
+        offset += PARAM_STORE_RECORD_SIZE(header.len);
+    }
+    store->write_offset = offset;
+    if (offset + sizeof(ParamStoreRecordHeader_t) > HAL_FLASH_SECTOR_SIZE) {
+        store->sealed = true;
+    }
+}
+
+/**
+ * @brief   Program a record at an offset of a sector: the value first, then the header that makes it valid
+ */
+static bool _param_store_program_record(uint32_t sector, uint32_t offset, uint16_t key, uint16_t version,
+                                        const void *data, uint16_t len)
+{
+    const uint32_t address = _param_store_sector_base(sector) + offset;
+    const uint32_t body = len & ~(HAL_FLASH_WRITE_SIZE - 1U);
+    uint8_t tail[HAL_FLASH_WRITE_SIZE];
+
+    if (body > 0U && !hal_flash_program(address + sizeof(ParamStoreRecordHeader_t), data, body)) {
+        return false;
+    }
+    if (body < len) {
+        memset(tail, HAL_FLASH_ERASED_BYTE, sizeof(tail));
+        memcpy(tail, (const uint8_t *)data + body, len - body);
+        if (!hal_flash_program(address + sizeof(ParamStoreRecordHeader_t) + body, tail, sizeof(tail))) {
+            return false;
+        }
+    }
+
+    ParamStoreRecordHeader_t header = { .key = key, .version = version, .len = len, .crc = 0U };
+    header.crc = _param_store_record_crc(&header, data);
+    return hal_flash_program(address, &header, sizeof(header));
+}
+
+/**
+ * @brief   Write a record into the next sector with the newest records of the other keys, then commit the sector
+ */
+static bool _param_store_compact(ParamStore_t *store, uint16_t key, uint16_t version, const void *data, uint16_t len)
+{
+    const uint8_t *region = hal_flash_get_region();
+    const uint8_t *from = region + _param_store_sector_base(store->sector);
+    const uint32_t target = (store->sector + 1U) % HAL_FLASH_NUM_SECTORS;
+    const uint32_t base = _param_store_sector_base(target);
+
+    uint32_t size = sizeof(ParamStoreSectorHeader_t) + PARAM_STORE_RECORD_SIZE(len);
+    for (uint16_t k = 0U; k < PARAM_STORE_MAX_KEYS; ++k) {
+        if (k != key && store->record_offset[k] != 0U) {
+            ParamStoreRecordHeader_t header;
+            memcpy(&header, &from[store->record_offset[k]], sizeof(header));
+            size += PARAM_STORE_RECORD_SIZE(header.len);
+        }
+    }
+    if (size > HAL_FLASH_SECTOR_SIZE) {
+        return false;
+    }
+
+    if (!_param_store_is_blank(region + base, HAL_FLASH_SECTOR_SIZE) && !hal_flash_erase(target)) {
+        return false;
+    }
+
+    /* Records are position independent, so the newest of each other key is copied as it stands */
+    uint16_t offsets[PARAM_STORE_MAX_KEYS] = { 0U };
+    uint32_t offset = sizeof(ParamStoreSectorHeader_t);
+    for (uint16_t k = 0U; k < PARAM_STORE_MAX_KEYS; ++k) {
+        if (k == key || store->record_offset[k] == 0U) {
+            continue;
+        }
+        ParamStoreRecordHeader_t header;
+        memcpy(&header, &from[store->record_offset[k]], sizeof(header));
+        const uint32_t record_size = PARAM_STORE_RECORD_SIZE(header.len);
+        if (!hal_flash_program(base + offset, &from[store->record_offset[k]], record_size)) {
+            return false;
+        }
+        offsets[k] = (uint16_t)offset;
+        offset += record_size;
+    }
+    if (!_param_store_program_record(target, offset, key, version, data, len)) {
+        return false;
+    }
+    offsets[key] = (uint16_t)offset;
+    offset += PARAM_STORE_RECORD_SIZE(len);
+
+    ParamStoreSectorHeader_t header = {
+        .magic = PARAM_STORE_MAGIC,
+        .generation = store->generation + 1U,
+        .format_version = PARAM_STORE_FORMAT_VERSION,
+        .sector_size = HAL_FLASH_SECTOR_SIZE,
+        .max_keys = PARAM_STORE_MAX_KEYS,
+        .crc = 0U,
+    };
+    header.crc = _param_store_sector_crc(&header);
+    if (!hal_flash_program(base, &header, sizeof(header))) {
+        return false;
+    }
+
+    store->sector = target;
+    store->generation = header.generation;
+    store->write_offset = offset;
+    store->sealed = (offset + sizeof(ParamStoreRecordHeader_t) > HAL_FLASH_SECTOR_SIZE);
+    memcpy(store->record_offset, offsets, sizeof(offsets));
+    return true;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+bool param_store_mount(ParamStore_t *store)
+{
+    memset(store, 0, sizeof(*store));
+    if (hal_flash_get_region() == NULL) {
+        return false;
+    }
+
+    bool found = false;
+    for (uint32_t s = 0U; s < HAL_FLASH_NUM_SECTORS; ++s) {
+        ParamStoreSectorHeader_t header;
+        if (_param_store_sector_is_valid(s, &header) &&
+            (!found || (int32_t)(header.generation - store->generation) > 0)) {
+            found = true;
+            store->sector = s;
+            store->generation = header.generation;
+        }
+    }
+
+    store->mounted = true;
+    if (found) {
+        _param_store_scan(store);
+    } else {
+        /* Empty: the first write compacts into sector 0 as generation 1 */
+        store->sector = HAL_FLASH_NUM_SECTORS - 1U;
+        store->sealed = true;
+    }
+    return true;
+}
+
+bool param_store_read(const ParamStore_t *store, uint16_t key, uint16_t version, void *data, uint16_t len)
+{
+    if (!store->mounted || key >= PARAM_STORE_MAX_KEYS || store->record_offset[key] == 0U) {
+        return false;
+    }
+
+    const uint32_t address = _param_store_sector_base(store->sector) + store->record_offset[key];
+    const uint8_t *record = hal_flash_get_region() + address;
+    ParamStoreRecordHeader_t header;
+    memcpy(&header, record, sizeof(header));
+    if (header.version != version || header.len != len) {
+        return false;
+    }
+    memcpy(data, record + sizeof(header), len);
+    return true;
+}
+
+bool param_store_write(ParamStore_t *store, uint16_t key, uint16_t version, const void *data, uint16_t len)
+{
+    if (!store->mounted || key >= PARAM_STORE_MAX_KEYS || len > PARAM_STORE_MAX_VALUE_SIZE) {
+        return false;
+    }
+
+    if (store->sealed || PARAM_STORE_RECORD_SIZE(len) > HAL_FLASH_SECTOR_SIZE - store->write_offset) {
+        return _param_store_compact(store, key, version, data, len);
+    }
+    if (!_param_store_program_record(store->sector, store->write_offset, key, version, data, len)) {
+        /* Whatever got programmed is torn; leave it behind */
+        store->sealed = true;
+        return false;
+    }
+    store->record_offset[key] = (uint16_t)store->write_offset;
+    store->write_offset += PARAM_STORE_RECORD_SIZE(len);
+    return true;
+}
+
+bool param_store_load_config(const ParamStore_t *store, HalMotor_t motor, EscConfig_t *cfg)
+{
+    EscConfig_t loaded;
+    if (motor >= NUM_HAL_MOTORS ||
+        !param_store_read(store, PARAM_STORE_KEY_ESC_CONFIG + motor, ESC_CONFIG_VERSION, &loaded, sizeof(loaded)) ||
+        !esc_config_is_valid(&loaded)) {
+        return false;
+    }
+    *cfg = loaded;
+    return true;
+}
+
+bool param_store_save_config(ParamStore_t *store, HalMotor_t motor, const EscConfig_t *cfg)
+{
+    return motor < NUM_HAL_MOTORS && esc_config_is_valid(cfg) &&
+           param_store_write(store, PARAM_STORE_KEY_ESC_CONFIG + motor, ESC_CONFIG_VERSION, cfg, sizeof(*cfg));
+}
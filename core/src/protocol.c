@@ -0,0 +1,698 @@
+/*******************************************************************************************************************************
+ * @file   protocol.c
+ *
+ * @brief  Source file for the binary command and telemetry protocol
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "crc.h"
+
+/* Intra-component Headers */
+#include "blackbox.h"
+#include "protocol.h"
+#include "scope.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define PROTOCOL_SCOPE_HEADER_SIZE 10U    /* Status to frame count of a READ_SCOPE reply */
+#define PROTOCOL_BLACKBOX_HEADER_SIZE 11U /* Status to snapshot count of a READ_BLACKBOX reply */
+#define PROTOCOL_MAX_READ_COUNT 255U      /* Frames or snapshots in one reply, a u8 */
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint16_t _protocol_get_u16(const uint8_t *data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static void _protocol_put_u8(ProtocolWriter_t *writer, uint8_t value)
+{
+    protocol_frame_write(writer, &value, 1U);
+}
+
+static void _protocol_put_u16(ProtocolWriter_t *writer, uint16_t value)
+{
+    const uint8_t bytes[2] = { (uint8_t)value, (uint8_t)(value >> 8) };
+    protocol_frame_write(writer, bytes, sizeof(bytes));
+}
+
+/**
+ * @brief   Append fields to a packed struct, moving the cursor past them
+ */
+static void _protocol_pack_u8(uint8_t **out, uint8_t value)
+{
+    *(*out)++ = value;
+}
+
+static void _protocol_pack_u16(uint8_t **out, uint16_t value)
+{
+    _protocol_pack_u8(out, (uint8_t)value);
+    _protocol_pack_u8(out, (uint8_t)(value >> 8));
+}
+
+static void _protocol_pack_u32(uint8_t **out, uint32_t value)
+{
+    _protocol_pack_u16(out, (uint16_t)value);
+    _protocol_pack_u16(out, (uint16_t)(value >> 16));
+}
+
+static void _protocol_pack_f32(uint8_t **out, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    _protocol_pack_u32(out, bits);
+}
+
+/**
+ * @brief   Take fields from a packed struct, moving the cursor past them
+ */
+static uint8_t _protocol_unpack_u8(const uint8_t **data)
+{
+    return *(*data)++;
+}
+
+static uint16_t _protocol_unpack_u16(const uint8_t **data)
+{
+    const uint16_t value = _protocol_get_u16(*data);
+    *data += 2;
+    return value;
+}
+
+static uint32_t _protocol_unpack_u32(const uint8_t **data)
+{
+    const uint32_t low = _protocol_unpack_u16(data);
+    return low | ((uint32_t)_protocol_unpack_u16(data) << 16);
+}
+
+static float _protocol_unpack_f32(const uint8_t **data)
+{
+    const uint32_t bits = _protocol_unpack_u32(data);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief   Check and hand on one frame from a receiver
+ */
+static void _protocol_rx_frame(ProtocolRx_t *rx, uint8_t *buf, size_t len, ProtocolHandler_t handler, void *ctx)
+{
+    /* Back-to-back delimiters are idle fill, not frames */
+    if (len == 0U) {
+        return;
+    }
+    if (len > PROTOCOL_MAX_FRAME) {
+        rx->overflows++;
+        return;
+    }
+
+    ProtocolFrame_t frame;
+    if (!protocol_frame_decode(buf, len, &frame)) {
+        rx->errors++;
+        return;
+    }
+    rx->frames++;
+    handler(ctx, &frame);
+}
+
+/**
+ * @brief   Start a reply in the transmit buffer, with its status
+ */
+static void _protocol_begin_reply(Protocol_t *protocol, ProtocolWriter_t *writer, const ProtocolFrame_t *request,
+                                  ProtocolStatus_t status)
+{
+    protocol_frame_begin(writer, &protocol->tx[protocol->tx_len], sizeof(protocol->tx) - protocol->tx_len,
+                         (uint8_t)(request->type | PROTOCOL_REPLY_FLAG), request->sequence);
+    _protocol_put_u8(writer, (uint8_t)status);
+}
+
+/**
+ * @brief   Close a frame and keep it if it fitted
+ */
+static bool _protocol_queue(Protocol_t *protocol, ProtocolWriter_t *writer)
+{
+    const size_t len = protocol_frame_end(writer);
+    if (len == 0U) {
+        protocol->tx_dropped++;
+        return false;
+    }
+    protocol->tx_len += len;
+    protocol->tx_frames++;
+    return true;
+}
+
+static void _protocol_handle_command(Protocol_t *protocol, const ProtocolFrame_t *frame, ProtocolWriter_t *writer)
+{
+    ProtocolStatus_t status = PROTOCOL_STATUS_OK;
+    if (frame->len != sizeof(float)) {
+        status = PROTOCOL_STATUS_LENGTH;
+    } else {
+        const uint8_t *payload = frame->payload;
+        const float value = _protocol_unpack_f32(&payload);
+        if (!isfinite(value)) {
+            status = PROTOCOL_STATUS_REJECTED;
+        } else if (frame->type == PROTOCOL_MSG_SET_THROTTLE) {
+            esc_set_throttle(protocol->esc, value);
+        } else {
+            esc_set_brake(protocol->esc, value);
+        }
+    }
+    _protocol_begin_reply(protocol, writer, frame, status);
+}
+
+static void _protocol_handle_set_config(Protocol_t *protocol, const ProtocolFrame_t *frame, ProtocolWriter_t *writer)
+{
+    EscConfig_t cfg;
+    ProtocolStatus_t status = PROTOCOL_STATUS_OK;
+    if (frame->len != PROTOCOL_CONFIG_SIZE) {
+        status = PROTOCOL_STATUS_LENGTH;
+    } else {
+        /* Reconfiguring restarts the control state, so it waits for the bridge to be off; the black box and scope
+         * keep their records */
+        protocol_unpack_config(frame->payload, &cfg);
+        if (protocol->esc->inverter_cmd.enable || !esc_config_is_valid(&cfg) ||
+            !esc_reconfigure(protocol->esc, &cfg)) {
+            status = PROTOCOL_STATUS_REJECTED;
+        }
+        protocol->telemetry_sent = protocol->esc->telemetry.sequence;
+    }
+    _protocol_begin_reply(protocol, writer, frame, status);
+}
+
+static void _protocol_handle_save_config(Protocol_t *protocol, const ProtocolFrame_t *frame, ProtocolWriter_t *writer)
+{
+    ProtocolStatus_t status = PROTOCOL_STATUS_OK;
+    if (frame->len != 0U) {
+        status = PROTOCOL_STATUS_LENGTH;
+    } else if (protocol->store == NULL || protocol->esc->inverter_cmd.enable ||
+               !param_store_save_config(protocol->store, protocol->esc->hal_motor, &protocol->esc->config)) {
+        /* Flash erases stall the CPU for milliseconds, so they wait for the bridge to be off */
+        status = PROTOCOL_STATUS_REJECTED;
+    }
+    _protocol_begin_reply(protocol, writer, frame, status);
+}
+
+static void _protocol_handle_arm_scope(Protocol_t *protocol, const ProtocolFrame_t *frame, ProtocolWriter_t *writer)
+{
+    EscScopeConfig_t cfg;
+    ProtocolStatus_t status = PROTOCOL_STATUS_OK;
+    if (frame->len != PROTOCOL_SCOPE_CONFIG_SIZE) {
+        status = PROTOCOL_STATUS_LENGTH;
+    } else {
+        protocol_unpack_scope_config(frame->payload, &cfg);
+        if (!scope_arm(protocol->esc, &cfg)) {
+            status = PROTOCOL_STATUS_REJECTED;
+        }
+    }
+    _protocol_begin_reply(protocol, writer, frame, status);
+}
+
+static void _protocol_handle_read_scope(Protocol_t *protocol, const ProtocolFrame_t *frame, ProtocolWriter_t *writer)
+{
+    if (frame->len != 2U) {
+        _protocol_begin_reply(protocol, writer, frame, PROTOCOL_STATUS_LENGTH);
+        return;
+    }
+
+    /* Frames only go out once the capture is complete, so a readout never mixes two captures */
+    const Esc_t *esc = protocol->esc;
+    const EscScopeState_t state = scope_get_state(esc);
+    const uint32_t channels = esc->scope.config.num_channels;
+    const uint32_t frames = scope_get_num_frames(esc);
+    const uint16_t first = _protocol_get_u16(frame->payload);
+    uint32_t count = 0U;
+    if (state == ESC_SCOPE_STATE_DONE && first < frames) {
+        count = (PROTOCOL_MAX_PAYLOAD - PROTOCOL_SCOPE_HEADER_SIZE) / (channels * PROTOCOL_SCOPE_SAMPLE_SIZE);
+        count = (count < frames - first) ? count : frames - first;
+        count = (count < PROTOCOL_MAX_READ_COUNT) ? count : PROTOCOL_MAX_READ_COUNT;
+    }
+
+    _protocol_begin_reply(protocol, writer, frame, PROTOCOL_STATUS_OK);
+    _protocol_put_u8(writer, (uint8_t)state);
+    _protocol_put_u8(writer, (uint8_t)channels);
+    _protocol_put_u16(writer, (uint16_t)frames);
+    _protocol_put_u16(writer, (uint16_t)(int16_t)scope_get_trigger_index(esc));
+    _protocol_put_u16(writer, first);
+    _protocol_put_u8(writer, (uint8_t)count);
+    for (uint32_t i = 0U; i < count; ++i) {
+        const float *samples = scope_peek_frame(esc, first + i);
+        for (uint32_t c = 0U; c < channels; ++c) {
+            uint8_t packed[PROTOCOL_SCOPE_SAMPLE_SIZE];
+            protocol_pack_scope_sample(samples[c], packed);
+            protocol_frame_write(writer, packed, sizeof(packed));
+        }
+    }
+}
+
+static void _protocol_handle_read_blackbox(Protocol_t *protocol, const ProtocolFrame_t *frame,
+                                           ProtocolWriter_t *writer)
+{
+    if (frame->len != 2U) {
+        _protocol_begin_reply(protocol, writer, frame, PROTOCOL_STATUS_LENGTH);
+        return;
+    }
+
+    const Esc_t *esc = protocol->esc;
+    const uint32_t samples = blackbox_get_num_samples(esc);
+    const uint16_t first = _protocol_get_u16(frame->payload);
+    uint32_t count = 0U;
+    if (first < samples) {
+        count = (PROTOCOL_MAX_PAYLOAD - PROTOCOL_BLACKBOX_HEADER_SIZE) / PROTOCOL_BLACKBOX_SAMPLE_SIZE;
+        count = (count < samples - first) ? count : samples - first;
+    }
+
+    _protocol_begin_reply(protocol, writer, frame, PROTOCOL_STATUS_OK);
+    _protocol_put_u8(writer, (uint8_t)blackbox_is_frozen(esc));
+    _protocol_put_u8(writer, esc->blackbox.trigger_fault_flags);
+    _protocol_put_u8(writer, esc->blackbox.trigger_hal_fault);
+    _protocol_put_u16(writer, (uint16_t)samples);
+    _protocol_put_u16(writer, (uint16_t)(int16_t)blackbox_get_trigger_index(esc));
+    _protocol_put_u16(writer, first);
+    _protocol_put_u8(writer, (uint8_t)count);
+    for (uint32_t i = 0U; i < count; ++i) {
+        uint8_t packed[PROTOCOL_BLACKBOX_SAMPLE_SIZE];
+        protocol_pack_blackbox_sample(blackbox_peek_sample(esc, first + i), packed);
+        protocol_frame_write(writer, packed, sizeof(packed));
+    }
+}
+
+/**
+ * @brief   Carry out one request and queue its reply
+ */
+static void _protocol_dispatch(void *ctx, const ProtocolFrame_t *frame)
+{
+    Protocol_t *protocol = (Protocol_t *)ctx;
+    if ((frame->type & PROTOCOL_REPLY_FLAG) != 0U) {
+        return;
+    }
+
+    ProtocolWriter_t writer;
+    uint8_t packed[PROTOCOL_CONFIG_SIZE];
+    switch (frame->type) {
+        case PROTOCOL_MSG_PING:
+            _protocol_begin_reply(protocol, &writer, frame,
+                                  (frame->len == 0U) ? PROTOCOL_STATUS_OK : PROTOCOL_STATUS_LENGTH);
+            _protocol_put_u8(&writer, PROTOCOL_VERSION);
+            break;
+        case PROTOCOL_MSG_SET_THROTTLE:
+        case PROTOCOL_MSG_SET_BRAKE:
+            _protocol_handle_command(protocol, frame, &writer);
+            break;
+        case PROTOCOL_MSG_GET_CONFIG:
+            _protocol_begin_reply(protocol, &writer, frame, PROTOCOL_STATUS_OK);
+            protocol_pack_config(&protocol->esc->config, packed);
+            protocol_frame_write(&writer, packed, PROTOCOL_CONFIG_SIZE);
+            break;
+        case PROTOCOL_MSG_SET_CONFIG:
+            _protocol_handle_set_config(protocol, frame, &writer);
+            break;
+        case PROTOCOL_MSG_SAVE_CONFIG:
+            _protocol_handle_save_config(protocol, frame, &writer);
+            break;
+        case PROTOCOL_MSG_GET_TELEMETRY:
+            _protocol_begin_reply(protocol, &writer, frame, PROTOCOL_STATUS_OK);
+            protocol_pack_telemetry(&protocol->esc->telemetry, packed);
+            protocol_frame_write(&writer, packed, PROTOCOL_TELEMETRY_SIZE);
+            break;
+        case PROTOCOL_MSG_STREAM_TELEMETRY:
+            if (frame->len != 1U) {
+                _protocol_begin_reply(protocol, &writer, frame, PROTOCOL_STATUS_LENGTH);
+                break;
+            }
+            protocol->streaming = (frame->payload[0] != 0U);
+            protocol->telemetry_sent = protocol->esc->telemetry.sequence;
+            _protocol_begin_reply(protocol, &writer, frame, PROTOCOL_STATUS_OK);
+            break;
+        case PROTOCOL_MSG_ARM_SCOPE:
+            _protocol_handle_arm_scope(protocol, frame, &writer);
+            break;
+        case PROTOCOL_MSG_READ_SCOPE:
+            _protocol_handle_read_scope(protocol, frame, &writer);
+            break;
+        case PROTOCOL_MSG_READ_BLACKBOX:
+            _protocol_handle_read_blackbox(protocol, frame, &writer);
+            break;
+        default:
+            _protocol_begin_reply(protocol, &writer, frame, PROTOCOL_STATUS_UNKNOWN);
+            break;
+    }
+    (void)_protocol_queue(protocol, &writer);
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void protocol_frame_begin(ProtocolWriter_t *writer, uint8_t *out, size_t size, uint8_t type, uint8_t sequence)
+{
+    const uint8_t header[PROTOCOL_HEADER_SIZE] = { type, sequence };
+    cobs_encoder_begin(&writer->cobs, out, size);
+    writer->crc = CRC16_INIT;
+    protocol_frame_write(writer, header, sizeof(header));
+}
+
+void protocol_frame_write(ProtocolWriter_t *writer, const void *data, size_t len)
+{
+    writer->crc = crc16_update(writer->crc, data, len);
+    cobs_encoder_write(&writer->cobs, data, len);
+}
+
+size_t protocol_frame_end(ProtocolWriter_t *writer)
+{
+    const uint8_t crc[PROTOCOL_CRC_SIZE] = { (uint8_t)(writer->crc >> 8), (uint8_t)writer->crc };
+    cobs_encoder_write(&writer->cobs, crc, sizeof(crc));
+    return cobs_encoder_end(&writer->cobs);
+}
+
+bool protocol_frame_decode(uint8_t *buf, size_t len, ProtocolFrame_t *frame)
+{
+    /* With the CRC appended most significant byte first, the CRC over the whole frame is zero */
+    size_t decoded_len;
+    if (!cobs_decode(buf, len, &decoded_len) || decoded_len < PROTOCOL_HEADER_SIZE + PROTOCOL_CRC_SIZE ||
+        crc16_update(CRC16_INIT, buf, decoded_len) != 0U) {
+        return false;
+    }
+
+    frame->type = buf[0];
+    frame->sequence = buf[1];
+    frame->payload = &buf[PROTOCOL_HEADER_SIZE];
+    frame->len = decoded_len - PROTOCOL_HEADER_SIZE - PROTOCOL_CRC_SIZE;
+    return true;
+}
+
+void protocol_pack_config(const EscConfig_t *cfg, uint8_t *out)
+{
+    _protocol_pack_u8(&out, (uint8_t)cfg->control_mode);
+    _protocol_pack_u8(&out, (uint8_t)cfg->commutation_method);
+    _protocol_pack_u8(&out, (uint8_t)cfg->feedback_mechanism);
+
+    _protocol_pack_f32(&out, cfg->limits.max_phase_current_A);
+    _protocol_pack_f32(&out, cfg->limits.max_temp_C);
+    _protocol_pack_f32(&out, cfg->limits.vbus_uvlo_V);
+    _protocol_pack_f32(&out, cfg->limits.vbus_ovlo_V);
+    _protocol_pack_f32(&out, cfg->limits.max_duty);
+    _protocol_pack_f32(&out, cfg->limits.max_regen_current_A);
+
+    _protocol_pack_u16(&out, cfg->pwm.dead_time_ns);
+    _protocol_pack_u8(&out, (uint8_t)cfg->pwm.center_aligned);
+    _protocol_pack_u8(&out, (uint8_t)cfg->pwm.synchronous_rectification);
+    _protocol_pack_u8(&out, (uint8_t)cfg->pwm.dead_time_compensation);
+    _protocol_pack_f32(&out, cfg->pwm.diode_forward_V);
+
+    _protocol_pack_u32(&out, cfg->deadline.deadline_ns);
+    _protocol_pack_u16(&out, cfg->deadline.degrade_overruns);
+    _protocol_pack_u16(&out, cfg->deadline.degrade_window_ticks);
+
+    _protocol_pack_f32(&out, cfg->thermal.ambient_temp_C);
+    _protocol_pack_f32(&out, cfg->thermal.winding_resistance_Ohm);
+    _protocol_pack_f32(&out, cfg->thermal.winding_r_th_K_per_W);
+    _protocol_pack_f32(&out, cfg->thermal.winding_c_th_J_per_K);
+    _protocol_pack_f32(&out, cfg->thermal.max_winding_temp_C);
+    _protocol_pack_f32(&out, cfg->thermal.fet_rds_on_Ohm);
+    _protocol_pack_f32(&out, cfg->thermal.fet_r_th_K_per_W);
+    _protocol_pack_f32(&out, cfg->thermal.fet_c_th_J_per_K);
+    _protocol_pack_f32(&out, cfg->thermal.max_fet_temp_C);
+    _protocol_pack_f32(&out, cfg->thermal.derate_band_C);
+
+    _protocol_pack_f32(&out, cfg->battery.max_discharge_current_A);
+    _protocol_pack_f32(&out, cfg->battery.max_charge_current_A);
+    _protocol_pack_f32(&out, cfg->battery.max_power_W);
+    _protocol_pack_f32(&out, cfg->battery.sag_foldback_band_V);
+    _protocol_pack_f32(&out, cfg->battery.dc_link_capacitance_F);
+
+    _protocol_pack_f32(&out, cfg->current_loop.kp);
+    _protocol_pack_f32(&out, cfg->current_loop.ki);
+
+    _protocol_pack_f32(&out, cfg->field_weakening.max_current_A);
+
+    _protocol_pack_u8(&out, cfg->motor_config.num_pole_pairs);
+    _protocol_pack_f32(&out, cfg->motor_config.phase_resistance_Ohm);
+    _protocol_pack_f32(&out, cfg->motor_config.phase_inductance_H);
+    _protocol_pack_f32(&out, cfg->motor_config.q_axis_inductance_H);
+    _protocol_pack_f32(&out, cfg->motor_config.flux_linkage_Wb);
+}
+
+void protocol_unpack_config(const uint8_t *data, EscConfig_t *cfg)
+{
+    /* Zeroed first, so the padding of a configuration that is later stored or compared is not stale stack */
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->control_mode = (EscControlMode_t)_protocol_unpack_u8(&data);
+    cfg->commutation_method = (EscCommutationMethod_t)_protocol_unpack_u8(&data);
+    cfg->feedback_mechanism = (EscFeedbackMechanism_t)_protocol_unpack_u8(&data);
+
+    cfg->limits.max_phase_current_A = _protocol_unpack_f32(&data);
+    cfg->limits.max_temp_C = _protocol_unpack_f32(&data);
+    cfg->limits.vbus_uvlo_V = _protocol_unpack_f32(&data);
+    cfg->limits.vbus_ovlo_V = _protocol_unpack_f32(&data);
+    cfg->limits.max_duty = _protocol_unpack_f32(&data);
+    cfg->limits.max_regen_current_A = _protocol_unpack_f32(&data);
+
+    cfg->pwm.dead_time_ns = _protocol_unpack_u16(&data);
+    cfg->pwm.center_aligned = (_protocol_unpack_u8(&data) != 0U);
+    cfg->pwm.synchronous_rectification = (_protocol_unpack_u8(&data) != 0U);
+    cfg->pwm.dead_time_compensation = (_protocol_unpack_u8(&data) != 0U);
+    cfg->pwm.diode_forward_V = _protocol_unpack_f32(&data);
+
+    cfg->deadline.deadline_ns = _protocol_unpack_u32(&data);
+    cfg->deadline.degrade_overruns = _protocol_unpack_u16(&data);
+    cfg->deadline.degrade_window_ticks = _protocol_unpack_u16(&data);
+
+    cfg->thermal.ambient_temp_C = _protocol_unpack_f32(&data);
+    cfg->thermal.winding_resistance_Ohm = _protocol_unpack_f32(&data);
+    cfg->thermal.winding_r_th_K_per_W = _protocol_unpack_f32(&data);
+    cfg->thermal.winding_c_th_J_per_K = _protocol_unpack_f32(&data);
+    cfg->thermal.max_winding_temp_C = _protocol_unpack_f32(&data);
+    cfg->thermal.fet_rds_on_Ohm = _protocol_unpack_f32(&data);
+    cfg->thermal.fet_r_th_K_per_W = _protocol_unpack_f32(&data);
+    cfg->thermal.fet_c_th_J_per_K = _protocol_unpack_f32(&data);
+    cfg->thermal.max_fet_temp_C = _protocol_unpack_f32(&data);
+    cfg->thermal.derate_band_C = _protocol_unpack_f32(&data);
+
+    cfg->battery.max_discharge_current_A = _protocol_unpack_f32(&data);
+    cfg->battery.max_charge_current_A = _protocol_unpack_f32(&data);
+    cfg->battery.max_power_W = _protocol_unpack_f32(&data);
+    cfg->battery.sag_foldback_band_V = _protocol_unpack_f32(&data);
+    cfg->battery.dc_link_capacitance_F = _protocol_unpack_f32(&data);
+
+    cfg->current_loop.kp = _protocol_unpack_f32(&data);
+    cfg->current_loop.ki = _protocol_unpack_f32(&data);
+
+    cfg->field_weakening.max_current_A = _protocol_unpack_f32(&data);
+
+    cfg->motor_config.num_pole_pairs = _protocol_unpack_u8(&data);
+    cfg->motor_config.phase_resistance_Ohm = _protocol_unpack_f32(&data);
+    cfg->motor_config.phase_inductance_H = _protocol_unpack_f32(&data);
+    cfg->motor_config.q_axis_inductance_H = _protocol_unpack_f32(&data);
+    cfg->motor_config.flux_linkage_Wb = _protocol_unpack_f32(&data);
+}
+
+void protocol_pack_telemetry(const EscTelemetry_t *telemetry, uint8_t *out)
+{
+    _protocol_pack_f32(&out, telemetry->vbus_V);
+    _protocol_pack_f32(&out, telemetry->temperature_C);
+    _protocol_pack_f32(&out, telemetry->velocity_mech_rpm);
+    _protocol_pack_f32(&out, telemetry->drive_current_A);
+    _protocol_pack_f32(&out, telemetry->throttle);
+    _protocol_pack_f32(&out, telemetry->winding_temp_C);
+    _protocol_pack_f32(&out, telemetry->fet_temp_C);
+    _protocol_pack_f32(&out, telemetry->thermal_derate);
+    _protocol_pack_f32(&out, telemetry->dc_current_A);
+    _protocol_pack_f32(&out, telemetry->input_power_W);
+    _protocol_pack_u32(&out, telemetry->fault_flags);
+    _protocol_pack_u32(&out, telemetry->sequence);
+}
+
+void protocol_unpack_telemetry(const uint8_t *data, EscTelemetry_t *telemetry)
+{
+    telemetry->vbus_V = _protocol_unpack_f32(&data);
+    telemetry->temperature_C = _protocol_unpack_f32(&data);
+    telemetry->velocity_mech_rpm = _protocol_unpack_f32(&data);
+    telemetry->drive_current_A = _protocol_unpack_f32(&data);
+    telemetry->throttle = _protocol_unpack_f32(&data);
+    telemetry->winding_temp_C = _protocol_unpack_f32(&data);
+    telemetry->fet_temp_C = _protocol_unpack_f32(&data);
+    telemetry->thermal_derate = _protocol_unpack_f32(&data);
+    telemetry->dc_current_A = _protocol_unpack_f32(&data);
+    telemetry->input_power_W = _protocol_unpack_f32(&data);
+    telemetry->fault_flags = _protocol_unpack_u32(&data);
+    telemetry->sequence = _protocol_unpack_u32(&data);
+}
+
+void protocol_pack_scope_config(const EscScopeConfig_t *cfg, uint8_t *out)
+{
+    _protocol_pack_u8(&out, cfg->num_channels);
+    for (uint32_t i = 0U; i < SCOPE_MAX_CHANNELS; ++i) {
+        _protocol_pack_u8(&out, (uint8_t)cfg->channels[i]);
+    }
+    _protocol_pack_u8(&out, (uint8_t)cfg->trigger);
+    _protocol_pack_u8(&out, (uint8_t)cfg->trigger_signal);
+    _protocol_pack_f32(&out, cfg->trigger_level);
+    _protocol_pack_u16(&out, cfg->decimation);
+    _protocol_pack_u16(&out, cfg->pre_trigger_frames);
+}
+
+void protocol_unpack_scope_config(const uint8_t *data, EscScopeConfig_t *cfg)
+{
+    /* Zeroed first, as scope_arm() copies the whole struct into the ESC */
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->num_channels = _protocol_unpack_u8(&data);
+    for (uint32_t i = 0U; i < SCOPE_MAX_CHANNELS; ++i) {
+        cfg->channels[i] = (EscScopeSignal_t)_protocol_unpack_u8(&data);
+    }
+    cfg->trigger = (EscScopeTrigger_t)_protocol_unpack_u8(&data);
+    cfg->trigger_signal = (EscScopeSignal_t)_protocol_unpack_u8(&data);
+    cfg->trigger_level = _protocol_unpack_f32(&data);
+    cfg->decimation = _protocol_unpack_u16(&data);
+    cfg->pre_trigger_frames = _protocol_unpack_u16(&data);
+}
+
+void protocol_pack_scope_sample(float value, uint8_t *out)
+{
+    _protocol_pack_f32(&out, value);
+}
+
+void protocol_pack_blackbox_sample(const EscBlackBoxSample_t *sample, uint8_t *out)
+{
+    _protocol_pack_u32(&out, sample->time_us);
+    for (uint32_t i = 0U; i < NUM_MOTOR_PHASES; ++i) {
+        _protocol_pack_u16(&out, (uint16_t)sample->phase_current_cA[i]);
+    }
+    _protocol_pack_u16(&out, sample->vbus_cV);
+    _protocol_pack_u16(&out, (uint16_t)sample->temperature_dC);
+    _protocol_pack_u16(&out, sample->duty);
+    _protocol_pack_u16(&out, sample->elec_angle);
+    _protocol_pack_u8(&out, sample->hall_abc);
+    _protocol_pack_u8(&out, sample->fault_flags);
+    _protocol_pack_u8(&out, sample->hal_fault);
+    _protocol_pack_u8(&out, sample->direction_state);
+}
+
+void protocol_unpack_blackbox_sample(const uint8_t *data, EscBlackBoxSample_t *sample)
+{
+    sample->time_us = _protocol_unpack_u32(&data);
+    for (uint32_t i = 0U; i < NUM_MOTOR_PHASES; ++i) {
+        sample->phase_current_cA[i] = (int16_t)_protocol_unpack_u16(&data);
+    }
+    sample->vbus_cV = _protocol_unpack_u16(&data);
+    sample->temperature_dC = (int16_t)_protocol_unpack_u16(&data);
+    sample->duty = _protocol_unpack_u16(&data);
+    sample->elec_angle = _protocol_unpack_u16(&data);
+    sample->hall_abc = _protocol_unpack_u8(&data);
+    sample->fault_flags = _protocol_unpack_u8(&data);
+    sample->hal_fault = _protocol_unpack_u8(&data);
+    sample->direction_state = _protocol_unpack_u8(&data);
+}
+
+void protocol_rx_reset(ProtocolRx_t *rx)
+{
+    rx->len = 0U;
+    rx->overflow = false;
+    rx->frames = 0U;
+    rx->errors = 0U;
+    rx->overflows = 0U;
+}
+
+void protocol_rx_feed(ProtocolRx_t *rx, uint8_t *data, size_t len, ProtocolHandler_t handler, void *ctx)
+{
+    while (len > 0U) {
+        uint8_t *end = memchr(data, COBS_DELIMITER, len);
+        const size_t chunk = (end != NULL) ? (size_t)(end - data) : len;
+
+        if (end != NULL && rx->len == 0U && !rx->overflow) {
+            /* The whole frame is here: decode it where it lies */
+            _protocol_rx_frame(rx, data, chunk, handler, ctx);
+        } else {
+            if (!rx->overflow && rx->len + chunk <= sizeof(rx->buf)) {
+                memcpy(&rx->buf[rx->len], data, chunk);
+                rx->len += chunk;
+            } else {
+                rx->overflow = true;
+            }
+            if (end != NULL) {
+                if (rx->overflow) {
+                    rx->overflows++;
+                } else {
+                    _protocol_rx_frame(rx, rx->buf, rx->len, handler, ctx);
+                }
+                rx->len = 0U;
+                rx->overflow = false;
+            }
+        }
+
+        if (end == NULL) {
+            return;
+        }
+        data = end + 1;
+        len -= chunk + 1U;
+    }
+}
+
+void protocol_init(Protocol_t *protocol, Esc_t *esc)
+{
+    protocol->esc = esc;
+    protocol->store = NULL;
+    protocol_rx_reset(&protocol->rx);
+    protocol->tx_head = 0U;
+    protocol->tx_len = 0U;
+    protocol->streaming = false;
+    protocol->telemetry_sent = esc->telemetry.sequence;
+    protocol->stream_sequence = 0U;
+    protocol->tx_frames = 0U;
+    protocol->tx_dropped = 0U;
+}
+
+void protocol_receive(Protocol_t *protocol, uint8_t *data, size_t len)
+{
+    protocol_rx_feed(&protocol->rx, data, len, _protocol_dispatch, protocol);
+}
+
+void protocol_update(Protocol_t *protocol)
+{
+    if (protocol->streaming && protocol->esc->telemetry.sequence != protocol->telemetry_sent) {
+        (void)protocol_send_telemetry(protocol);
+    }
+}
+
+bool protocol_send_telemetry(Protocol_t *protocol)
+{
+    ProtocolWriter_t writer;
+    uint8_t packed[PROTOCOL_TELEMETRY_SIZE];
+    protocol_pack_telemetry(&protocol->esc->telemetry, packed);
+    protocol_frame_begin(&writer, &protocol->tx[protocol->tx_len], sizeof(protocol->tx) - protocol->tx_len,
+                         PROTOCOL_MSG_TELEMETRY, protocol->stream_sequence);
+    protocol_frame_write(&writer, packed, sizeof(packed));
+    if (!_protocol_queue(protocol, &writer)) {
+        return false;
+    }
+    protocol->telemetry_sent = protocol->esc->telemetry.sequence;
+    protocol->stream_sequence++;
+    return true;
+}
+
+const uint8_t *protocol_get_tx(const Protocol_t *protocol, size_t *len)
+{
+    *len = protocol->tx_len - protocol->tx_head;
+    return &protocol->tx[protocol->tx_head];
+}
+
+void protocol_consume_tx(Protocol_t *protocol, size_t len)
+{
+    const size_t pending = protocol->tx_len - protocol->tx_head;
+    protocol->tx_head += (len < pending) ? len : pending;
+    /* Start again at the front once drained, so frames stay contiguous without moving them */
+    if (protocol->tx_head == protocol->tx_len) {
+        protocol->tx_head = 0U;
+        protocol->tx_len = 0U;
+    }
+}
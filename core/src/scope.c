@@ -0,0 +1,267 @@
+/*******************************************************************************************************************************
+ * @file   scope.c
+ *
+ * @brief  Source file for the software oscilloscope
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "hal_time.h"
+
+/* Intra-component Headers */
+#include "scope.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Storage type of a registry signal
+ */
+typedef enum {
+    SCOPE_TYPE_FLOAT,
+    SCOPE_TYPE_UINT8,
+    SCOPE_TYPE_UINT16,
+    SCOPE_TYPE_UINT32,
+} ScopeType_t;
+
+/**
+ * @brief   Registry entry: where a signal lives in Esc_t and how it is stored
+ */
+typedef struct {
+    uint16_t offset;
+    uint8_t type;
+} ScopeSignalDesc_t;
+
+#define SCOPE_SIGNAL(field, type) { (uint16_t)offsetof(Esc_t, field), (uint8_t)(type) }
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const ScopeSignalDesc_t scope_signals[NUM_ESC_SCOPE_SIGNALS] = {
+    [ESC_SCOPE_SIGNAL_CURRENT_A] = SCOPE_SIGNAL(motor_state.phase_currents_A[MOTOR_PHASE_A], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_CURRENT_B] = SCOPE_SIGNAL(motor_state.phase_currents_A[MOTOR_PHASE_B], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_CURRENT_C] = SCOPE_SIGNAL(motor_state.phase_currents_A[MOTOR_PHASE_C], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_VBUS] = SCOPE_SIGNAL(motor_state.vbus_V, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_HALL] = SCOPE_SIGNAL(motor_state.hall_abc, SCOPE_TYPE_UINT8),
+    [ESC_SCOPE_SIGNAL_DUTY] = SCOPE_SIGNAL(inverter_cmd.duty, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_PHASE_DUTY_A] = SCOPE_SIGNAL(inverter_cmd.phase_duty[MOTOR_PHASE_A], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_PHASE_DUTY_B] = SCOPE_SIGNAL(inverter_cmd.phase_duty[MOTOR_PHASE_B], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_PHASE_DUTY_C] = SCOPE_SIGNAL(inverter_cmd.phase_duty[MOTOR_PHASE_C], SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_ELEC_ANGLE] = SCOPE_SIGNAL(elec_angle, SCOPE_TYPE_UINT16),
+    [ESC_SCOPE_SIGNAL_SINE_LEAD] = SCOPE_SIGNAL(sine_lead, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_DRIVE_CURRENT] = SCOPE_SIGNAL(drive_current_A, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_QUADRATURE_CURRENT] = SCOPE_SIGNAL(quadrature_current_A, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_ADVANCE_CURRENT] = SCOPE_SIGNAL(advance_current_A, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_SPEED] = SCOPE_SIGNAL(velocity_mech_rpm, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_THROTTLE] = SCOPE_SIGNAL(throttle_ramped, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_DC_CURRENT] = SCOPE_SIGNAL(dc_current_A, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_PLL_ANGLE] = SCOPE_SIGNAL(sensorless.pll_angle, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_PLL_SPEED] = SCOPE_SIGNAL(sensorless.pll_speed_rad_s, SCOPE_TYPE_FLOAT),
+    [ESC_SCOPE_SIGNAL_FAULT_FLAGS] = SCOPE_SIGNAL(fault_flags, SCOPE_TYPE_UINT32),
+};
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Write one frame into the ring and advance the trigger
+ */
+static void _scope_take_frame(Esc_t *esc)
+{
+    EscScope_t *scope = &esc->scope;
+    const EscScopeConfig_t *cfg = &scope->config;
+
+    float *frame = &scope->buffer[scope->head * cfg->num_channels];
+    for (uint32_t i = 0U; i < cfg->num_channels; ++i) {
+        frame[i] = scope_read_signal(esc, cfg->channels[i]);
+    }
+    scope->head = (scope->head + 1U < scope->depth) ? scope->head + 1U : 0U;
+    if (scope->count < scope->depth) {
+        scope->count++;
+    }
+
+    if (scope->state == ESC_SCOPE_STATE_TRIGGERED) {
+        scope->trigger_age++;
+        if (--scope->post_frames == 0U) {
+            scope->state = ESC_SCOPE_STATE_DONE;
+        }
+        return;
+    }
+
+    const float value = scope_read_signal(esc, cfg->trigger_signal);
+    const float level = cfg->trigger_level;
+    const bool rising = (scope->trigger_prev < level) && (value >= level);
+    const bool falling = (scope->trigger_prev > level) && (value <= level);
+    scope->trigger_prev = value;
+
+    bool fire;
+    switch (cfg->trigger) {
+        case ESC_SCOPE_TRIGGER_RISING:
+            fire = rising;
+            break;
+        case ESC_SCOPE_TRIGGER_FALLING:
+            fire = falling;
+            break;
+        case ESC_SCOPE_TRIGGER_EITHER:
+            fire = rising || falling;
+            break;
+        case ESC_SCOPE_TRIGGER_NONE:
+        default:
+            fire = true;
+            break;
+    }
+
+    /* The trigger frame follows the pre-trigger frames, so it only counts once they are in */
+    if (!fire || scope->count <= cfg->pre_trigger_frames) {
+        return;
+    }
+    scope->trigger_age = 0U;
+    scope->post_frames = scope->depth - cfg->pre_trigger_frames - 1U;
+    scope->state = (scope->post_frames == 0U) ? ESC_SCOPE_STATE_DONE : ESC_SCOPE_STATE_TRIGGERED;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void scope_reset(Esc_t *esc)
+{
+    if (esc == NULL) {
+        return;
+    }
+
+    EscScope_t *scope = &esc->scope;
+    scope->state = ESC_SCOPE_STATE_IDLE;
+    scope->config.num_channels = 0U;
+    scope->depth = 0U;
+    scope->head = 0U;
+    scope->count = 0U;
+    scope->post_frames = 0U;
+    scope->trigger_age = 0U;
+    scope->ticks = 0U;
+    scope->trigger_prev = 0.0f;
+    scope->last_cycles = 0U;
+    scope->max_cycles = 0U;
+}
+
+bool scope_arm(Esc_t *esc, const EscScopeConfig_t *cfg)
+{
+    if (esc == NULL || cfg == NULL || cfg->num_channels == 0U || cfg->num_channels > SCOPE_MAX_CHANNELS ||
+        cfg->trigger >= NUM_ESC_SCOPE_TRIGGERS || cfg->trigger_signal >= NUM_ESC_SCOPE_SIGNALS ||
+        cfg->decimation == 0U || cfg->pre_trigger_frames >= SCOPE_BUFFER_SAMPLES / cfg->num_channels) {
+        return false;
+    }
+    for (uint32_t i = 0U; i < cfg->num_channels; ++i) {
+        if (cfg->channels[i] >= NUM_ESC_SCOPE_SIGNALS) {
+            return false;
+        }
+    }
+
+    scope_reset(esc);
+    EscScope_t *scope = &esc->scope;
+    scope->config = *cfg;
+    scope->depth = SCOPE_BUFFER_SAMPLES / cfg->num_channels;
+    /* The first frame is taken on the next tick, and a level already crossed does not trigger */
+    scope->ticks = (uint16_t)(cfg->decimation - 1U);
+    scope->trigger_prev = scope_read_signal(esc, cfg->trigger_signal);
+    scope->state = ESC_SCOPE_STATE_ARMED;
+    return true;
+}
+
+void scope_update(Esc_t *esc)
+{
+    EscScope_t *scope = &esc->scope;
+    if (scope->state != ESC_SCOPE_STATE_ARMED && scope->state != ESC_SCOPE_STATE_TRIGGERED) {
+        return;
+    }
+
+#if ESC_SCHED_BUDGET_CHECKS
+    const uint32_t start = hal_time_get_cycles();
+#endif
+    if (++scope->ticks >= scope->config.decimation) {
+        scope->ticks = 0U;
+        _scope_take_frame(esc);
+    }
+#if ESC_SCHED_BUDGET_CHECKS
+    scope->last_cycles = hal_time_elapsed_ticks32(hal_time_get_cycles(), start);
+    if (scope->last_cycles > scope->max_cycles) {
+        scope->max_cycles = scope->last_cycles;
+    }
+#endif
+}
+
+float scope_read_signal(const Esc_t *esc, EscScopeSignal_t signal)
+{
+    if (esc == NULL || signal >= NUM_ESC_SCOPE_SIGNALS) {
+        return 0.0f;
+    }
+
+    const ScopeSignalDesc_t *desc = &scope_signals[signal];
+    const uint8_t *field = (const uint8_t *)esc + desc->offset;
+    switch (desc->type) {
+        case SCOPE_TYPE_UINT8:
+            return (float)*field;
+        case SCOPE_TYPE_UINT16:
+            return (float)*(const uint16_t *)(const void *)field;
+        case SCOPE_TYPE_UINT32:
+            return (float)*(const uint32_t *)(const void *)field;
+        case SCOPE_TYPE_FLOAT:
+        default:
+            return *(const float *)(const void *)field;
+    }
+}
+
+EscScopeState_t scope_get_state(const Esc_t *esc)
+{
+    return (esc != NULL) ? esc->scope.state : ESC_SCOPE_STATE_IDLE;
+}
+
+uint32_t scope_get_num_frames(const Esc_t *esc)
+{
+    return (esc != NULL) ? esc->scope.count : 0U;
+}
+
+int32_t scope_get_trigger_index(const Esc_t *esc)
+{
+    if (esc == NULL ||
+        (esc->scope.state != ESC_SCOPE_STATE_TRIGGERED && esc->scope.state != ESC_SCOPE_STATE_DONE)) {
+        return -1;
+    }
+    return (int32_t)(esc->scope.count - 1U - esc->scope.trigger_age);
+}
+
+const float *scope_peek_frame(const Esc_t *esc, uint32_t index)
+{
+    if (esc == NULL || index >= esc->scope.count) {
+        return NULL;
+    }
+
+    /* Once the ring has wrapped the oldest frame is the one about to be overwritten */
+    const EscScope_t *scope = &esc->scope;
+    uint32_t slot = (scope->count < scope->depth) ? index : scope->head + index;
+    if (slot >= scope->depth) {
+        slot -= scope->depth;
+    }
+    return &scope->buffer[slot * scope->config.num_channels];
+}
+
+bool scope_get_frame(const Esc_t *esc, uint32_t index, float values[SCOPE_MAX_CHANNELS])
+{
+    const float *frame = scope_peek_frame(esc, index);
+    if (frame == NULL || values == NULL) {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < esc->scope.config.num_channels; ++i) {
+        values[i] = frame[i];
+    }
+    return true;
+}
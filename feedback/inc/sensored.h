@@ -37,6 +37,8 @@ bool sensored_init(const MotorConfig_t *cfg);
 
 /**
  * @brief   Update sensored feedback estimates
+ * @details Speed is measured over the interval between consecutive Hall transitions and signed by the direction
+ *          of the Hall sequence. Between transitions the estimate is bounded by the elapsed time.
  * @param   esc ESC instance
  * @param   dt_us Time since last tick in microseconds
  */
@@ -0,0 +1,80 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   sensorless.h
+ *
+ * @brief  Header file for the sensorless feedback module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "esc.h"
+
+/**
+ * @defgroup SensorlessFeedback Sensorless feedback module
+ * @brief    Flux observer and PLL feedback with an align and open-loop startup, for ESC sensorless mode
+ * @details  The nonlinear flux observer integrates the stator voltage less the resistive drop and pulls the rotor
+ *           flux it implies towards the configured flux linkage, so it needs no speed and converges from any
+ *           initial state; a PLL on its angle gives the speed and a filtered angle. The stator voltage is the
+ *           commanded one, so the observer only integrates while all three legs are switched (sinusoidal drive or
+ *           dynamic braking); with the bridge off it coasts on the PLL speed and forgets it after
+ *           SENSORLESS_COAST_TIMEOUT_US, as a free-spinning rotor cannot be seen without phase voltage sensing.
+ *           Before driving, short zero-vector pulses let the back-EMF set up current that gives the speed and
+ *           angle of a spinning rotor, so the drive catches it rather than aligning against it.
+ *           Below SENSORLESS_HANDOVER_RPM the back-EMF is too small against the voltage errors, so the drive
+ *           parks the rotor with a current vector, accelerates the vector open-loop and hands over once the
+ *           observer has tracked it for SENSORLESS_CONVERGE_TIME_US.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initialize sensorless feedback logic for the motor
+ * @param   cfg Motor configuration to apply
+ * @return  true if the configuration has the parameters the observer needs, false otherwise
+ */
+bool sensorless_init(const MotorConfig_t *cfg);
+
+/**
+ * @brief   Reset the observer, PLL and startup to standstill
+ * @param   esc ESC instance
+ */
+void sensorless_reset(Esc_t *esc);
+
+/**
+ * @brief   Update the observer, PLL and startup state machine, and the speed and direction estimates
+ * @details Uses the inverter command applied over the last period and the currents sampled at its end.
+ * @param   esc ESC instance
+ * @param   dt_us Time since last tick in microseconds
+ */
+void sensorless_update_feedback(Esc_t *esc, uint32_t dt_us);
+
+/**
+ * @brief   Electrical angle to drive at, as a rotor position
+ * @details The open-loop angle while starting, otherwise the PLL angle projected half a period ahead, to the middle
+ *          of the period the duties will apply over.
+ * @param   esc ESC instance
+ * @param   dt_us Control period in microseconds
+ * @return  Electrical angle
+ */
+uint16_t sensorless_get_angle(const Esc_t *esc, uint32_t dt_us);
+
+/**
+ * @brief   Check whether the drive is still starting open-loop
+ * @param   esc ESC instance
+ * @return  true while aligning or in open loop, false once running on the observer or idle
+ */
+bool sensorless_is_starting(const Esc_t *esc);
+
+/** @} */
@@ -8,6 +8,7 @@
  *******************************************************************************************************************************/
 
 /* Standard library Headers */
+#include <stddef.h>
 
 /* Inter-component Headers */
 
@@ -28,6 +29,18 @@ static const bool hall_valid[8] = {
     false   /* 111 */
 };
 
+/* Electrical sector of each Hall state; consecutive sectors are 60 electrical degrees apart in the forward direction */
+static const uint8_t hall_to_sector[8] = {
+    0xFFU, /* 000 */
+    2U,    /* 001 */
+    4U,    /* 010 */
+    3U,    /* 011 */
+    0U,    /* 100 */
+    1U,    /* 101 */
+    5U,    /* 110 */
+    0xFFU  /* 111 */
+};
+
 /*******************************************************************************************************************************
  * Function Definitions
  *******************************************************************************************************************************/
@@ -69,10 +82,63 @@ void sensored_update_feedback(Esc_t *esc, uint32_t dt_us)
         return;
     }
 
-    if (dt_us == 0U || dt_us < MIN_PERIOD_BETWEEN_HALL_TRANSITIONS_US) {
+    if (esc->hall_elapsed_us < HALL_SPEED_TIMEOUT_US) {
+        esc->hall_elapsed_us += dt_us;
+    }
+
+    /* First valid sample only seeds the sequence tracking */
+    if (esc->hall_prev == HALL_INVALID) {
+        esc->hall_prev = hall;
+        esc->hall_prev_timestamp_ticks = esc->motor_state.hall_timestamp_ticks;
+        esc->hall_elapsed_us = 0U;
+        return;
+    }
+
+    if (hall != esc->hall_prev) {
+        const uint8_t delta = (uint8_t)((hall_to_sector[hall] + 6U - hall_to_sector[esc->hall_prev]) % 6U);
+        /* Modular subtraction stays correct across a wrap of the 32-bit tick timestamp, but not across a stop of
+         * more than a whole wrap: the first edge after a speed timeout only reseeds the timestamp, like the first
+         * sample */
+        const bool stale = (esc->hall_elapsed_us >= HALL_SPEED_TIMEOUT_US);
+        const uint32_t interval_ticks = esc->motor_state.hall_timestamp_ticks - esc->hall_prev_timestamp_ticks;
+
+        esc->hall_prev = hall;
+        esc->hall_prev_timestamp_ticks = esc->motor_state.hall_timestamp_ticks;
+        esc->hall_elapsed_us = 0U;
+
+        /* Only adjacent sectors give a direction; a skipped sector keeps the previous estimate */
+        if (delta == 1U) {
+            esc->rotor_direction = 1;
+        } else if (delta == 5U) {
+            esc->rotor_direction = -1;
+        } else {
+            return;
+        }
+
+        if (stale || interval_ticks < MIN_PERIOD_BETWEEN_HALL_TRANSITIONS_US * MOTOR_TIMESTAMP_TICKS_PER_US) {
+            return;
+        }
+
+        const float interval_us = (float)interval_ticks / (float)MOTOR_TIMESTAMP_TICKS_PER_US;
+        const float one_mech_rev_us = interval_us * HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION * (float)pole_pairs;
+        esc->velocity_mech_rpm = (float)esc->rotor_direction * MICROSECONDS_PER_MINUTE / one_mech_rev_us;
+        return;
+    }
+
+    /* No transition: decay the estimate so it never exceeds one sector per elapsed time */
+    if (esc->hall_elapsed_us >= HALL_SPEED_TIMEOUT_US) {
+        esc->velocity_mech_rpm = 0.0f;
+        esc->rotor_direction = 0;
         return;
     }
 
-    const float one_mech_rev_us = (float)dt_us * HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION * (float)pole_pairs;
-    esc->velocity_mech_rpm = MICROSECONDS_PER_MINUTE / one_mech_rev_us;
+    if (esc->hall_elapsed_us > 0U) {
+        const float bound_rpm = MICROSECONDS_PER_MINUTE /
+            ((float)esc->hall_elapsed_us * HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION * (float)pole_pairs);
+        if (esc->velocity_mech_rpm > bound_rpm) {
+            esc->velocity_mech_rpm = bound_rpm;
+        } else if (esc->velocity_mech_rpm < -bound_rpm) {
+            esc->velocity_mech_rpm = -bound_rpm;
+        }
+    }
 }
@@ -0,0 +1,440 @@
+/*******************************************************************************************************************************
+ * @file   sensorless.c
+ *
+ * @brief  Source file for the sensorless feedback module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "sensorless.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define SENSORLESS_INV_SQRT3 0.57735027f
+#define SENSORLESS_RAD_S_PER_RPM (6.28318530718f / 60.0f)
+#define SENSORLESS_MAX_CORRECTION 0.5f /* Largest flux magnitude correction per tick, keeps a far-off start stable */
+#define SENSORLESS_DIRECTION_MIN_RPM 1.0f /* Direction reads unknown below this speed */
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static float _sensorless_wrap_angle(float angle)
+{
+    while (angle >= TRIG_ANGLE_COUNTS) {
+        angle -= TRIG_ANGLE_COUNTS;
+    }
+    while (angle < 0.0f) {
+        angle += TRIG_ANGLE_COUNTS;
+    }
+    return angle;
+}
+
+/* Electrical rad/s at a mechanical speed */
+static float _sensorless_rpm_to_rad_s(const Esc_t *esc, float rpm)
+{
+    return rpm * SENSORLESS_RAD_S_PER_RPM * (float)esc->config.motor_config.num_pole_pairs;
+}
+
+/**
+ * @brief   Alpha-beta stator voltage applied over the last period, if the bridge set all three terminals
+ * @return  true if the voltage is known, false with a phase floating or the bridge off
+ */
+static bool _sensorless_stator_voltage(const Esc_t *esc, float v_ab[2])
+{
+    const EscInverterCmd_t *cmd = &esc->inverter_cmd;
+    if (!cmd->enable) {
+        return false;
+    }
+
+    /* Dynamic braking holds every terminal low */
+    if (cmd->brake) {
+        v_ab[0] = 0.0f;
+        v_ab[1] = 0.0f;
+        return true;
+    }
+    if (cmd->high_enable_mask != ESC_PHASE_MASK_ALL || cmd->low_enable_mask != ESC_PHASE_MASK_ALL) {
+        return false;
+    }
+
+    /* Dead-time compensation only makes up for what the bridge loses, so it is left out of the applied voltage */
+    const float vbus_V = esc->motor_state.vbus_V;
+    const float va = (cmd->phase_duty[MOTOR_PHASE_A] - esc->dead_time_duty[MOTOR_PHASE_A]) * vbus_V;
+    const float vb = (cmd->phase_duty[MOTOR_PHASE_B] - esc->dead_time_duty[MOTOR_PHASE_B]) * vbus_V;
+    const float vc = (cmd->phase_duty[MOTOR_PHASE_C] - esc->dead_time_duty[MOTOR_PHASE_C]) * vbus_V;
+    v_ab[0] = (2.0f / 3.0f) * (va - 0.5f * (vb + vc));
+    v_ab[1] = SENSORLESS_INV_SQRT3 * (vb - vc);
+    return true;
+}
+
+/**
+ * @brief   Advance the flux observer, or with the stator voltage unknown reseed it on the coasting PLL angle
+ */
+static void _sensorless_update_observer(Esc_t *esc, const float i_ab[2], uint32_t dt_us)
+{
+    EscSensorless_t *s = &esc->sensorless;
+    const MotorConfig_t *motor = &esc->config.motor_config;
+    const float lambda_Wb = motor->flux_linkage_Wb;
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+
+    float v_ab[2];
+    if (!_sensorless_stator_voltage(esc, v_ab)) {
+        /* The rotor flux is the one the PLL last saw, turned on with the rotor */
+        float cos_angle;
+        float sin_angle;
+        trig_sincos((uint16_t)((uint16_t)(uint32_t)s->pll_angle + TRIG_ANGLE_HALF_TURN), &sin_angle, &cos_angle);
+        s->flux_Wb[0] = lambda_Wb * cos_angle + motor->phase_inductance_H * i_ab[0];
+        s->flux_Wb[1] = lambda_Wb * sin_angle + motor->phase_inductance_H * i_ab[1];
+        return;
+    }
+
+    /* Rotor flux is the stator flux less the winding's own; the correction pulls its magnitude to the flux linkage
+     * along itself, at SENSORLESS_OBSERVER_RATE_PER_S near the target */
+    float eta[2];
+    for (int k = 0; k < 2; ++k) {
+        eta[k] = s->flux_Wb[k] - motor->phase_inductance_H * i_ab[k];
+    }
+    float correction = 0.5f * SENSORLESS_OBSERVER_RATE_PER_S / (lambda_Wb * lambda_Wb) *
+                       (lambda_Wb * lambda_Wb - (eta[0] * eta[0] + eta[1] * eta[1])) * dt_s;
+    if (correction < -SENSORLESS_MAX_CORRECTION) {
+        correction = -SENSORLESS_MAX_CORRECTION;
+    }
+
+    /* Resistive drop on the mean current over the period */
+    for (int k = 0; k < 2; ++k) {
+        const float mean_A = 0.5f * (i_ab[k] + s->current_prev_A[k]);
+        s->flux_Wb[k] += (v_ab[k] - motor->phase_resistance_Ohm * mean_A) * dt_s + correction * eta[k];
+    }
+}
+
+static void _sensorless_update_pll(EscSensorless_t *s, bool tracking, uint32_t dt_us)
+{
+    /* Carry the angle on to this sample, then pull it towards the observer */
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+    s->pll_angle = _sensorless_wrap_angle(s->pll_angle + s->pll_speed_rad_s * dt_s * TRIG_ANGLE_COUNTS_PER_RAD);
+    if (tracking) {
+        const int16_t error = (int16_t)(uint16_t)(s->observer_angle - (uint16_t)(uint32_t)s->pll_angle);
+        const float error_rad = (float)error / TRIG_ANGLE_COUNTS_PER_RAD;
+        s->pll_speed_rad_s += SENSORLESS_PLL_KI * error_rad * dt_s;
+        s->pll_angle = _sensorless_wrap_angle(s->pll_angle + SENSORLESS_PLL_KP * error_rad * dt_s *
+                                                                 TRIG_ANGLE_COUNTS_PER_RAD);
+    }
+}
+
+static void _sensorless_enter(EscSensorless_t *s, EscSensorlessState_t state)
+{
+    s->state = state;
+    s->state_time_us = 0U;
+    s->converged_us = 0U;
+}
+
+/* The align starts a quarter turn back from where the open loop will start */
+static void _sensorless_enter_align(Esc_t *esc)
+{
+    EscSensorless_t *s = &esc->sensorless;
+    const float dir = (esc->direction_state == ESC_DIRECTION_STATE_REVERSE) ? -1.0f : 1.0f;
+    _sensorless_enter(s, ESC_SENSORLESS_STATE_ALIGN);
+    s->open_loop_angle = _sensorless_wrap_angle(s->pll_angle - dir * TRIG_ANGLE_QUARTER_TURN);
+    s->open_loop_speed_rad_s = 0.0f;
+    s->current_A = 0.0f;
+    esc->sine_lead = 0.0f;
+}
+
+/**
+ * @brief   Short the windings until the back-EMF of a spinning rotor builds up the catch current, twice
+ * @details Starting from zero, the current a short builds runs against the back-EMF, so its angle gives the rotor
+ *          angle up to the direction of rotation, which the turn between the two pulses then settles along with
+ *          the speed. A rotor slow enough not to reach the catch current within SENSORLESS_CATCH_TIMEOUT_US is
+ *          caught by the align. Once found, the PLL and observer are seeded and coast until the pulse current has
+ *          decayed, while the drive preloads its duty at the back-EMF, before the observer takes over.
+ */
+static void _sensorless_update_catch(Esc_t *esc, const float i_ab[2], uint32_t dt_us)
+{
+    EscSensorless_t *s = &esc->sensorless;
+    const float catch_A = esc->config.limits.max_phase_current_A * SENSORLESS_CATCH_CURRENT_FRACTION;
+
+    if (s->catch_pulses >= 2U) {
+        /* The drive takes over once the last pulse's current has gone back to the bus */
+        if (esc->phase_current_max_A >= catch_A) {
+            return;
+        }
+        s->failed_starts = 0U;
+        if (fabsf(s->pll_speed_rad_s) >= _sensorless_rpm_to_rad_s(esc, SENSORLESS_HANDOVER_RPM)) {
+            _sensorless_enter(s, ESC_SENSORLESS_STATE_RUN);
+        } else {
+            _sensorless_enter_align(esc);
+        }
+        return;
+    }
+
+    s->catch_time_us += dt_us;
+    /* The current left by a pulse is back on the bus through the diodes within a period; the gap lets the rotor
+     * turn far enough for the speed to show over the angle error of the pulses */
+    if (!(esc->inverter_cmd.enable && esc->inverter_cmd.brake)) {
+        s->catch_short = (s->catch_pulses == 0U) || (s->catch_time_us >= SENSORLESS_CATCH_GAP_US);
+        s->state_time_us = 0U;
+        return;
+    }
+    if (esc->phase_current_max_A < catch_A) {
+        if (s->state_time_us >= SENSORLESS_CATCH_TIMEOUT_US) {
+            _sensorless_enter_align(esc);
+        }
+        return;
+    }
+
+    s->catch_short = false;
+    const uint16_t current_angle = trig_atan2(i_ab[1], i_ab[0]);
+    if (s->catch_pulses == 0U) {
+        s->catch_pulses = 1U;
+        s->catch_angle = current_angle;
+        s->catch_time_us = 0U;
+        return;
+    }
+
+    /* The rotor angle is a quarter turn behind the current forwards, ahead of it backwards. The current integrates
+     * the back-EMF over the pulse, so it points where the rotor was half the pulse ago. */
+    const int16_t turned = (int16_t)(uint16_t)(current_angle - s->catch_angle);
+    const float speed_rad_s = (float)turned / TRIG_ANGLE_COUNTS_PER_RAD /
+                              ((float)s->catch_time_us / MICROSECONDS_PER_SECOND);
+    const float half_pulse_rad = 0.5f * speed_rad_s * (float)s->state_time_us / MICROSECONDS_PER_SECOND;
+    const uint16_t angle =
+        (uint16_t)(current_angle + ((turned >= 0) ? -TRIG_ANGLE_QUARTER_TURN : TRIG_ANGLE_QUARTER_TURN) +
+                   (int16_t)(half_pulse_rad * TRIG_ANGLE_COUNTS_PER_RAD));
+    s->catch_pulses = 2U;
+    s->pll_angle = (float)angle;
+    s->pll_speed_rad_s = speed_rad_s;
+
+    /* Rotor flux is half a turn from the angle */
+    const float lambda_Wb = esc->config.motor_config.flux_linkage_Wb;
+    float cos_angle;
+    float sin_angle;
+    trig_sincos((uint16_t)(angle + TRIG_ANGLE_HALF_TURN), &sin_angle, &cos_angle);
+    s->flux_Wb[0] = lambda_Wb * cos_angle + esc->config.motor_config.phase_inductance_H * i_ab[0];
+    s->flux_Wb[1] = lambda_Wb * sin_angle + esc->config.motor_config.phase_inductance_H * i_ab[1];
+}
+
+/**
+ * @brief   Step the align, open-loop and run states on the drive the output stage applied last period
+ */
+static void _sensorless_update_startup(Esc_t *esc, const float i_ab[2], uint32_t dt_us)
+{
+    EscSensorless_t *s = &esc->sensorless;
+    const float lambda_Wb = esc->config.motor_config.flux_linkage_Wb;
+    const float dt_s = (float)dt_us / MICROSECONDS_PER_SECOND;
+    const float start_A = esc->config.limits.max_phase_current_A * SENSORLESS_STARTUP_CURRENT_FRACTION;
+    const float handover_rad_s = _sensorless_rpm_to_rad_s(esc, SENSORLESS_HANDOVER_RPM);
+    const float dir = (esc->direction_state == ESC_DIRECTION_STATE_REVERSE) ? -1.0f : 1.0f;
+    const bool driving = s->drive_requested;
+
+    if (s->state_time_us < UINT32_MAX - dt_us) {
+        s->state_time_us += dt_us;
+    }
+
+    /* Braking runs on the observer, picked up again after a short coast; anything else without drive idles, and a
+     * start is only ever begun from idle */
+    if (!driving) {
+        s->current_A = 0.0f;
+        const bool tracked = (s->state == ESC_SENSORLESS_STATE_RUN) ||
+                             (s->state == ESC_SENSORLESS_STATE_IDLE && s->state_time_us < SENSORLESS_COAST_TIMEOUT_US);
+        if (esc->direction_state == ESC_DIRECTION_STATE_BRAKING && tracked) {
+            if (s->state != ESC_SENSORLESS_STATE_RUN) {
+                _sensorless_enter(s, ESC_SENSORLESS_STATE_RUN);
+            }
+            return;
+        }
+        if (s->state != ESC_SENSORLESS_STATE_IDLE) {
+            _sensorless_enter(s, ESC_SENSORLESS_STATE_IDLE);
+        }
+        if (s->state_time_us >= SENSORLESS_COAST_TIMEOUT_US) {
+            s->pll_speed_rad_s = 0.0f;
+        }
+        return;
+    }
+
+    switch (s->state) {
+        case ESC_SENSORLESS_STATE_IDLE:
+            /* After a short coast the PLL still has the rotor, otherwise look for it */
+            if (s->state_time_us >= SENSORLESS_COAST_TIMEOUT_US) {
+                _sensorless_enter(s, ESC_SENSORLESS_STATE_CATCH);
+                s->catch_short = true;
+                s->catch_pulses = 0U;
+                s->catch_time_us = 0U;
+                s->current_A = 0.0f;
+                esc->sine_lead = 0.0f;
+            } else if (fabsf(s->pll_speed_rad_s) >= handover_rad_s) {
+                _sensorless_enter(s, ESC_SENSORLESS_STATE_RUN);
+            } else {
+                _sensorless_enter_align(esc);
+            }
+            break;
+
+        case ESC_SENSORLESS_STATE_CATCH:
+            _sensorless_update_catch(esc, i_ab, dt_us);
+            break;
+
+        case ESC_SENSORLESS_STATE_ALIGN: {
+            /* Ramp up over the first half, then step a quarter turn on and let the rotor settle. A rotor sitting
+             * half a turn from a single align angle would feel no torque, and one a quarter turn from it would
+             * swing right through; from the first angle it is at most a quarter turn out. */
+            const float ramp = 2.0f * (float)s->state_time_us / (float)SENSORLESS_ALIGN_TIME_US;
+            s->current_A = start_A * ((ramp < 1.0f) ? ramp : 1.0f);
+            if (s->state_time_us >= SENSORLESS_ALIGN_TIME_US / 2U &&
+                s->state_time_us - dt_us < SENSORLESS_ALIGN_TIME_US / 2U) {
+                s->open_loop_angle = _sensorless_wrap_angle(s->open_loop_angle + dir * TRIG_ANGLE_QUARTER_TURN);
+            }
+            if (s->state_time_us >= SENSORLESS_ALIGN_TIME_US) {
+                _sensorless_enter(s, ESC_SENSORLESS_STATE_OPEN_LOOP);
+            }
+            break;
+        }
+
+        case ESC_SENSORLESS_STATE_OPEN_LOOP: {
+            s->current_A = start_A;
+            s->open_loop_speed_rad_s +=
+                dir * _sensorless_rpm_to_rad_s(esc, SENSORLESS_OPEN_LOOP_ACCEL_RPM_PER_S) * dt_s;
+            if (dir * s->open_loop_speed_rad_s > handover_rad_s) {
+                s->open_loop_speed_rad_s = dir * handover_rad_s;
+            }
+            s->open_loop_angle = _sensorless_wrap_angle(s->open_loop_angle + s->open_loop_speed_rad_s * dt_s *
+                                                                                 TRIG_ANGLE_COUNTS_PER_RAD);
+
+            /* Converged once the PLL follows the open-loop speed on a flux of the right size */
+            const float speed_error = s->pll_speed_rad_s - s->open_loop_speed_rad_s;
+            const float flux_error = s->flux_magnitude_Wb - lambda_Wb;
+            const bool tracking =
+                fabsf(speed_error) < SENSORLESS_CONVERGE_SPEED_TOLERANCE * dir * s->open_loop_speed_rad_s &&
+                fabsf(flux_error) < SENSORLESS_CONVERGE_FLUX_TOLERANCE * lambda_Wb;
+            s->converged_us = tracking ? s->converged_us + dt_us : 0U;
+
+            if (dir * s->open_loop_speed_rad_s >= handover_rad_s && s->converged_us >= SENSORLESS_CONVERGE_TIME_US) {
+                /* Keep the drive angle where the open loop had it; the lead then trims itself */
+                const float max_lead = SINE_MAX_LEAD_DEG * (TRIG_ANGLE_COUNTS / 360.0f);
+                float lead = dir * (float)(int16_t)(uint16_t)((uint16_t)(uint32_t)s->open_loop_angle -
+                                                              (uint16_t)(uint32_t)s->pll_angle);
+                lead = (lead < 0.0f) ? 0.0f : ((lead > max_lead) ? max_lead : lead);
+                esc->sine_lead = lead;
+                s->current_A = 0.0f;
+                s->failed_starts = 0U;
+                _sensorless_enter(s, ESC_SENSORLESS_STATE_RUN);
+                break;
+            }
+
+            const uint32_t ramp_us = (uint32_t)(SENSORLESS_HANDOVER_RPM / SENSORLESS_OPEN_LOOP_ACCEL_RPM_PER_S *
+                                                MICROSECONDS_PER_SECOND);
+            if (s->state_time_us >= ramp_us + SENSORLESS_STARTUP_TIMEOUT_US) {
+                if (++s->failed_starts >= SENSORLESS_MAX_STARTS) {
+                    esc->fault_flags |= ESC_FAULT_STALL;
+                }
+                _sensorless_enter_align(esc);
+            }
+            break;
+        }
+
+        case ESC_SENSORLESS_STATE_RUN:
+        default:
+            /* Too slow for the observer: start over. Turning the other way, the drive brakes it first. */
+            if (fabsf(s->pll_speed_rad_s) < _sensorless_rpm_to_rad_s(esc, SENSORLESS_DROPOUT_RPM)) {
+                _sensorless_enter_align(esc);
+            }
+            break;
+    }
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+bool sensorless_init(const MotorConfig_t *cfg)
+{
+    if (cfg == NULL) {
+        return false;
+    }
+
+    return cfg->num_pole_pairs > 0U && cfg->flux_linkage_Wb > 0.0f && cfg->phase_resistance_Ohm >= 0.0f &&
+           cfg->phase_inductance_H >= 0.0f;
+}
+
+void sensorless_reset(Esc_t *esc)
+{
+    if (esc == NULL) {
+        return;
+    }
+
+    EscSensorless_t *s = &esc->sensorless;
+    *s = (EscSensorless_t){ 0 };
+    s->state = ESC_SENSORLESS_STATE_IDLE;
+    s->state_time_us = SENSORLESS_COAST_TIMEOUT_US;
+    /* Any flux of the right size converges once the rotor turns */
+    s->flux_Wb[0] = esc->config.motor_config.flux_linkage_Wb;
+}
+
+void sensorless_update_feedback(Esc_t *esc, uint32_t dt_us)
+{
+    if (esc == NULL || esc->is_initialized == false) {
+        return;
+    }
+
+    if (esc->config.feedback_mechanism != ESC_FEEDBACK_MECHANISM_SENSORLESS) {
+        return;
+    }
+
+    EscSensorless_t *s = &esc->sensorless;
+    const float *i_abc = esc->motor_state.phase_currents_A;
+    const float i_ab[2] = { i_abc[MOTOR_PHASE_A],
+                            SENSORLESS_INV_SQRT3 * (i_abc[MOTOR_PHASE_B] - i_abc[MOTOR_PHASE_C]) };
+
+    _sensorless_update_observer(esc, i_ab, dt_us);
+    s->current_prev_A[0] = i_ab[0];
+    s->current_prev_A[1] = i_ab[1];
+
+    /* The rotor flux lags the forward phase A back-EMF by half a turn */
+    const float eta_alpha = s->flux_Wb[0] - esc->config.motor_config.phase_inductance_H * i_ab[0];
+    const float eta_beta = s->flux_Wb[1] - esc->config.motor_config.phase_inductance_H * i_ab[1];
+    s->flux_magnitude_Wb = trig_sqrt(eta_alpha * eta_alpha + eta_beta * eta_beta);
+    s->observer_angle = (uint16_t)(trig_atan2(eta_beta, eta_alpha) + TRIG_ANGLE_HALF_TURN);
+    _sensorless_update_pll(s, esc->inverter_cmd.enable && s->state != ESC_SENSORLESS_STATE_CATCH, dt_us);
+
+    _sensorless_update_startup(esc, i_ab, dt_us);
+
+    /* While starting, the rotor follows the open loop; the observer is not trusted yet, nor the PLL while catching */
+    float speed_rad_s = sensorless_is_starting(esc) ? s->open_loop_speed_rad_s : s->pll_speed_rad_s;
+    if (s->state == ESC_SENSORLESS_STATE_CATCH && s->catch_pulses < 2U) {
+        speed_rad_s = 0.0f;
+    }
+    esc->velocity_mech_rpm =
+        speed_rad_s / (SENSORLESS_RAD_S_PER_RPM * (float)esc->config.motor_config.num_pole_pairs);
+    if (esc->velocity_mech_rpm > SENSORLESS_DIRECTION_MIN_RPM) {
+        esc->rotor_direction = 1;
+    } else if (esc->velocity_mech_rpm < -SENSORLESS_DIRECTION_MIN_RPM) {
+        esc->rotor_direction = -1;
+    } else {
+        esc->rotor_direction = 0;
+    }
+}
+
+uint16_t sensorless_get_angle(const Esc_t *esc, uint32_t dt_us)
+{
+    const EscSensorless_t *s = &esc->sensorless;
+    if (sensorless_is_starting(esc)) {
+        return (uint16_t)(uint32_t)s->open_loop_angle;
+    }
+    const float ahead = s->pll_speed_rad_s * (float)dt_us * 0.5e-6f * TRIG_ANGLE_COUNTS_PER_RAD;
+    return (uint16_t)(uint32_t)_sensorless_wrap_angle(s->pll_angle + ahead);
+}
+
+bool sensorless_is_starting(const Esc_t *esc)
+{
+    return esc->sensorless.state == ESC_SENSORLESS_STATE_ALIGN ||
+           esc->sensorless.state == ESC_SENSORLESS_STATE_OPEN_LOOP;
+}
@@ -16,6 +16,7 @@
 #include "motor.h"
 
 /* Intra-component Headers */
+#include "hal_motor.h"
 
 /**
  * @defgroup HalAdc HAL ADC module
@@ -36,29 +37,32 @@
  *******************************************************************************************************************************/
 
 /**
- * @brief   Initializes the ADC abstraction layer
+ * @brief   Initializes the ADC abstraction layer of every inverter
  */
 void hal_adc_init(void);
 
 /**
  * @brief   Gets the latest measured phase currents
+ * @param   motor Inverter
  * @param   phase_currents_A Output array of phase currents in amperes
  * @return  True if the measurement is valid, false otherwise
  */
-bool hal_adc_get_phase_currents(float phase_currents_A[NUM_MOTOR_PHASES]);
+bool hal_adc_get_phase_currents(HalMotor_t motor, float phase_currents_A[NUM_MOTOR_PHASES]);
 
 /**
  * @brief   Gets the latest measured DC bus voltage
+ * @param   motor Inverter
  * @param   bus_voltage_V Pointer to output bus voltage in volts
  * @return  True if the measurement is valid, false otherwise
  */
-bool hal_adc_get_bus_voltage(float *bus_voltage_V);
+bool hal_adc_get_bus_voltage(HalMotor_t motor, float *bus_voltage_V);
 
 /**
  * @brief   Gets the latest measured temperature
+ * @param   motor Inverter
  * @param   temperature_C Pointer to output temperature in degrees Celsius
  * @return  True if the measurement is valid, false otherwise
  */
-bool hal_adc_get_temperature(float *temperature_C);
+bool hal_adc_get_temperature(HalMotor_t motor, float *temperature_C);
 
 /** @} */
\ No newline at end of file
@@ -16,6 +16,7 @@
 /* Inter-component Headers */
 
 /* Intra-component Headers */
+#include "hal_motor.h"
 
 /**
  * @defgroup HalFault HAL fault module
@@ -47,31 +48,35 @@ typedef enum {
  *******************************************************************************************************************************/
 
 /**
- * @brief   Initializes the fault abstraction layer
+ * @brief   Initializes the fault abstraction layer of every inverter
  */
 void hal_fault_init(void);
 
 /**
  * @brief   Checks whether the nFAULT condition is currently active
+ * @param   motor Inverter
  * @return  True if a fault is active, false otherwise
  */
-bool hal_fault_is_active(void);
+bool hal_fault_is_active(HalMotor_t motor);
 
 /**
  * @brief   Gets the currently active platform fault, if known
+ * @param   motor Inverter
  * @return  Current fault type
  */
-HalFault_t hal_fault_get(void);
+HalFault_t hal_fault_get(HalMotor_t motor);
 
 /**
  * @brief   Clears the currently active platform fault
+ * @param   motor Inverter
  */
-void hal_fault_clear(void);
+void hal_fault_clear(HalMotor_t motor);
 
 /**
  * @brief   Checks whether the power stage is ready to drive the external MOSFETs
+ * @param   motor Inverter
  * @return  True if the device is ready, false otherwise
  */
-bool hal_fault_is_ready(void);
+bool hal_fault_is_ready(HalMotor_t motor);
 
 /** @} */
\ No newline at end of file
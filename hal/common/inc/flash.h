@@ -0,0 +1,70 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   flash.h
+ *
+ * @brief  Header file for the HAL flash module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HalFlash HAL flash module
+ * @brief    Hardware abstraction layer interface for the flash sectors reserved for parameters
+ * @details  The region is HAL_FLASH_NUM_SECTORS sectors of HAL_FLASH_SECTOR_SIZE bytes, addressed from 0. It is memory
+ *           mapped, so reads go through hal_flash_get_region(). Programming can only clear bits, in aligned units
+ *           of HAL_FLASH_WRITE_SIZE bytes that must be erased first; erasing sets a whole sector back to
+ *           HAL_FLASH_ERASED_BYTE. A reset during either leaves the bytes involved undefined.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HAL_FLASH_SECTOR_SIZE 2048U  /* Erase unit: one STM32G4 page */
+#define HAL_FLASH_NUM_SECTORS 4U     /* Sectors reserved for parameters */
+#define HAL_FLASH_SIZE (HAL_FLASH_SECTOR_SIZE * HAL_FLASH_NUM_SECTORS)
+#define HAL_FLASH_WRITE_SIZE 8U      /* Program unit: one double word */
+#define HAL_FLASH_ERASED_BYTE 0xFFU  /* Value of every byte of an erased sector */
+
+/*******************************************************************************************************************************
+ * Variables
+ *******************************************************************************************************************************/
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Gets the memory-mapped flash region
+ * @return  First byte of the region, NULL if there is no flash
+ */
+const uint8_t *hal_flash_get_region(void);
+
+/**
+ * @brief   Erases one sector, blocking until done
+ * @param   sector Sector index below HAL_FLASH_NUM_SECTORS
+ * @return  true if erased, false on a bad index or a flash error
+ */
+bool hal_flash_erase(uint32_t sector);
+
+/**
+ * @brief   Programs erased flash, blocking until done
+ * @param   address Offset in the region, a multiple of HAL_FLASH_WRITE_SIZE
+ * @param   data Data to program
+ * @param   len Length in bytes, a multiple of HAL_FLASH_WRITE_SIZE
+ * @return  true if programmed, false on a bad range or a flash error
+ */
+bool hal_flash_program(uint32_t address, const void *data, uint32_t len);
+
+/** @} */
@@ -16,6 +16,7 @@
 /* Inter-component Headers */
 
 /* Intra-component Headers */
+#include "hal_motor.h"
 
 /**
  * @defgroup HalGpio HAL GPIO module
@@ -36,20 +37,22 @@
  *******************************************************************************************************************************/
 
 /**
- * @brief   Initializes the GPIO abstraction layer
+ * @brief   Initializes the GPIO abstraction layer of every inverter
  */
 void hal_gpio_init(void);
 
 /**
  * @brief   Gets the current Hall sensor state
+ * @param   motor Inverter
  * @return  Three-bit Hall sensor state
  */
-uint8_t hal_gpio_get_hall_state(void);
+uint8_t hal_gpio_get_hall_state(HalMotor_t motor);
 
 /**
  * @brief   Gets the timestamp of the most recent Hall transition
- * @return  Timestamp in microseconds
+ * @param   motor Inverter
+ * @return  Timestamp in HAL_TIME_TICKS_PER_US timer ticks, low 32 bits of hal_time_get_ticks()
  */
-uint32_t hal_gpio_get_hall_timestamp_us(void);
+uint32_t hal_gpio_get_hall_timestamp_ticks(HalMotor_t motor);
 
 /** @} */
\ No newline at end of file
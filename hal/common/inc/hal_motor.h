@@ -0,0 +1,40 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   hal_motor.h
+ *
+ * @brief  Header file for the HAL motor channel definitions
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HalMotor HAL motor channels
+ * @brief    Inverters on the board, each with its own PWM timer, current and voltage sensing, Hall inputs and
+ *           gate driver fault line
+ * @details  The per-motor HAL calls take the inverter to act on, so any number of ESC instances can run on one
+ *           board without sharing peripheral state. The timebase, flash and throttle input are board-wide.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Inverters on the board
+ */
+typedef enum {
+    HAL_MOTOR_0,   /**< First inverter, the PWM timebase master */
+    HAL_MOTOR_1,   /**< Second inverter */
+    NUM_HAL_MOTORS
+} HalMotor_t;
+
+/** @} */
@@ -0,0 +1,131 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   hal_time.h
+ *
+ * @brief  Header file for the HAL time module
+ *
+ * @date   2026-03-18
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HalTime HAL time module
+ * @brief    Hardware abstraction layer interface for system timekeeping
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HAL_TIME_TICKS_PER_US 16U /* Timer tick rate, 62.5 nanoseconds */
+#define HAL_TIME_TICKS_PER_MS (HAL_TIME_TICKS_PER_US * 1000U)
+
+/* Execution-time counter rate, the core clock on a target; the host counts nanoseconds */
+#ifndef HAL_TIME_CYCLES_PER_US
+#define HAL_TIME_CYCLES_PER_US 1000U
+#endif
+
+/*******************************************************************************************************************************
+ * Variables
+ *******************************************************************************************************************************/
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initializes the time abstraction layer
+ * @return  True if processor time is successfully acquired, false otherwise.
+ */
+void hal_time_init(void);
+
+/**
+ * @brief   Gets the current monotonic time in timer ticks
+ * @details 64 bits of HAL_TIME_TICKS_PER_US ticks do not wrap within the lifetime of a deployment.
+ * @return  Ticks since hal_time_init()
+ */
+uint64_t hal_time_get_ticks(void);
+
+/**
+ * @brief   Gets the current system time in milliseconds
+ * @return  Current time in milliseconds, wraps every ~49 days
+ */
+uint32_t hal_time_get_ms(void);
+
+/**
+ * @brief   Gets the current system time in microseconds
+ * @return  Current time in microseconds, wraps every ~71 minutes
+ */
+uint32_t hal_time_get_us(void);
+
+/**
+ * @brief   Gets the current monotonic time in microseconds
+ * @return  Microseconds since hal_time_init()
+ */
+uint64_t hal_time_get_us64(void);
+
+/**
+ * @brief   Gets the free-running execution-time counter, for measuring code run time
+ * @details Unlike the timer ticks this counts real processor time on every platform, also on the host where the
+ *          timebase is simulated. Wraps; take differences with hal_time_elapsed_ticks32().
+ * @return  Counter value in HAL_TIME_CYCLES_PER_US cycles
+ */
+uint32_t hal_time_get_cycles(void);
+
+/**
+ * @brief   Elapsed ticks between two truncated 32-bit tick timestamps
+ * @details Modular subtraction, so the result is correct across a counter wrap for intervals shorter than 2^32 ticks
+ *          (~268 s at 16 ticks per microsecond) without any branch.
+ * @param   now_ticks Later timestamp
+ * @param   then_ticks Earlier timestamp
+ * @return  Elapsed ticks
+ */
+static inline uint32_t hal_time_elapsed_ticks32(uint32_t now_ticks, uint32_t then_ticks) {
+    return (uint32_t)(now_ticks - then_ticks);
+}
+
+/**
+ * @brief   Elapsed ticks between two monotonic tick timestamps
+ * @param   now_ticks Later timestamp
+ * @param   then_ticks Earlier timestamp
+ * @return  Elapsed ticks
+ */
+static inline uint64_t hal_time_elapsed_ticks(uint64_t now_ticks, uint64_t then_ticks) {
+    return now_ticks - then_ticks;
+}
+
+/**
+ * @brief   Converts timer ticks to whole microseconds
+ * @param   ticks Timer ticks
+ * @return  Microseconds, truncated
+ */
+static inline uint64_t hal_time_ticks_to_us(uint64_t ticks) {
+    return ticks / HAL_TIME_TICKS_PER_US;
+}
+
+/**
+ * @brief   Converts microseconds to timer ticks
+ * @param   us Microseconds
+ * @return  Timer ticks
+ */
+static inline uint64_t hal_time_us_to_ticks(uint64_t us) {
+    return us * HAL_TIME_TICKS_PER_US;
+}
+
+/**
+ * @brief   Delays execution for the specified number of milliseconds
+ * @param   delay_ms Delay duration in milliseconds
+ */
+void hal_time_delay_ms(uint32_t delay_ms);
+
+/** @} */
\ No newline at end of file
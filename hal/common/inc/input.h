@@ -0,0 +1,149 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   input.h
+ *
+ * @brief  Header file for the HAL throttle input module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HalInput HAL throttle input module
+ * @brief    Hardware abstraction layer interface for the throttle signal: servo PWM or DShot150/300/600
+ * @details  The platform captures the timer count at every edge of the input pin, both polarities, into a DMA ring
+ *           of HAL_INPUT_CAPTURE_SIZE entries, and counts the edges. The pin idles low when capture starts, so
+ *           even edge numbers are rising edges. hal_input_update() decodes every edge captured since the last call
+ *           in one pass over the ring, instead of taking an interrupt per edge.
+ *
+ *           Servo PWM: a 1000 to 2000 us pulse is 0 to full throttle; pulses outside HAL_INPUT_PWM_MIN_US to
+ *           HAL_INPUT_PWM_MAX_US are rejected. DShot: a frame is 16 bits, each a rising edge every bit period
+ *           with a high time of 3/4 (one) or 3/8 (zero) of it, after a low gap of at least two bit periods. The
+ *           bits are an 11-bit value, the telemetry request bit and a 4-bit CRC. Value 0 is disarmed, 1 to 47 are
+ *           commands and 48 to 2047 the throttle.
+ *
+ *           A missed edge swaps the polarities of all that follow. Frames then fail to decode, and after
+ *           HAL_INPUT_RESYNC_PULSES pulses without a good frame the decoder swaps its polarity back. For servo PWM
+ *           this needs the low time to be longer than HAL_INPUT_PWM_MAX_US, i.e. frame rates up to about 240 Hz.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HAL_INPUT_CAPTURE_TICKS_PER_US 48U   /* Capture timer rate, 48 MHz: 80 ticks per DShot600 bit */
+#define HAL_INPUT_CAPTURE_SIZE 256U          /* Edges held by the capture ring, eight DShot frames */
+#define HAL_INPUT_PWM_MIN_US 900U            /* Shortest servo pulse accepted */
+#define HAL_INPUT_PWM_MAX_US 2100U           /* Longest servo pulse accepted */
+#define HAL_INPUT_PWM_ZERO_US 1000U          /* Servo pulse for zero throttle */
+#define HAL_INPUT_PWM_FULL_US 2000U          /* Servo pulse for full throttle */
+#define HAL_INPUT_DSHOT_BITS 16U
+#define HAL_INPUT_DSHOT_MIN_THROTTLE 48U     /* Lowest DShot throttle value; below are disarm and commands */
+#define HAL_INPUT_DSHOT_MAX_THROTTLE 2047U
+#define HAL_INPUT_DSHOT_TOLERANCE_DIV 4U     /* Bit period error accepted: a quarter of the period */
+#define HAL_INPUT_RESYNC_PULSES 40U          /* Pulses in a row without a good frame before the edge polarity is
+                                                swapped: over two DShot frames */
+
+/**
+ * @brief   Throttle input protocols
+ */
+typedef enum {
+    HAL_INPUT_PROTOCOL_PWM,      /**< Servo PWM, 1000 to 2000 us */
+    HAL_INPUT_PROTOCOL_DSHOT150, /**< DShot at 150 kbit/s */
+    HAL_INPUT_PROTOCOL_DSHOT300, /**< DShot at 300 kbit/s */
+    HAL_INPUT_PROTOCOL_DSHOT600, /**< DShot at 600 kbit/s */
+    NUM_HAL_INPUT_PROTOCOLS
+} HalInputProtocol_t;
+
+/**
+ * @brief   One decoded throttle frame
+ */
+typedef struct {
+    float throttle;              /**< Throttle [0.0, 1.0], 0 when disarmed or for a DShot command */
+    uint16_t value;              /**< DShot 11-bit value, or servo pulse width in microseconds */
+    bool telemetry_request;      /**< DShot telemetry request bit */
+    uint32_t timestamp_ticks;    /**< Capture count of the frame's first rising edge */
+} HalInputFrame_t;
+
+/**
+ * @brief   Decoder counters
+ */
+typedef struct {
+    uint32_t frames;             /**< Frames decoded */
+    uint32_t errors;             /**< Frames rejected for their timing, pulse width or CRC */
+    uint32_t overruns;           /**< Times the ring was overwritten before it was decoded */
+    uint32_t resyncs;            /**< Edge polarity swaps after repeated errors */
+} HalInputStats_t;
+
+/**
+ * @brief   Edge decoder state, independent of the platform
+ */
+typedef struct {
+    HalInputProtocol_t protocol; /**< Protocol decoded */
+    uint32_t bit_ticks;          /**< DShot bit period */
+    uint32_t read;               /**< Edge number of the next edge to decode, always a rising edge */
+    uint32_t rising_parity;      /**< Parity of the rising edges' numbers, 0 until a resync */
+    uint32_t prev_fall_ticks;    /**< Capture count of the last falling edge decoded */
+    bool has_prev_fall;          /**< prev_fall_ticks is valid */
+    uint32_t error_run;          /**< Pulses since the last good frame */
+    HalInputStats_t stats;       /**< Counters */
+} HalInputDecoder_t;
+
+/*******************************************************************************************************************************
+ * Variables
+ *******************************************************************************************************************************/
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initializes the throttle input and starts capturing
+ * @param   protocol Protocol to decode
+ */
+void hal_input_init(HalInputProtocol_t protocol);
+
+/**
+ * @brief   Decodes the edges captured since the last call
+ * @param   frame Output newest good frame, left untouched if there is none
+ * @return  Number of good frames decoded
+ */
+uint32_t hal_input_update(HalInputFrame_t *frame);
+
+/**
+ * @brief   Gets the decoder counters
+ * @return  Counters since hal_input_init()
+ */
+HalInputStats_t hal_input_get_stats(void);
+
+/**
+ * @brief   Resets a decoder to the start of a capture
+ * @param   decoder Decoder
+ * @param   protocol Protocol to decode
+ * @param   count Edges already captured, the first to decode
+ * @param   idle_ticks Capture count since which the line has been idle low, so the first frame follows a gap
+ */
+void hal_input_decoder_init(HalInputDecoder_t *decoder, HalInputProtocol_t protocol, uint32_t count,
+                            uint32_t idle_ticks);
+
+/**
+ * @brief   Decodes the edges of a capture ring up to the given edge count, leaving an incomplete frame for later
+ * @param   decoder Decoder
+ * @param   ring Capture counts, edge n at ring[n % HAL_INPUT_CAPTURE_SIZE]
+ * @param   count Edges captured so far, wrapping
+ * @param   frame Output newest good frame, left untouched if there is none
+ * @return  Number of good frames decoded
+ */
+uint32_t hal_input_decode(HalInputDecoder_t *decoder, const uint32_t *ring, uint32_t count, HalInputFrame_t *frame);
+
+/** @} */
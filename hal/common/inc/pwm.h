@@ -11,11 +11,13 @@
 
 /* Standard library Headers */
 #include <stdbool.h>
+#include <stdint.h>
 
 /* Inter-component Headers */
 #include "esc.h"
 
 /* Intra-component Headers */
+#include "hal_motor.h"
 
 /**
  * @defgroup HalPwm HAL PWM module
@@ -27,6 +29,13 @@
  * Private defines and enums
  *******************************************************************************************************************************/
 
+#define HAL_PWM_FREQUENCY_HZ 20000U /* Inverter switching frequency */
+#define HAL_PWM_PERIOD_US (1000000U / HAL_PWM_FREQUENCY_HZ) /* PWM period, one update event per period */
+
+/* Carrier phase of an inverter: the periods of the inverters start evenly spread over one period, so their DC-link
+ * current pulses interleave instead of adding up in the bus capacitors */
+#define HAL_PWM_PHASE_US(motor) ((HAL_PWM_PERIOD_US * (uint32_t)(motor)) / NUM_HAL_MOTORS)
+
 /*******************************************************************************************************************************
  * Variables
  *******************************************************************************************************************************/
@@ -36,25 +45,32 @@
  *******************************************************************************************************************************/
 
 /**
- * @brief   Initializes the PWM abstraction layer
+ * @brief   Initializes the PWM abstraction layer of every inverter, with the carriers at HAL_PWM_PHASE_US()
  */
 void hal_pwm_init(void);
 
 /**
  * @brief   Applies an ESC inverter command to the platform PWM outputs
+ * @details Only the per-phase fields (phase_duty, enable masks, dead time, alignment) drive the switches. The
+ *          command is written to shadow registers and takes effect as a whole at the next PWM update event, so it
+ *          may be called at any point in the PWM period without the bridge seeing a partially written command.
+ * @param   motor Inverter
  * @param   cmd Inverter command to apply
  */
-void hal_pwm_apply_inverter_cmd(const EscInverterCmd_t *cmd);
+void hal_pwm_apply_inverter_cmd(HalMotor_t motor, const EscInverterCmd_t *cmd);
 
 /**
  * @brief   Disables all inverter PWM outputs
+ * @details Takes effect immediately and discards any command not yet latched.
+ * @param   motor Inverter
  */
-void hal_pwm_disable_outputs(void);
+void hal_pwm_disable_outputs(HalMotor_t motor);
 
 /**
  * @brief   Returns whether inverter PWM outputs are currently enabled
+ * @param   motor Inverter
  * @return  True if outputs are enabled, false otherwise
  */
-bool hal_pwm_outputs_enabled(void);
+bool hal_pwm_outputs_enabled(HalMotor_t motor);
 
 /** @} */
\ No newline at end of file
@@ -0,0 +1,195 @@
+/*******************************************************************************************************************************
+ * @file   input.c
+ *
+ * @brief  Source file for the HAL throttle input decoders
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "input.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#if (HAL_INPUT_CAPTURE_SIZE & (HAL_INPUT_CAPTURE_SIZE - 1U)) != 0U
+#error "HAL_INPUT_CAPTURE_SIZE must be a power of two"
+#endif
+
+#define HAL_INPUT_RING_MASK (HAL_INPUT_CAPTURE_SIZE - 1U)
+#define HAL_INPUT_DSHOT_EDGES (2U * HAL_INPUT_DSHOT_BITS)
+#define HAL_INPUT_DSHOT_FRAME_GAP_BITS 2U  /* Low time before a frame, in bit periods; between bits it is under one */
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const uint32_t input_dshot_kbit_s[NUM_HAL_INPUT_PROTOCOLS] = {
+    [HAL_INPUT_PROTOCOL_PWM] = 0U,
+    [HAL_INPUT_PROTOCOL_DSHOT150] = 150U,
+    [HAL_INPUT_PROTOCOL_DSHOT300] = 300U,
+    [HAL_INPUT_PROTOCOL_DSHOT600] = 600U,
+};
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Decode a servo pulse
+ */
+static bool _hal_input_pwm_frame(uint32_t rise_ticks, uint32_t fall_ticks, HalInputFrame_t *frame)
+{
+    const uint32_t width_us =
+        (fall_ticks - rise_ticks + HAL_INPUT_CAPTURE_TICKS_PER_US / 2U) / HAL_INPUT_CAPTURE_TICKS_PER_US;
+    if (width_us < HAL_INPUT_PWM_MIN_US || width_us > HAL_INPUT_PWM_MAX_US) {
+        return false;
+    }
+
+    float throttle = (float)((int32_t)width_us - (int32_t)HAL_INPUT_PWM_ZERO_US) /
+                     (float)(HAL_INPUT_PWM_FULL_US - HAL_INPUT_PWM_ZERO_US);
+    throttle = (throttle < 0.0f) ? 0.0f : ((throttle > 1.0f) ? 1.0f : throttle);
+    frame->throttle = throttle;
+    frame->value = (uint16_t)width_us;
+    frame->telemetry_request = false;
+    frame->timestamp_ticks = rise_ticks;
+    return true;
+}
+
+/**
+ * @brief   Decode the DShot frame whose first rising edge is edge number start
+ */
+static bool _hal_input_dshot_frame(const HalInputDecoder_t *decoder, const uint32_t *ring, uint32_t start,
+                                   HalInputFrame_t *frame)
+{
+    /* A one is high for 3/4 of the bit and a zero for 3/8, so split at 9/16 */
+    const uint32_t bit_ticks = decoder->bit_ticks;
+    const uint32_t min_bit_ticks = bit_ticks - bit_ticks / HAL_INPUT_DSHOT_TOLERANCE_DIV;
+    const uint32_t max_bit_ticks = bit_ticks + bit_ticks / HAL_INPUT_DSHOT_TOLERANCE_DIV;
+    const uint32_t one_ticks = (9U * bit_ticks) / 16U;
+
+    uint32_t bits = 0U;
+    uint32_t rise = ring[start & HAL_INPUT_RING_MASK];
+    for (uint32_t i = 0U; i < HAL_INPUT_DSHOT_BITS; ++i) {
+        const uint32_t fall = ring[(start + 2U * i + 1U) & HAL_INPUT_RING_MASK];
+        const uint32_t high = fall - rise;
+        if (high >= max_bit_ticks) {
+            return false;
+        }
+        /* The last bit has no next rising edge, so only its high time is checked */
+        if (i + 1U < HAL_INPUT_DSHOT_BITS) {
+            const uint32_t next_rise = ring[(start + 2U * i + 2U) & HAL_INPUT_RING_MASK];
+            const uint32_t period = next_rise - rise;
+            if (period < min_bit_ticks || period > max_bit_ticks) {
+                return false;
+            }
+            rise = next_rise;
+        }
+        bits = (bits << 1) | ((high > one_ticks) ? 1U : 0U);
+    }
+
+    const uint32_t payload = bits >> 4;
+    const uint32_t crc = (payload ^ (payload >> 4) ^ (payload >> 8)) & 0x0FU;
+    if (crc != (bits & 0x0FU)) {
+        return false;
+    }
+
+    const uint32_t value = payload >> 1;
+    const float span = (float)(HAL_INPUT_DSHOT_MAX_THROTTLE - HAL_INPUT_DSHOT_MIN_THROTTLE);
+    frame->throttle = (value >= HAL_INPUT_DSHOT_MIN_THROTTLE) ? (float)(value - HAL_INPUT_DSHOT_MIN_THROTTLE) / span : 0.0f;
+    frame->value = (uint16_t)value;
+    frame->telemetry_request = ((payload & 1U) != 0U);
+    frame->timestamp_ticks = ring[start & HAL_INPUT_RING_MASK];
+    return true;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void hal_input_decoder_init(HalInputDecoder_t *decoder, HalInputProtocol_t protocol, uint32_t count,
+                            uint32_t idle_ticks)
+{
+    decoder->protocol = (protocol < NUM_HAL_INPUT_PROTOCOLS) ? protocol : HAL_INPUT_PROTOCOL_PWM;
+    decoder->bit_ticks = (input_dshot_kbit_s[decoder->protocol] > 0U) ?
+        (HAL_INPUT_CAPTURE_TICKS_PER_US * 1000U) / input_dshot_kbit_s[decoder->protocol] : 0U;
+    decoder->rising_parity = 0U;
+    decoder->read = count + (count & 1U);
+    /* The idle-low line counts as the fall before the first frame, so a DShot stream decodes from its first frame */
+    decoder->prev_fall_ticks = idle_ticks;
+    decoder->has_prev_fall = true;
+    decoder->error_run = 0U;
+    decoder->stats = (HalInputStats_t){ 0 };
+}
+
+uint32_t hal_input_decode(HalInputDecoder_t *decoder, const uint32_t *ring, uint32_t count, HalInputFrame_t *frame)
+{
+    if (decoder == NULL || ring == NULL || frame == NULL) {
+        return 0U;
+    }
+
+    /* Edges overwritten before they were read are lost; restart at the oldest rising edge held */
+    if (count - decoder->read > HAL_INPUT_CAPTURE_SIZE && (int32_t)(count - decoder->read) > 0) {
+        decoder->read = count - HAL_INPUT_CAPTURE_SIZE;
+        decoder->read += (decoder->read ^ decoder->rising_parity) & 1U;
+        decoder->has_prev_fall = false;
+        decoder->stats.overruns++;
+    }
+
+    const bool dshot = (decoder->protocol != HAL_INPUT_PROTOCOL_PWM);
+    const uint32_t frame_gap_ticks = HAL_INPUT_DSHOT_FRAME_GAP_BITS * decoder->bit_ticks;
+    uint32_t frames = 0U;
+    while ((int32_t)(count - decoder->read) >= 2) {
+        const uint32_t rise = ring[decoder->read & HAL_INPUT_RING_MASK];
+        bool ok;
+        uint32_t edges;
+        if (!dshot) {
+            ok = _hal_input_pwm_frame(rise, ring[(decoder->read + 1U) & HAL_INPUT_RING_MASK], frame);
+            edges = 2U;
+        } else if (!decoder->has_prev_fall || rise - decoder->prev_fall_ticks <= frame_gap_ticks) {
+            /* Not after a frame gap: part of a frame whose start was missed */
+            decoder->prev_fall_ticks = ring[(decoder->read + 1U) & HAL_INPUT_RING_MASK];
+            decoder->has_prev_fall = true;
+            decoder->read += 2U;
+            decoder->error_run++;
+            ok = true;
+            edges = 0U;
+        } else if (count - decoder->read < HAL_INPUT_DSHOT_EDGES) {
+            break;
+        } else {
+            ok = _hal_input_dshot_frame(decoder, ring, decoder->read, frame);
+            edges = HAL_INPUT_DSHOT_EDGES;
+        }
+
+        if (edges > 0U) {
+            decoder->prev_fall_ticks = ring[(decoder->read + edges - 1U) & HAL_INPUT_RING_MASK];
+            decoder->has_prev_fall = true;
+            decoder->read += edges;
+            if (ok) {
+                frames++;
+                decoder->stats.frames++;
+                decoder->error_run = 0U;
+            } else {
+                decoder->stats.errors++;
+                decoder->error_run += edges / 2U;
+            }
+        }
+
+        /* Persistent failure means a missed edge swapped the polarities: swap back */
+        if (decoder->error_run >= HAL_INPUT_RESYNC_PULSES) {
+            decoder->rising_parity ^= 1U;
+            decoder->read++;
+            decoder->has_prev_fall = false;
+            decoder->error_run = 0U;
+            decoder->stats.resyncs++;
+        }
+    }
+    return frames;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_blackbox.h
+ *
+ * @brief  Header file for the host fault black-box export
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostBlackBox Host fault black-box export
+ * @brief    Writes the ESC black box as a CSV trace
+ * @details  The first seven columns are the replay trace format of the real-time runner
+ *           (time_us,ia,ib,ic,vbus,temp_C,hall), so `rt -f` replays the lead-up to a fault through the controller.
+ *           The controller's side follows: duty, fault_flags, hal_fault, direction_state and elec_angle. Comment
+ *           lines starting with '#' carry the trigger, and the replay skips them.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Write the black box of an ESC instance to a CSV file, oldest snapshot first
+ * @param   esc ESC instance
+ * @param   path Output file
+ * @return  true if written, false if the file could not be written or the black box is empty
+ */
+bool host_blackbox_write_csv(const Esc_t *esc, const char *path);
+
+/**
+ * @brief   Write the black box of an ESC instance as CSV to an open stream, oldest snapshot first
+ * @param   esc ESC instance
+ * @param   file Output stream, left open
+ * @return  true if written, false on a stream error or if the black box is empty
+ */
+bool host_blackbox_write(const Esc_t *esc, FILE *file);
+
+/** @} */
@@ -0,0 +1,189 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_check.h
+ *
+ * @brief  Header file for the host scenario checks
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+
+/* Intra-component Headers */
+#include "host_plant.h"
+
+/**
+ * @defgroup HostCheck Host scenario checks
+ * @brief    Runs ESC scenarios on the host plant in simulated time and checks the results against bounds
+ * @details  Each check starts from a fresh host HAL, plant and ESC, runs one scenario and prints every measured
+ *           value next to its bound, with ok or FAIL. Apart from the cycle counts of the deadline and sensorless
+ *           checks, the results are a function of the code alone, so two runs of the same build print the same
+ *           numbers. The ESC's degraded mode is turned off in every check but the deadline one, as it would switch
+ *           on wall-clock overruns.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   One ESC driving one plant on HAL_MOTOR_0, stepped once per PWM period
+ */
+typedef struct {
+    HostPlant_t plant;           /**< Plant */
+    Esc_t esc;                   /**< ESC under check */
+    uint32_t time_us;            /**< Simulated time since init */
+    uint32_t fault_flags;        /**< EscFault_t bits raised at any point since init */
+} HostCheckRig_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Run one check, or all of them, and print the results
+ * @param   name Check to run, NULL for all
+ * @return  Number of failed measurements, or 1 if the check is unknown
+ */
+uint32_t host_check_run(const char *name);
+
+/**
+ * @brief   Fill the default plant parameters and ESC configuration, with degraded mode off
+ * @param   params Pointer to output plant parameters
+ * @param   cfg Pointer to output ESC configuration
+ */
+void host_check_default_setup(HostPlantParams_t *params, EscConfig_t *cfg);
+
+/**
+ * @brief   Reset the host HAL and set up a plant and an ESC on HAL_MOTOR_0
+ * @param   rig Rig to set up
+ * @param   params Plant parameters
+ * @param   cfg ESC configuration
+ * @return  true if the ESC accepted the configuration
+ */
+bool host_check_rig_init(HostCheckRig_t *rig, const HostPlantParams_t *params, const EscConfig_t *cfg);
+
+/**
+ * @brief   Advance the plant by one PWM period, then run one ESC tick on its state and apply the command
+ * @param   rig Rig
+ */
+void host_check_rig_step(HostCheckRig_t *rig);
+
+/**
+ * @brief   Step the rig for a while
+ * @param   rig Rig
+ * @param   duration_us Time to run, rounded up to whole PWM periods
+ */
+void host_check_rig_run(HostCheckRig_t *rig, uint32_t duration_us);
+
+/**
+ * @brief   Print one measurement with its verdict
+ * @param   ok true if the measurement is within its bound
+ * @param   format printf() format of the measurement and its bound
+ * @return  0 if ok, 1 otherwise, to add to a failure count
+ */
+uint32_t host_check_expect(bool ok, const char *format, ...);
+
+/**
+ * @brief   Direction reversals from top speed through the braking state up to full reverse throttle, against a
+ *          direct plug, with 6-step and sine commutation
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_reversal(void);
+
+/**
+ * @brief   Regenerative braking to rest on a charging pack and on a full one that blocks charge, with 6-step and
+ *          sine commutation
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_regen(void);
+
+/**
+ * @brief   Conduction loss at steady state with and without synchronous rectification
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_sync_rect(void);
+
+/**
+ * @brief   Winding temperature held below its limit by the thermal model's derating, on a sped-up thermal plant
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_thermal(void);
+
+/**
+ * @brief   Battery current and power limits, and the bus sag foldback on a weak pack
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_battery(void);
+
+/**
+ * @brief   Locked-rotor cut-back and stall fault, and a heavy start that must not count as a stall, with 6-step and
+ *          sine commutation
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_stall(void);
+
+/**
+ * @brief   Phase current THD and torque ripple of the sinusoidal drive against 6-step
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_sine(void);
+
+/**
+ * @brief   Phase current THD of the sinusoidal drive with and without dead-time compensation
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_dead_time(void);
+
+/**
+ * @brief   Top speed of the sinusoidal drive at full throttle, without field weakening and with rising limits on it
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_field_weakening(void);
+
+/**
+ * @brief   Phase current per unit torque of the sinusoidal drive on a salient plant, with and without MTPA
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_mtpa(void);
+
+/**
+ * @brief   Sensorless start-ups from rest and against a rotor spinning either way, with the observer angle error
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_sensorless(void);
+
+/**
+ * @brief   Inverter commands latched by an update event injected between every pair of shadow register writes
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_torn_write(void);
+
+/**
+ * @brief   Black-box record of an injected overcurrent sample and of a HAL fault, and a replay of its export
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_blackbox(void);
+
+/**
+ * @brief   Hall speed estimate at steady speed, from a timebase at 0 and from one about to wrap 32 bits, and on the
+ *          first edge after a stop of a whole wrap
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_timer_wrap(void);
+
+/**
+ * @brief   Deadline overruns forced with a 1 ns deadline, the degraded mode they latch and its reset
+ * @return  Number of failed measurements
+ */
+uint32_t host_check_deadline(void);
+
+/** @} */
@@ -0,0 +1,129 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_cosim.h
+ *
+ * @brief  Header file for the host shared-memory co-simulation module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "histogram.h"
+#include "motor.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostCosim Host co-simulation module
+ * @brief    Lockstep exchange of motor state and inverter commands with a plant in another local process
+ * @details  Both processes map one POSIX shared-memory region holding the exchanged structs and two process-shared
+ *           semaphores. Each step the controller publishes its command and posts the plant; the plant advances,
+ *           publishes the motor state and posts back. Nothing is serialized: the structs are shared as-is, so both
+ *           sides must be built from the same headers (checked through HOST_COSIM_VERSION and the region size).
+ *           A Simulink S-function or any other plant links this module and uses the plant-side calls.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_COSIM_DEFAULT_NAME "/esc_cosim"
+#define HOST_COSIM_VERSION 1U
+#define HOST_COSIM_TIMEOUT_MS 1000U  /* A peer silent this long is treated as gone */
+#define HOST_COSIM_SPIN_TRIES 2000U  /* Polls before blocking, only used with more than one CPU online */
+
+/**
+ * @brief   Side of the co-simulation link
+ */
+typedef enum {
+    HOST_COSIM_ROLE_CONTROLLER, /**< Creates the region, sends inverter commands, receives motor state */
+    HOST_COSIM_ROLE_PLANT       /**< Attaches to the region, receives inverter commands, sends motor state */
+} HostCosimRole_t;
+
+/**
+ * @brief   Co-simulation link handle
+ */
+typedef struct {
+    HostCosimRole_t role;  /**< Side of the link */
+    void *region;          /**< Mapped shared region */
+    char name[64];         /**< Shared-memory object name */
+    uint32_t spin_tries;   /**< Polls before blocking on the peer */
+} HostCosim_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Open a co-simulation link
+ * @details The controller creates (or recreates) the region; the plant attaches to an existing one.
+ * @param   cosim Link handle
+ * @param   name Shared-memory object name, starting with '/'
+ * @param   role Side of the link
+ * @return  True if the region is mapped and valid
+ */
+bool host_cosim_open(HostCosim_t *cosim, const char *name, HostCosimRole_t role);
+
+/**
+ * @brief   Close a co-simulation link; the controller also tells the plant to stop and removes the region
+ * @param   cosim Link handle
+ */
+void host_cosim_close(HostCosim_t *cosim);
+
+/**
+ * @brief   Controller side: send a command and wait for the plant to advance by dt_us
+ * @details On return the motor state and time from the plant have been loaded into the host HAL inputs, so the
+ *          regular HAL reads see them.
+ * @param   cosim Link handle
+ * @param   cmd Inverter command to apply over the step
+ * @param   dt_us Step length in microseconds
+ * @return  True if the plant answered, false on timeout or a closed link
+ */
+bool host_cosim_controller_step(HostCosim_t *cosim, const EscInverterCmd_t *cmd, uint32_t dt_us);
+
+/**
+ * @brief   Plant side: wait for the next command
+ * @param   cosim Link handle
+ * @param   cmd Output inverter command
+ * @param   dt_us Output step length in microseconds
+ * @return  True if a command arrived, false if the controller closed the link or went silent
+ */
+bool host_cosim_plant_receive(HostCosim_t *cosim, EscInverterCmd_t *cmd, uint32_t *dt_us);
+
+/**
+ * @brief   Plant side: publish the motor state at the end of the step and release the controller
+ * @param   cosim Link handle
+ * @param   motor_state Motor state at the end of the step
+ * @param   time_ticks Plant time at the end of the step, in HAL_TIME_TICKS_PER_US ticks
+ */
+void host_cosim_plant_send(HostCosim_t *cosim, const MotorState_t *motor_state, uint64_t time_ticks);
+
+/**
+ * @brief   Serve steps with the host plant until the controller closes the link
+ * @param   name Shared-memory object name
+ * @param   echo True to answer without advancing the plant, isolating the exchange cost
+ * @return  Number of steps served, negative if the link could not be opened
+ */
+int64_t host_cosim_run_plant(const char *name, bool echo);
+
+/**
+ * @brief   Run the ESC against a co-simulated plant, recording the round-trip time of each step
+ * @param   name Shared-memory object name
+ * @param   duration_us Simulated time to run
+ * @param   dt_us Control step length
+ * @param   throttle Constant throttle command
+ * @param   round_trip_ns Output histogram of exchange round-trip times, in nanoseconds
+ * @return  True if every step completed
+ */
+bool host_cosim_run_controller(const char *name, uint32_t duration_us, uint32_t dt_us, float throttle,
+                               Histogram_t *round_trip_ns);
+
+/** @} */
@@ -0,0 +1,63 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_drive_cycle.h
+ *
+ * @brief  Header file for the host drive-cycle benchmark
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostDriveCycle Host drive-cycle benchmark
+ * @brief    Runs scripted speed and load profiles through esc_step() and the host plant in simulated time and
+ *           reports energy, efficiency, tracking and CPU metrics per cycle
+ * @details  Each cycle is a reference speed, interpolated between points, and a load torque, stepped at each
+ *           point. It starts from a fresh plant and ESC. A driver model follows the reference the way a rider
+ *           would: every HOST_DRIVE_CYCLE_DRIVER_PERIOD_US it sets the throttle from the no-load speed plus a PI
+ *           correction on the speed error. When the correction asks for less than coasting gives, it brakes
+ *           instead, and a reference of the other sign reverses through the ESC's direction state machine.
+ *           Everything but the CPU time is a function of the code alone, so two runs of the same build give
+ *           the same numbers. The ESC's degraded mode is turned off, as it would switch on wall-clock overruns.
+ *           The summary is a CSV file with one row per cycle. Given a baseline summary, every gated metric
+ *           that got worse by more than HOST_DRIVE_CYCLE_TOLERANCE counts as a regression. CPU times are not
+ *           gated and need an optimized build (-DCMAKE_BUILD_TYPE=Release).
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_DRIVE_CYCLE_DRIVER_PERIOD_US 1000U /* Driver model update period, also the tracking sample period */
+#define HOST_DRIVE_CYCLE_TOLERANCE 0.02f        /* Relative change of a gated metric that counts as a regression */
+
+/**
+ * @brief   Host drive-cycle run settings
+ */
+typedef struct {
+    const char *cycle;           /**< Name of the only cycle to run, NULL for all */
+    const char *path;            /**< CSV summary output, NULL for none */
+    const char *baseline_path;   /**< CSV summary to compare against, NULL for none */
+} HostDriveCycleConfig_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Run the cycles, print a table, write the summary and compare it with the baseline
+ * @param   cfg Run settings
+ * @return  Number of regressions against the baseline, or 1 if the cycle is unknown or a file cannot be used
+ */
+uint32_t host_drive_cycle_run(const HostDriveCycleConfig_t *cfg);
+
+/** @} */
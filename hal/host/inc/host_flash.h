@@ -0,0 +1,42 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_flash.h
+ *
+ * @brief  Header file for the host file-backed flash
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostFlash Host file-backed flash
+ * @brief    Backs the HAL flash region with a memory-mapped file, so its contents outlive the process
+ * @details  Until a file is opened the region does not exist and every flash operation fails.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Map a file as the flash region, creating it erased if missing or the wrong size
+ * @param   path File path
+ * @return  true if mapped
+ */
+bool hal_host_flash_open(const char *path);
+
+/**
+ * @brief   Write the region back to its file and unmap it
+ */
+void hal_host_flash_close(void);
+
+/** @} */
@@ -0,0 +1,49 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_input_bench.h
+ *
+ * @brief  Header file for the host throttle input check and benchmark
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostInputBench Host throttle input check and benchmark
+ * @brief    Feeds synthetic servo PWM and DShot edge streams through the host capture ring and times the decoders
+ * @details  Each stream has random values and timing jitter. It also has a corrupted frame every
+ *           HOST_INPUT_BENCH_CORRUPT_EVERY frames and a dropped edge every HOST_INPUT_BENCH_DROP_EVERY frames. The
+ *           edges arrive in random chunks of up to one frame, as DMA transfers would be picked up, and every
+ *           decoded frame must match the one generated at its timestamp. Timings need an optimized build
+ *           (-DCMAKE_BUILD_TYPE=Release).
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_INPUT_BENCH_DEFAULT_FRAMES 100000U /* Frames per protocol */
+#define HOST_INPUT_BENCH_CORRUPT_EVERY 1000U    /* Frames between corrupted frames */
+#define HOST_INPUT_BENCH_DROP_EVERY 5000U       /* Frames between dropped edges */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Check and time the decoder of every protocol and print a table
+ * @param   frames Frames per protocol
+ * @return  Number of protocols that decoded a wrong value or lost more frames than the faults account for
+ */
+uint32_t host_input_bench_run(uint32_t frames);
+
+/** @} */
@@ -0,0 +1,47 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_link.h
+ *
+ * @brief  Header file for the host protocol loopback and bandwidth check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostLink Host protocol loopback and bandwidth check
+ * @brief    Runs the binary protocol end to end over a local socket pair
+ * @details  The loopback runs the ESC and the host plant in simulated time on one end of a socket pair. From the
+ *           other end it sends each request type and checks the replies against the ESC: configuration round trip,
+ *           a corrupted frame, the telemetry stream, and scope and black-box readouts. The bandwidth check then
+ *           streams telemetry frames from one thread to a decoding thread as fast as the socket takes them.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_LINK_DEFAULT_DURATION_MS 1000U /* Length of the bandwidth check */
+#define HOST_LINK_UART_BAUD 2000000U        /* UART the bandwidth is compared with, 10 bits per byte */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Run the loopback checks and the bandwidth check, and print the results
+ * @param   duration_ms Length of the bandwidth check
+ * @return  Number of failed checks
+ */
+uint32_t host_link_run(uint32_t duration_ms);
+
+/** @} */
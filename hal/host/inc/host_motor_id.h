@@ -0,0 +1,46 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_motor_id.h
+ *
+ * @brief  Header file for the host motor identification check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostMotorId Host motor identification check
+ * @brief    Runs the ESC motor identification on the host plant in simulated time and compares it with the plant
+ * @details  The expected flux linkage is the fundamental of the plant back-EMF per electrical rad/s, and the
+ *           expected resistance the winding's plus one switch's, as the flux observer wants them.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_MOTOR_ID_TOLERANCE 0.05f   /* Largest relative error of an identified parameter */
+#define HOST_MOTOR_ID_TIMEOUT_US 10000000U /* Simulated time the sequence must finish in */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Identify the default plant from a configuration with no motor parameters and print the results
+ * @param   sinusoidal_bemf true for the sine back-EMF plant, false for the trapezoidal one
+ * @return  Number of parameters outside HOST_MOTOR_ID_TOLERANCE, or of all of them if the sequence failed
+ */
+uint32_t host_motor_id_run(bool sinusoidal_bemf);
+
+/** @} */
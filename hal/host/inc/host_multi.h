@@ -0,0 +1,53 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_multi.h
+ *
+ * @brief  Header file for the host multi-motor check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostMulti Host multi-motor check
+ * @brief    Drives one plant per inverter from a single esc_group_tick() scheduler in simulated time
+ * @details  Each scheduler slot advances every plant by HAL_PWM_PERIOD_US / NUM_HAL_MOTORS and then runs the
+ *           slot, as the timer interrupt would. The plants differ only in load, HOST_MULTI_LOAD_STEP times more
+ *           for each inverter up. The run is repeated with the first inverter alone, which must end in exactly
+ *           the same state. The DC-link ripple is worked out from the latched switching state and phase currents
+ *           of all inverters, as if they shared one DC link, with the carriers aligned and staggered by
+ *           HAL_PWM_PHASE_US(). Timings need an optimized build (-DCMAKE_BUILD_TYPE=Release).
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_MULTI_DEFAULT_DURATION_MS 500U /* Simulated run time */
+#define HOST_MULTI_DEFAULT_THROTTLE 0.3f    /* Throttle of every ESC */
+#define HOST_MULTI_LOAD_STEP 2.0f           /* Load torque of each plant relative to the one before */
+#define HOST_MULTI_MIN_SPEED_RPM 100.0f     /* Every motor must be spinning faster than this at the end */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Run every inverter together and the first one alone, and print speeds, tick costs and ripple
+ * @param   duration_ms Simulated run time
+ * @param   throttle Throttle of every ESC
+ * @return  Number of failed checks: a motor faulted or not spinning, the first motor changed by the others
+ *          running, or the staggered carriers not reducing the ripple
+ */
+uint32_t host_multi_run(uint32_t duration_ms, float throttle);
+
+/** @} */
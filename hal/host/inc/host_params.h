@@ -0,0 +1,51 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_params.h
+ *
+ * @brief  Header file for the host parameter store check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostParams Host parameter store check
+ * @brief    Runs the parameter store on the file-backed flash, with power cut at every flash operation
+ * @details  First it reports what the file holds from the previous run, and how long it takes to mount and load.
+ *           Then it erases the flash and checks the store. It saves and reloads a configuration, rejects bad ones,
+ *           ignores other layout versions, and keeps other keys through compaction. It also checks that wear
+ *           spreads over the sectors, and that SAVE_CONFIG works through the protocol. For the power-loss check,
+ *           each of a run of saves is repeated with the power cut after 0, 1, 2, ... flash operations until one
+ *           completes. After every cut the store must mount with either the old or the new value. The file keeps
+ *           the last configuration saved, for the next run to find.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_PARAMS_DEFAULT_PATH "esc_params.bin" /* Flash image */
+#define HOST_PARAMS_WEAR_SAVES 5000U              /* Saves of the wear check */
+#define HOST_PARAMS_POWER_CUT_SAVES 60U           /* Saves of the power-loss check, several compactions */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Run the checks on a flash image and print the results
+ * @param   path Flash image, created if missing
+ * @return  Number of failed checks
+ */
+uint32_t host_params_run(const char *path);
+
+/** @} */
@@ -0,0 +1,150 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_plant.h
+ *
+ * @brief  Header file for the host BLDC plant model
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "hal_motor.h"
+#include "motor.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HalHostPlant HAL host plant model
+ * @brief    Simulated BLDC motor and inverter driven by the host PWM HAL and feeding the host ADC/GPIO HAL
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_PLANT_SUBSTEP_US 1U /* Integration step; Hall timestamps are interpolated within it to the tick */
+
+/**
+ * @brief   Plant parameters
+ */
+typedef struct {
+    float phase_resistance_Ohm;  /**< Per-phase winding resistance */
+    float phase_inductance_H;    /**< Per-phase winding inductance, along the rotor flux (d-axis) if salient */
+    float q_axis_inductance_H;   /**< Per-phase winding inductance across the rotor flux (q-axis), 0 if not salient */
+    float bemf_constant_Vs;      /**< Per-phase back-EMF plateau (peak if sinusoidal) per mechanical rad/s */
+    bool sinusoidal_bemf;        /**< True for a sine back-EMF (PMSM), false for a trapezoidal one (BLDC) */
+    uint8_t num_pole_pairs;      /**< Number of pole pairs */
+    float inertia_kgm2;          /**< Rotor and load inertia */
+    float viscous_friction_Nms;  /**< Viscous friction coefficient */
+    float load_torque_Nm;        /**< Constant load torque opposing motion */
+    float battery_ocv_V;         /**< Battery open-circuit voltage */
+    float battery_resistance_Ohm; /**< Battery and wiring series resistance */
+    bool battery_accepts_charge; /**< False models a BMS that blocks charge current (full pack) */
+    float dc_link_capacitance_F; /**< DC-link capacitance at the inverter */
+    float fet_rds_on_Ohm;        /**< Inverter switch on-resistance */
+    float diode_forward_V;       /**< Inverter switch body-diode forward drop */
+    float ambient_temp_C;        /**< Ambient temperature, also the initial temperature of every thermal mass */
+    float winding_c_th_J_per_K;  /**< Heat capacity of the windings */
+    float winding_r_th_K_per_W;  /**< Thermal resistance from the windings to the stator */
+    float stator_c_th_J_per_K;   /**< Heat capacity of the stator, where the temperature sensor sits */
+    float stator_r_th_K_per_W;   /**< Thermal resistance from the stator to ambient */
+    float fet_c_th_J_per_K;      /**< Heat capacity of the inverter switches and heatsink */
+    float fet_r_th_K_per_W;      /**< Thermal resistance from the inverter switches to ambient */
+} HostPlantParams_t;
+
+/**
+ * @brief   Plant state
+ */
+typedef struct {
+    HostPlantParams_t params;                  /**< Plant parameters */
+    HalMotor_t motor;                          /**< Inverter of the host HAL the plant is wired to */
+    uint64_t time_ticks;                       /**< Plant time, in HAL_TIME_TICKS_PER_US ticks */
+
+    float phase_currents_A[NUM_MOTOR_PHASES];  /**< Winding currents */
+    float omega_mech_rad_s;                    /**< Mechanical speed */
+    float theta_elec_rad;                      /**< Electrical angle in [0, 2*pi) */
+    uint8_t sector;                            /**< Electrical sector (0-5) */
+    float bus_voltage_V;                       /**< DC-link capacitor voltage */
+    float battery_current_A;                   /**< Battery current, positive discharging */
+    float torque_Nm;                           /**< Electromagnetic torque of the last substep */
+
+    float peak_phase_current_A;                /**< Largest phase current magnitude seen since reset */
+    float peak_bus_voltage_V;                  /**< Largest DC-link voltage seen since reset */
+    double battery_energy_out_J;               /**< Energy drawn from the battery (at open-circuit voltage) */
+    double battery_energy_in_J;                /**< Energy returned to the battery (at open-circuit voltage) */
+    double conduction_loss_J;                  /**< Energy dissipated in inverter switches and body diodes */
+    double copper_loss_J;                      /**< Energy dissipated in the windings */
+    double shaft_energy_out_J;                 /**< Work done by the electromagnetic torque on the rotor */
+    double shaft_energy_in_J;                  /**< Work done by the rotor against the electromagnetic torque */
+
+    double winding_temp_C;                     /**< Winding temperature */
+    double stator_temp_C;                      /**< Stator temperature, reported as the motor temperature */
+    double fet_temp_C;                         /**< Inverter switch temperature */
+} HostPlant_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Fills plant parameters with a nominal 48 V, 7 pole-pair scooter hub motor on a charge-accepting pack
+ * @param   params Pointer to output parameters
+ */
+void host_plant_default_params(HostPlantParams_t *params);
+
+/**
+ * @brief   Fills an ESC configuration suited to the default plant (sensored 6-step, 60 A, 30-58 V bus)
+ * @param   cfg Pointer to output configuration
+ */
+void host_plant_default_esc_config(EscConfig_t *cfg);
+
+/**
+ * @brief   Initializes the plant at standstill, at the present host time, and publishes its state to the host HAL
+ * @param   plant Plant instance
+ * @param   motor Inverter the plant is wired to
+ * @param   params Plant parameters
+ */
+void host_plant_init(HostPlant_t *plant, HalMotor_t motor, const HostPlantParams_t *params);
+
+/**
+ * @brief   Advances the plant using the inverter command last applied through the host PWM HAL
+ * @details The ADC and GPIO host state of the plant's inverter are updated, so HAL reads observe the plant. The
+ *          plant keeps its own time, so several plants can be stepped over the same interval one after the other;
+ *          the host timebase is moved up to the plant's time.
+ *          Each inverter leg is averaged over the PWM period from the switching state recorded by the host PWM HAL:
+ *          switches conduct with their on-resistance, and whenever neither switch of a leg conducts (dead time,
+ *          diode freewheeling, floating phase still carrying current) the body diode set by the current direction
+ *          does. A floating leg drops out once its current reaches zero; rectification through a fully open bridge
+ *          is not modelled. The DC link is a capacitor fed from the battery through its series resistance.
+ *          A PWM update event is raised at every HAL_PWM_PERIOD_US boundary of the inverter's carrier, which is
+ *          HAL_PWM_PHASE_US() behind the timebase.
+ *          Three thermal masses are heated by the losses of the step: the windings (copper loss, scaled by the
+ *          copper temperature coefficient) into the stator into ambient, and the switches (conduction loss) into
+ *          ambient. The reported motor temperature is the stator's, so it lags the windings.
+ * @param   plant Plant instance
+ * @param   dt_us Time to advance in microseconds
+ */
+void host_plant_step(HostPlant_t *plant, uint32_t dt_us);
+
+/**
+ * @brief   Gets the plant mechanical speed
+ * @param   plant Plant instance
+ * @return  Signed mechanical speed in RPM
+ */
+float host_plant_get_speed_rpm(const HostPlant_t *plant);
+
+/**
+ * @brief   Clears the peak and energy statistics
+ * @param   plant Plant instance
+ */
+void host_plant_reset_stats(HostPlant_t *plant);
+
+/** @} */
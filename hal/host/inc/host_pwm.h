@@ -0,0 +1,39 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_pwm.h
+ *
+ * @brief  Header file for the host-only extensions of the HAL PWM module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "pwm.h"
+
+/**
+ * @defgroup HalHostPwm HAL host PWM module
+ * @brief    Host model of the PWM timer update event
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Models the PWM timer update event
+ * @details Latches the shadow inverter command if a complete one is pending, by flipping the active buffer index,
+ *          and reloads the per-phase switching state from the active buffer. The host plant calls this once per
+ *          HAL_PWM_PERIOD_US, at the inverter's HAL_PWM_PHASE_US(); tests may call it at any other point,
+ *          including from the PWM write hook.
+ * @param   motor Inverter
+ */
+void hal_host_pwm_update_event(HalMotor_t motor);
+
+/** @} */
@@ -0,0 +1,89 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_rt_runner.h
+ *
+ * @brief  Header file for the host real-time runner module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "histogram.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostRtRunner Host real-time runner module
+ * @brief    Software-in-the-loop timing stand-in: runs esc_step() from a periodic Linux timer on a real-time thread
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_RT_RUNNER_DEFAULT_RATE_HZ 20000U
+#define HOST_RT_RUNNER_DEFAULT_PRIORITY 80
+
+/**
+ * @brief   Real-time runner configuration
+ */
+typedef struct {
+    uint32_t rate_hz;        /**< Control loop rate */
+    uint32_t duration_ms;    /**< Run length */
+    int cpu;                 /**< CPU to pin the control thread to, negative for no pinning */
+    int priority;            /**< SCHED_FIFO priority */
+    float throttle;          /**< Constant throttle command */
+    const char *trace_path;  /**< Replay trace (CSV: time_us,ia,ib,ic,vbus,temp_C,hall), NULL to run the host plant */
+    const char *blackbox_path; /**< Fault black box written here after the run, NULL for none */
+} HostRtRunnerConfig_t;
+
+/**
+ * @brief   Real-time runner timing results, all times in nanoseconds
+ */
+typedef struct {
+    Histogram_t wakeup_latency_ns;  /**< Timer expiry to thread running */
+    Histogram_t exec_time_ns;       /**< Motor state read, esc_step() and inverter command write */
+    uint64_t cycles;                /**< Control steps executed */
+    uint64_t deadline_misses;       /**< Steps that finished after the next timer expiry */
+    uint64_t overruns;              /**< Timer expiries with no step run for them */
+    bool realtime;                  /**< True if SCHED_FIFO was granted */
+    bool pinned;                    /**< True if the thread was pinned to the requested CPU */
+    EscDeadlineStats_t esc_deadline; /**< The ESC's own deadline monitor, in hal_time_get_cycles() cycles */
+} HostRtRunnerStats_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Fill a configuration with defaults (20 kHz, 1 s, unpinned, host plant)
+ * @param   cfg Configuration to fill
+ */
+void host_rt_runner_default_config(HostRtRunnerConfig_t *cfg);
+
+/**
+ * @brief   Run the control loop on a timerfd-driven thread until the duration or the replay trace ends
+ * @details Falls back to normal scheduling (and reports it) when SCHED_FIFO is not permitted. Only available on
+ *          Linux; elsewhere it returns false.
+ * @param   cfg Runner configuration
+ * @param   stats Output timing results
+ * @return  True if the run completed, false on a setup error
+ */
+bool host_rt_runner_run(const HostRtRunnerConfig_t *cfg, HostRtRunnerStats_t *stats);
+
+/**
+ * @brief   Print a timing summary
+ * @param   cfg Runner configuration used for the run
+ * @param   stats Timing results
+ */
+void host_rt_runner_print_stats(const HostRtRunnerConfig_t *cfg, const HostRtRunnerStats_t *stats);
+
+/** @} */
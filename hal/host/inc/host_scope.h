@@ -0,0 +1,79 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_scope.h
+ *
+ * @brief  Header file for the host software oscilloscope command
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostScope Host software oscilloscope command
+ * @brief    Arms the ESC oscilloscope, runs the host plant in simulated time until the capture completes, and
+ *           writes it as a CSV trace
+ * @details  Times in the trace count from the trigger frame, so the pre-trigger frames have negative times. A
+ *           comment line starting with '#' carries the capture settings and the measured cost of an armed tick.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_SCOPE_DEFAULT_DURATION_MS 2000U /* Simulated time to wait for the capture to complete */
+
+/**
+ * @brief   Host oscilloscope run settings
+ */
+typedef struct {
+    EscScopeConfig_t scope;      /**< Capture settings */
+    float throttle;              /**< Throttle held through the run */
+    uint32_t duration_ms;        /**< Simulated time limit */
+    const char *path;            /**< CSV output, NULL for none */
+} HostScopeConfig_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Fill in the default run: phase currents around 1000 rpm on the way up at 30% throttle
+ * @param   cfg Settings to fill in
+ */
+void host_scope_default_config(HostScopeConfig_t *cfg);
+
+/**
+ * @brief   Look up a signal by its short name, as used in the trace header
+ * @param   name Short name, e.g. "ia" or "rpm"
+ * @param   signal Output signal
+ * @return  true if the name is known
+ */
+bool host_scope_parse_signal(const char *name, EscScopeSignal_t *signal);
+
+/**
+ * @brief   Look up a trigger condition by name: none, rising, falling or either
+ * @param   name Condition name
+ * @param   trigger Output condition
+ * @return  true if the name is known
+ */
+bool host_scope_parse_trigger(const char *name, EscScopeTrigger_t *trigger);
+
+/**
+ * @brief   Run the capture and print a summary
+ * @param   cfg Run settings
+ * @return  true if the capture completed and, with a path, was written
+ */
+bool host_scope_run(const HostScopeConfig_t *cfg);
+
+/** @} */
@@ -16,6 +16,9 @@
 /* Inter-component Headers */
 #include "esc.h"
 #include "fault.h"
+#include "flash.h"
+#include "hal_motor.h"
+#include "input.h"
 #include "motor.h"
 
 /* Intra-component Headers */
@@ -30,8 +33,34 @@
  * Private defines and enums
  *******************************************************************************************************************************/
 
+#define HAL_HOST_PWM_NUM_BUFFERS 2U /* Active and shadow inverter command registers */
+
+/**
+ * @brief   Host hook called between the individual shadow register writes of an inverter command
+ */
+typedef void (*HalHostPwmWriteHook_t)(void);
+
+/**
+ * @brief   Host record of how one inverter leg is being switched
+ */
+typedef enum {
+    HAL_HOST_PHASE_FLOATING,      /**< Both switches off */
+    HAL_HOST_PHASE_HIGH_PWM,      /**< High side PWM, low side off (freewheels through the low-side diode) */
+    HAL_HOST_PHASE_LOW_ON,        /**< Low side held on */
+    HAL_HOST_PHASE_COMPLEMENTARY  /**< High and low side switched in antiphase with dead time */
+} HalHostPhaseMode_t;
+
+/**
+ * @brief   Host record of the switching state of one inverter leg over a PWM period
+ */
+typedef struct {
+    HalHostPhaseMode_t mode;  /**< Leg switching mode */
+    float high_on_fraction;   /**< Fraction of the period the high-side switch conducts */
+    float low_on_fraction;    /**< Fraction of the period the low-side switch conducts */
+} HalHostPhaseSwitching_t;
+
 /**
- * @brief   Shared host HAL state
+ * @brief   Host HAL state of one inverter
  */
 typedef struct {
     /* Fake input measurements */
@@ -41,20 +70,43 @@ typedef struct {
 
     /* Fake digital inputs */
     uint8_t hall_abc;                         /**< Fake Hall sensor state */
-    uint32_t hall_timestamp_us;               /**< Fake Hall transition timestamp */
+    uint32_t hall_timestamp_ticks;            /**< Fake Hall transition timestamp, low 32 bits of time_ticks */
 
     /* Fake fault/ready state */
     bool fault_active;                        /**< Fake platform fault active flag */
     HalFault_t fault;                         /**< Fake platform fault type */
     bool ready;                               /**< Fake platform ready state */
 
-    /* Fake timebase */
-    uint32_t time_us;                         /**< Fake system time in microseconds */
-
     /* Captured output state */
     bool pwm_outputs_enabled;                 /**< Captured PWM output enable state */
-    EscInverterCmd_t inverter_cmd;            /**< Last applied inverter command */
-    bool inverter_cmd_valid;                  /**< True if inverter command has been written */
+    EscInverterCmd_t inverter_cmd_buffer[HAL_HOST_PWM_NUM_BUFFERS]; /**< Double-buffered inverter command registers */
+    volatile uint8_t inverter_cmd_active;     /**< Buffer latched at the last PWM update event, the other is the shadow */
+    volatile bool inverter_cmd_pending;       /**< True once the shadow buffer holds a complete command */
+    bool inverter_cmd_valid;                  /**< True if an inverter command has been latched */
+    uint32_t pwm_update_count;                /**< Number of PWM update events */
+    HalHostPwmWriteHook_t pwm_write_hook;     /**< Called between shadow register writes, NULL if unused */
+    HalHostPhaseSwitching_t phase_switching[NUM_MOTOR_PHASES]; /**< Latched per-phase switching state */
+} HalHostMotorState_t;
+
+/**
+ * @brief   Shared host HAL state: the inverters and the board-wide peripherals
+ */
+typedef struct {
+    HalHostMotorState_t motors[NUM_HAL_MOTORS]; /**< Per-inverter state */
+
+    /* Fake throttle input capture */
+    uint32_t input_edge_ticks[HAL_INPUT_CAPTURE_SIZE]; /**< Fake capture ring, edge n at n % HAL_INPUT_CAPTURE_SIZE */
+    uint32_t input_edge_count;                /**< Fake count of edges captured */
+
+    /* Fake flash */
+    uint8_t *flash;                           /**< Flash region, mapped by hal_host_flash_open(), NULL for none */
+    uint32_t flash_erase_count[HAL_FLASH_NUM_SECTORS]; /**< Erases of each sector since the region was opened */
+    bool flash_power_cut_armed;               /**< Power fails once flash_ops_to_power_cut operations are done */
+    uint32_t flash_ops_to_power_cut;          /**< Erases and program units left before power fails */
+    bool flash_power_lost;                    /**< Power failed during a flash operation; all now fail */
+
+    /* Fake timebase */
+    uint64_t time_ticks;                      /**< Fake monotonic system time in HAL_TIME_TICKS_PER_US ticks */
 } HalHostState_t;
 
 /*******************************************************************************************************************************
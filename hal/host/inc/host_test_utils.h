@@ -19,6 +19,7 @@
 #include "motor.h"
 
 /* Intra-component Headers */
+#include "host_state.h"
 
 /**
  * @defgroup HalHostTestUtils HAL host test utilities module
@@ -39,54 +40,68 @@
  *******************************************************************************************************************************/
 
 /**
- * @brief   Resets all host HAL test state to default values
+ * @brief   Resets all host HAL test state to default values, for every inverter
  */
 void hal_host_test_utils_reset(void);
 
 /**
  * @brief   Sets the host phase current measurements
+ * @param   motor Inverter
  * @param   phase_a_A Phase A current in amperes
  * @param   phase_b_A Phase B current in amperes
  * @param   phase_c_A Phase C current in amperes
  */
-void hal_host_test_utils_set_phase_currents(float phase_a_A, float phase_b_A, float phase_c_A);
+void hal_host_test_utils_set_phase_currents(HalMotor_t motor, float phase_a_A, float phase_b_A, float phase_c_A);
 
 /**
  * @brief   Sets the host DC bus voltage measurement
+ * @param   motor Inverter
  * @param   bus_voltage_V DC bus voltage in volts
  */
-void hal_host_test_utils_set_bus_voltage(float bus_voltage_V);
+void hal_host_test_utils_set_bus_voltage(HalMotor_t motor, float bus_voltage_V);
 
 /**
  * @brief   Sets the host temperature measurement
+ * @param   motor Inverter
  * @param   temperature_C Temperature in degrees Celsius
  */
-void hal_host_test_utils_set_temperature(float temperature_C);
+void hal_host_test_utils_set_temperature(HalMotor_t motor, float temperature_C);
 
 /**
  * @brief   Sets the host Hall sensor state
+ * @param   motor Inverter
  * @param   hall_abc Three-bit Hall sensor state
  */
-void hal_host_test_utils_set_hall_state(uint8_t hall_abc);
+void hal_host_test_utils_set_hall_state(HalMotor_t motor, uint8_t hall_abc);
 
 /**
  * @brief   Sets the host Hall transition timestamp
- * @param   hall_timestamp_us Timestamp of last Hall transition in microseconds
+ * @param   motor Inverter
+ * @param   hall_timestamp_ticks Timestamp of last Hall transition in timer ticks (low 32 bits)
  */
-void hal_host_test_utils_set_hall_timestamp_us(uint32_t hall_timestamp_us);
+void hal_host_test_utils_set_hall_timestamp_ticks(HalMotor_t motor, uint32_t hall_timestamp_ticks);
+
+/**
+ * @brief   Captures edges on the throttle input, as the timer and DMA would
+ * @param   ticks Capture counts of the edges, in HAL_INPUT_CAPTURE_TICKS_PER_US ticks, alternately rising and falling
+ * @param   count Number of edges
+ */
+void hal_host_test_utils_capture_input_edges(const uint32_t *ticks, uint32_t count);
 
 /**
  * @brief   Sets the host fault state
+ * @param   motor Inverter
  * @param   active True if a fault is active, false otherwise
  * @param   fault Current fault type
  */
-void hal_host_test_utils_set_fault(bool active, HalFault_t fault);
+void hal_host_test_utils_set_fault(HalMotor_t motor, bool active, HalFault_t fault);
 
 /**
  * @brief   Sets the host ready state
+ * @param   motor Inverter
  * @param   ready True if the platform is ready to drive, false otherwise
  */
-void hal_host_test_utils_set_ready(bool ready);
+void hal_host_test_utils_set_ready(HalMotor_t motor, bool ready);
 
 /**
  * @brief   Advances the host timebase in milliseconds
@@ -101,23 +116,63 @@ void hal_host_test_utils_advance_time_ms(uint32_t delta_ms);
 void hal_host_test_utils_advance_time_us(uint32_t delta_us);
 
 /**
- * @brief   Gets the last applied inverter command from the host PWM HAL
+ * @brief   Advances the host timebase in timer ticks
+ * @param   delta_ticks Time increment in HAL_TIME_TICKS_PER_US ticks
+ */
+void hal_host_test_utils_advance_time_ticks(uint64_t delta_ticks);
+
+/**
+ * @brief   Gets the inverter command latched at the last PWM update event
+ * @param   motor Inverter
  * @param   cmd Pointer to output inverter command
+ * @return  True if a command has been latched, false otherwise
+ */
+bool hal_host_test_utils_get_inverter_cmd(HalMotor_t motor, EscInverterCmd_t *cmd);
+
+/**
+ * @brief   Installs a hook the host PWM HAL calls between the shadow register writes of each inverter command
+ * @details Calling hal_host_pwm_update_event() from the hook injects an update event mid-write.
+ * @param   motor Inverter
+ * @param   hook Hook function, NULL to remove
+ */
+void hal_host_test_utils_set_pwm_write_hook(HalMotor_t motor, HalHostPwmWriteHook_t hook);
+
+/**
+ * @brief   Gets the switching state the host PWM HAL applied to one inverter leg
+ * @param   motor Inverter
+ * @param   phase Motor phase
+ * @param   switching Pointer to output switching state
  * @return  True if a command has been captured, false otherwise
  */
-bool hal_host_test_utils_get_inverter_cmd(EscInverterCmd_t *cmd);
+bool hal_host_test_utils_get_phase_switching(HalMotor_t motor, MotorPhase_t phase, HalHostPhaseSwitching_t *switching);
 
 /**
  * @brief   Checks whether host PWM outputs are currently enabled
+ * @param   motor Inverter
  * @return  True if outputs are enabled, false otherwise
  */
-bool hal_host_test_utils_pwm_outputs_enabled(void);
+bool hal_host_test_utils_pwm_outputs_enabled(HalMotor_t motor);
 
 /**
  * @brief   Populates a MotorState_t with the current host HAL input state
+ * @param   motor Inverter
  * @param   motor_state Pointer to output motor state
  * @return  True if motor state was populated successfully, false otherwise
  */
-bool hal_host_test_utils_get_motor_state(MotorState_t *motor_state);
+bool hal_host_test_utils_get_motor_state(HalMotor_t motor, MotorState_t *motor_state);
+
+/**
+ * @brief   Cuts the power during a later flash operation
+ * @details The operation gets half done: an erase resets half the sector and a program unit gets half its bytes.
+ *          Every flash operation after it fails until hal_host_test_utils_restore_flash_power().
+ * @param   operations Erases and program units that complete first
+ */
+void hal_host_test_utils_cut_flash_power_after(uint32_t operations);
+
+/**
+ * @brief   Restores flash power after a cut, as at the next boot
+ * @return  true if the power had failed since the cut was set up
+ */
+bool hal_host_test_utils_restore_flash_power(void);
 
 /** @} */
\ No newline at end of file
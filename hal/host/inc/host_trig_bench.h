@@ -0,0 +1,44 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   host_trig_bench.h
+ *
+ * @brief  Header file for the host trigonometry benchmark module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup HostTrigBench Host trigonometry benchmark module
+ * @brief    Checks the trig module kernels against double-precision libm and times them against the float libm calls
+ * @details  Host timings only rank the kernels, and only in an optimized build (-DCMAKE_BUILD_TYPE=Release); a
+ *           Cortex-M with a slower libm, or without an FPU for CORDIC, favours them more than a desktop CPU does.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_TRIG_BENCH_DEFAULT_PASSES 200U /* Passes over all 65536 angles per timing */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Measure worst-case error and time per call of every kernel and print a table
+ * @param   passes Passes over all angles per timing
+ * @return  Number of kernels outside their documented error bound
+ */
+uint32_t host_trig_bench_run(uint32_t passes);
+
+/** @} */
@@ -8,6 +8,7 @@
  *******************************************************************************************************************************/
 
 /* Standard library Headers */
+#include <stddef.h>
 #include <stdint.h>
 
 /* Inter-component Headers */
@@ -27,32 +28,35 @@
 
 void hal_adc_init(void) {
     /* Initializing values in extern hal_host_state */
-    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
-        hal_host_state.phase_currents_A[i] = 0.0f;
+    for (int m = 0; m < NUM_HAL_MOTORS; m++) {
+        HalHostMotorState_t *state = &hal_host_state.motors[m];
+        for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+            state->phase_currents_A[i] = 0.0f;
+        }
+        state->bus_voltage_V = 0;
+        state->temperature_C = 0;
     }
-    hal_host_state.bus_voltage_V = 0;
-    hal_host_state.temperature_C = 0;
 }
 
-bool hal_adc_get_phase_currents(float phase_currents_A[NUM_MOTOR_PHASES]) {
+bool hal_adc_get_phase_currents(HalMotor_t motor, float phase_currents_A[NUM_MOTOR_PHASES]) {
     /* Null ptr check */
-    if (phase_currents_A == NULL) { return false; }
+    if (phase_currents_A == NULL || motor >= NUM_HAL_MOTORS) { return false; }
     for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
-        phase_currents_A[i] = hal_host_state.phase_currents_A[i];
+        phase_currents_A[i] = hal_host_state.motors[motor].phase_currents_A[i];
     }
     return true;
 }
 
-bool hal_adc_get_bus_voltage(float *bus_voltage_V) {
+bool hal_adc_get_bus_voltage(HalMotor_t motor, float *bus_voltage_V) {
     /* Null ptr check */
-    if (bus_voltage_V == NULL) { return false; }
-    *bus_voltage_V = hal_host_state.bus_voltage_V;
+    if (bus_voltage_V == NULL || motor >= NUM_HAL_MOTORS) { return false; }
+    *bus_voltage_V = hal_host_state.motors[motor].bus_voltage_V;
     return true;
 
 }
 
-bool hal_adc_get_temperature(float *temperature_C) {
-    if (temperature_C == NULL) { return false; }
-    *temperature_C = hal_host_state.temperature_C;
+bool hal_adc_get_temperature(HalMotor_t motor, float *temperature_C) {
+    if (temperature_C == NULL || motor >= NUM_HAL_MOTORS) { return false; }
+    *temperature_C = hal_host_state.motors[motor].temperature_C;
     return true;
 }
\ No newline at end of file
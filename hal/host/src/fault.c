@@ -24,27 +24,29 @@
  * Function Definitions
  *******************************************************************************************************************************/
 void hal_fault_init(void) {
-    hal_host_state.fault_active = false;
-    hal_host_state.fault = HAL_FAULT_NONE;
-    hal_host_state.ready = false;
+    for (int m = 0; m < NUM_HAL_MOTORS; m++) {
+        hal_host_state.motors[m].fault_active = false;
+        hal_host_state.motors[m].fault = HAL_FAULT_NONE;
+        hal_host_state.motors[m].ready = false;
+    }
 }
 
-bool hal_fault_is_active(void) {
-    if (hal_host_state.fault_active == false && hal_host_state.fault == HAL_FAULT_NONE) {
+bool hal_fault_is_active(HalMotor_t motor) {
+    if (hal_host_state.motors[motor].fault_active == false && hal_host_state.motors[motor].fault == HAL_FAULT_NONE) {
         return false;
     }
     return true;
 }
 
-HalFault_t hal_fault_get(void) {
-    return hal_host_state.fault;
+HalFault_t hal_fault_get(HalMotor_t motor) {
+    return hal_host_state.motors[motor].fault;
 }
 
-void hal_fault_clear(void) {
-    hal_host_state.fault_active = false;
-    hal_host_state.fault = HAL_FAULT_NONE;
+void hal_fault_clear(HalMotor_t motor) {
+    hal_host_state.motors[motor].fault_active = false;
+    hal_host_state.motors[motor].fault = HAL_FAULT_NONE;
 }
 
-bool hal_fault_is_ready(void) {
-    return hal_host_state.ready;
+bool hal_fault_is_ready(HalMotor_t motor) {
+    return hal_host_state.motors[motor].ready;
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*******************************************************************************************************************************
+ * @file   flash.c
+ *
+ * @brief  Source file for the host HAL flash module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Inter-component Headers */
+#include "host_state.h"
+
+/* Intra-component Headers */
+#include "flash.h"
+#include "host_flash.h"
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Spend one flash operation of the power budget
+ * @return  false if power fails during this operation, which then only gets half done
+ */
+static bool _hal_flash_spend_power(void) {
+    if (!hal_host_state.flash_power_cut_armed) {
+        return true;
+    }
+    if (hal_host_state.flash_ops_to_power_cut == 0U) {
+        hal_host_state.flash_power_lost = true;
+        return false;
+    }
+    hal_host_state.flash_ops_to_power_cut--;
+    return true;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+const uint8_t *hal_flash_get_region(void) {
+    return hal_host_state.flash;
+}
+
+bool hal_flash_erase(uint32_t sector) {
+    if (hal_host_state.flash == NULL || hal_host_state.flash_power_lost || sector >= HAL_FLASH_NUM_SECTORS) {
+        return false;
+    }
+
+    uint8_t *base = &hal_host_state.flash[sector * HAL_FLASH_SECTOR_SIZE];
+    hal_host_state.flash_erase_count[sector]++;
+    if (!_hal_flash_spend_power()) {
+        memset(base, HAL_FLASH_ERASED_BYTE, HAL_FLASH_SECTOR_SIZE / 2U);
+        return false;
+    }
+    memset(base, HAL_FLASH_ERASED_BYTE, HAL_FLASH_SECTOR_SIZE);
+    return true;
+}
+
+bool hal_flash_program(uint32_t address, const void *data, uint32_t len) {
+    if (hal_host_state.flash == NULL || hal_host_state.flash_power_lost || (address % HAL_FLASH_WRITE_SIZE) != 0U ||
+        (len % HAL_FLASH_WRITE_SIZE) != 0U || address > HAL_FLASH_SIZE || len > HAL_FLASH_SIZE - address) {
+        return false;
+    }
+
+    const uint8_t *src = data;
+    for (uint32_t i = 0U; i < len; i += HAL_FLASH_WRITE_SIZE) {
+        /* Programming only clears bits, as on the real part, so writing over data the caller did not erase shows */
+        const bool powered = _hal_flash_spend_power();
+        const uint32_t n = powered ? HAL_FLASH_WRITE_SIZE : HAL_FLASH_WRITE_SIZE / 2U;
+        for (uint32_t j = 0U; j < n; ++j) {
+            hal_host_state.flash[address + i + j] &= src[i + j];
+        }
+        if (!powered) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hal_host_flash_open(const char *path) {
+    hal_host_flash_close();
+
+#if defined(__linux__)
+    const int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    const bool fresh = (fstat(fd, &st) != 0) || (st.st_size != (off_t)HAL_FLASH_SIZE);
+    if (fresh && ftruncate(fd, HAL_FLASH_SIZE) != 0) {
+        close(fd);
+        return false;
+    }
+    void *mem = mmap(NULL, HAL_FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        return false;
+    }
+
+    hal_host_state.flash = mem;
+    if (fresh) {
+        memset(hal_host_state.flash, HAL_FLASH_ERASED_BYTE, HAL_FLASH_SIZE);
+    }
+    memset(hal_host_state.flash_erase_count, 0, sizeof(hal_host_state.flash_erase_count));
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+void hal_host_flash_close(void) {
+    if (hal_host_state.flash == NULL) {
+        return;
+    }
+
+#if defined(__linux__)
+    msync(hal_host_state.flash, HAL_FLASH_SIZE, MS_SYNC);
+    munmap(hal_host_state.flash, HAL_FLASH_SIZE);
+#endif
+    hal_host_state.flash = NULL;
+}
@@ -24,15 +24,17 @@
  * Function Definitions
  *******************************************************************************************************************************/
 void hal_gpio_init(void) {
-    hal_host_state.hall_abc = 0U;
-    hal_host_state.hall_timestamp_us = 0U;
+    for (int m = 0; m < NUM_HAL_MOTORS; m++) {
+        hal_host_state.motors[m].hall_abc = 0U;
+        hal_host_state.motors[m].hall_timestamp_ticks = 0U;
+    }
 }
 
-uint8_t hal_gpio_get_hall_state(void) {
+uint8_t hal_gpio_get_hall_state(HalMotor_t motor) {
     /* Mask first three bits */
-    return hal_host_state.hall_abc & 0x07U;
+    return hal_host_state.motors[motor].hall_abc & 0x07U;
 }
 
-uint32_t hal_gpio_get_hall_timestamp_us(void) {
-    return hal_host_state.hall_timestamp_us;
+uint32_t hal_gpio_get_hall_timestamp_ticks(HalMotor_t motor) {
+    return hal_host_state.motors[motor].hall_timestamp_ticks;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*******************************************************************************************************************************
+ * @file   host_blackbox.c
+ *
+ * @brief  Source file for the host fault black-box export
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "blackbox.h"
+
+/* Intra-component Headers */
+#include "host_blackbox.h"
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+bool host_blackbox_write_csv(const Esc_t *esc, const char *path)
+{
+    if (blackbox_get_num_samples(esc) == 0U || path == NULL) {
+        return false;
+    }
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+    const bool written = host_blackbox_write(esc, file);
+    return (fclose(file) == 0) && written;
+}
+
+bool host_blackbox_write(const Esc_t *esc, FILE *file)
+{
+    const uint32_t count = blackbox_get_num_samples(esc);
+    if (count == 0U || file == NULL) {
+        return false;
+    }
+
+    /* Times count from the oldest snapshot, so a wrapped recorder clock still reads forwards */
+    EscBlackBoxSample_t first;
+    (void)blackbox_get_sample(esc, 0U, &first);
+    const int32_t trigger = blackbox_get_trigger_index(esc);
+    fprintf(file, "# esc black box: %u samples, %s\n", (unsigned)count,
+            blackbox_is_frozen(esc) ? "frozen" : "recording");
+    if (trigger >= 0) {
+        EscBlackBoxSample_t at;
+        (void)blackbox_get_sample(esc, (uint32_t)trigger, &at);
+        fprintf(file, "# trigger sample %d at %u us: fault_flags 0x%02x new, hal_fault 0x%02x\n", (int)trigger,
+                (unsigned)(at.time_us - first.time_us), (unsigned)esc->blackbox.trigger_fault_flags,
+                (unsigned)esc->blackbox.trigger_hal_fault);
+    }
+    fprintf(file, "time_us,ia,ib,ic,vbus,temp_C,hall,duty,fault_flags,hal_fault,direction_state,elec_angle\n");
+
+    for (uint32_t i = 0U; i < count; ++i) {
+        EscBlackBoxSample_t s;
+        (void)blackbox_get_sample(esc, i, &s);
+        fprintf(file, "%u,%.2f,%.2f,%.2f,%.2f,%.1f,%u,%.4f,0x%02x,0x%02x,0x%02x,%u\n",
+                (unsigned)(s.time_us - first.time_us), 0.01 * s.phase_current_cA[MOTOR_PHASE_A],
+                0.01 * s.phase_current_cA[MOTOR_PHASE_B], 0.01 * s.phase_current_cA[MOTOR_PHASE_C], 0.01 * s.vbus_cV, 0.1 * s.temperature_dC,
+                (unsigned)s.hall_abc, s.duty / 65535.0, (unsigned)s.fault_flags, (unsigned)s.hal_fault,
+                (unsigned)s.direction_state, (unsigned)s.elec_angle);
+    }
+
+    return ferror(file) == 0;
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************************************************************
+ * @file   host_check.c
+ *
+ * @brief  Source file for the host scenario checks
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_check.h"
+#include "host_plant.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Named check
+ */
+typedef struct {
+    const char *name;          /**< Name for -c */
+    uint32_t (*run)(void);     /**< Check, returning its failed measurements */
+} HostCheck_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const HostCheck_t host_checks[] = {
+    { "reversal", host_check_reversal },
+    { "regen", host_check_regen },
+    { "sync-rect", host_check_sync_rect },
+    { "thermal", host_check_thermal },
+    { "battery", host_check_battery },
+    { "stall", host_check_stall },
+    { "sine", host_check_sine },
+    { "dead-time", host_check_dead_time },
+    { "field-weakening", host_check_field_weakening },
+    { "mtpa", host_check_mtpa },
+    { "sensorless", host_check_sensorless },
+    { "torn-write", host_check_torn_write },
+    { "blackbox", host_check_blackbox },
+    { "timer-wrap", host_check_timer_wrap },
+    { "deadline", host_check_deadline },
+};
+
+#define HOST_CHECK_COUNT (sizeof(host_checks) / sizeof(host_checks[0]))
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_check_run(const char *name)
+{
+    uint32_t failures = 0U;
+    uint32_t ran = 0U;
+    for (uint32_t c = 0U; c < HOST_CHECK_COUNT; ++c) {
+        if (name != NULL && strcmp(name, host_checks[c].name) != 0) {
+            continue;
+        }
+        printf("%s:\n", host_checks[c].name);
+        failures += host_checks[c].run();
+        ran++;
+    }
+
+    if (ran == 0U) {
+        fprintf(stderr, "check: unknown check %s, one of:", name);
+        for (uint32_t c = 0U; c < HOST_CHECK_COUNT; ++c) {
+            fprintf(stderr, " %s", host_checks[c].name);
+        }
+        fprintf(stderr, "\n");
+        return 1U;
+    }
+    return failures;
+}
+
+void host_check_default_setup(HostPlantParams_t *params, EscConfig_t *cfg)
+{
+    host_plant_default_params(params);
+    host_plant_default_esc_config(cfg);
+    cfg->deadline.degrade_overruns = 0U;
+}
+
+bool host_check_rig_init(HostCheckRig_t *rig, const HostPlantParams_t *params, const EscConfig_t *cfg)
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    host_plant_init(&rig->plant, HAL_MOTOR_0, params);
+    rig->time_us = 0U;
+    rig->fault_flags = ESC_FAULT_NONE;
+    return esc_init(&rig->esc, HAL_MOTOR_0, cfg);
+}
+
+void host_check_rig_step(HostCheckRig_t *rig)
+{
+    host_plant_step(&rig->plant, HAL_PWM_PERIOD_US);
+    MotorState_t motor_state;
+    hal_host_test_utils_get_motor_state(rig->esc.hal_motor, &motor_state);
+    esc_set_motor_state(&rig->esc, &motor_state);
+    esc_step(&rig->esc, HAL_PWM_PERIOD_US);
+    const EscInverterCmd_t cmd = esc_get_inverter_cmd(&rig->esc);
+    hal_pwm_apply_inverter_cmd(rig->esc.hal_motor, &cmd);
+    rig->time_us += HAL_PWM_PERIOD_US;
+    rig->fault_flags |= (uint32_t)esc_get_fault_flags(&rig->esc);
+}
+
+void host_check_rig_run(HostCheckRig_t *rig, uint32_t duration_us)
+{
+    const uint32_t end_us = rig->time_us + duration_us;
+    while ((int32_t)(end_us - rig->time_us) > 0) {
+        host_check_rig_step(rig);
+    }
+}
+
+uint32_t host_check_expect(bool ok, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("  ");
+    vprintf(format, args);
+    printf(" %s\n", ok ? "ok" : "FAIL");
+    va_end(args);
+    return ok ? 0U : 1U;
+}
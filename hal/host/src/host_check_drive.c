@@ -0,0 +1,552 @@
+/*******************************************************************************************************************************
+ * @file   host_check_drive.c
+ *
+ * @brief  Source file for the host drive scenario checks: reversal, braking, losses, limits and stall
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "pwm.h"
+#include "trapezoidal.h"
+
+/* Intra-component Headers */
+#include "host_check.h"
+#include "host_plant.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_CHECK_SPIN_UP_TIMEOUT_US 5000000U  /* Longest full-throttle spin-up to a scenario's start speed */
+
+#define HOST_CHECK_REVERSAL_TOP_US 4000000U     /* Full-throttle run to top speed, where the reversals start */
+#define HOST_CHECK_REVERSAL_PASS_RPM (-100.0f)  /* Speed the rotor must pass in reverse */
+#define HOST_CHECK_REVERSAL_TIMEOUT_US 3000000U /* Time it must pass it in */
+#define HOST_CHECK_REVERSAL_PLUG_US 20000U      /* Direct plug run of the baseline */
+#define HOST_CHECK_REVERSAL_MAX_PEAK 0.9f       /* Peak phase current over the trip, at most */
+#define HOST_CHECK_REVERSAL_MAX_PLUG_RATIO 0.25f /* Peak phase current over the direct plug's, at most */
+
+#define HOST_CHECK_REGEN_START_RPM 3640.0f      /* Speed the brake is applied at */
+#define HOST_CHECK_REGEN_BRAKE 0.8f             /* Brake commanded */
+#define HOST_CHECK_REGEN_STOP_RPM 60.0f         /* Speed that counts as stopped */
+#define HOST_CHECK_REGEN_TIMEOUT_US 2000000U    /* Time the rotor must stop in */
+#define HOST_CHECK_REGEN_MIN_RECOVERED 0.6f     /* Kinetic energy a charging pack must get back, at least */
+
+#define HOST_CHECK_SR_LOAD_NM 0.6f              /* Load of the conduction loss comparison */
+#define HOST_CHECK_SR_THROTTLE 0.4f             /* Throttle of the conduction loss comparison */
+#define HOST_CHECK_SETTLE_US 2000000U           /* Time to steady state before measuring */
+#define HOST_CHECK_MEASURE_US 1000000U          /* Steady-state measurement window */
+#define HOST_CHECK_SR_MAX_LOSS_RATIO 0.5f       /* Conduction loss with over without rectification, at most */
+
+#define HOST_CHECK_THERMAL_LOAD_NM 1.4f         /* Load the derated drive can still carry, at full throttle */
+#define HOST_CHECK_THERMAL_HEAVY_NM 2.0f        /* Load the derated drive cannot carry, at full throttle */
+#define HOST_CHECK_THERMAL_SCALE 20.0f          /* Heat capacities divided by this, 50 min of heating in 150 s */
+#define HOST_CHECK_THERMAL_RUN_US 150000000U    /* Thermal run */
+#define HOST_CHECK_THERMAL_HEAVY_RUN_US 40000000U /* Thermal run with the heavy load */
+#define HOST_CHECK_THERMAL_MAX_WINDING_C 55.0f  /* Winding limit of the derating */
+#define HOST_CHECK_THERMAL_BAND_C 10.0f         /* Derating band below it */
+#define HOST_CHECK_THERMAL_MAX_DERATE 0.5f      /* Derating factor at the end, at most */
+#define HOST_CHECK_THERMAL_MIN_RPM 3000.0f      /* Speed the carried load must hold, at least */
+
+#define HOST_CHECK_BATTERY_LOAD_NM 1.0f         /* Load of the battery runs, at full throttle */
+#define HOST_CHECK_BATTERY_RUN_US 3000000U      /* Battery run */
+#define HOST_CHECK_BATTERY_WINDOW_US 1000U      /* Battery current averaging window */
+#define HOST_CHECK_BATTERY_DISCHARGE_A 25.0f    /* Discharge current limit */
+#define HOST_CHECK_BATTERY_POWER_W 1000.0f      /* Input power limit */
+#define HOST_CHECK_BATTERY_TOLERANCE 0.05f      /* Peak windowed current over its limit, at most, relative */
+#define HOST_CHECK_BATTERY_MIN_USE 0.8f         /* Peak windowed current over its limit, at least */
+#define HOST_CHECK_BATTERY_WEAK_OHM 0.6f        /* Series resistance of the weak pack */
+
+#define HOST_CHECK_STALL_LOCKED_NM 100.0f       /* Load that locks the rotor */
+#define HOST_CHECK_STALL_RUN_US 3000000U        /* Locked-rotor run */
+#define HOST_CHECK_STALL_MIN_CUTBACK_US 200000U /* Cut-back time window */
+#define HOST_CHECK_STALL_MAX_CUTBACK_US 400000U
+#define HOST_CHECK_STALL_MIN_FAULT_US 2000000U  /* Stall fault time window */
+#define HOST_CHECK_STALL_MAX_FAULT_US 2300000U
+#define HOST_CHECK_STALL_START_NM 3.0f          /* Load of the full-throttle start that must not stall */
+#define HOST_CHECK_STALL_START_US 2000000U      /* Start run */
+#define HOST_CHECK_STALL_START_MIN_RPM 2000.0f  /* Speed the start must reach, at least */
+
+/**
+ * @brief   Battery limit run
+ */
+typedef struct {
+    const char *name;            /**< Printed name */
+    float max_discharge_A;       /**< EscBatteryConfig_t max_discharge_current_A */
+    float max_power_W;           /**< EscBatteryConfig_t max_power_W */
+    float sag_band_V;            /**< EscBatteryConfig_t sag_foldback_band_V */
+    float battery_Ohm;           /**< Plant battery resistance */
+} HostCheckBatteryRun_t;
+
+/**
+ * @brief   Commutation method a drive scenario runs with
+ */
+typedef struct {
+    EscCommutationMethod_t method; /**< Commutation method */
+    const char *name;              /**< Printed name */
+} HostCheckMethod_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static HostCheckRig_t host_check_drive_rig;
+
+static const float host_check_reversal_throttles[] = { -0.5f, -0.8f, -1.0f };
+
+#define HOST_CHECK_REVERSAL_COUNT (sizeof(host_check_reversal_throttles) / sizeof(host_check_reversal_throttles[0]))
+
+static const HostCheckMethod_t host_check_methods[] = {
+    { ESC_COMMUTATION_METHOD_TRAP, "6-step" },
+    { ESC_COMMUTATION_METHOD_SINE, "sine" },
+};
+
+#define HOST_CHECK_METHOD_COUNT (sizeof(host_check_methods) / sizeof(host_check_methods[0]))
+
+static EscCommutationMethod_t host_check_drive_method = ESC_COMMUTATION_METHOD_TRAP; /* Method of the running scenario */
+
+static const HostCheckBatteryRun_t host_check_battery_runs[] = {
+    { "discharge limit", HOST_CHECK_BATTERY_DISCHARGE_A, 0.0f, 0.0f, 0.05f },
+    { "power limit", 0.0f, HOST_CHECK_BATTERY_POWER_W, 0.0f, 0.05f },
+    { "weak pack without foldback", 0.0f, 0.0f, 0.0f, HOST_CHECK_BATTERY_WEAK_OHM },
+    { "weak pack with foldback", 0.0f, 0.0f, 4.0f, HOST_CHECK_BATTERY_WEAK_OHM },
+};
+
+#define HOST_CHECK_BATTERY_RUN_COUNT (sizeof(host_check_battery_runs) / sizeof(host_check_battery_runs[0]))
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static void _host_check_default_setup(HostPlantParams_t *params, EscConfig_t *cfg)
+{
+    host_check_default_setup(params, cfg);
+    cfg->commutation_method = host_check_drive_method;
+}
+
+/* Run a scenario once with each commutation method */
+static uint32_t _host_check_each_method(uint32_t (*scenario)(void))
+{
+    uint32_t failures = 0U;
+    for (uint32_t m = 0U; m < HOST_CHECK_METHOD_COUNT; ++m) {
+        printf("  %s commutation:\n", host_check_methods[m].name);
+        host_check_drive_method = host_check_methods[m].method;
+        failures += scenario();
+    }
+    host_check_drive_method = ESC_COMMUTATION_METHOD_TRAP;
+    return failures;
+}
+
+static float _host_check_kinetic_energy_J(const HostPlant_t *plant)
+{
+    return 0.5f * plant->params.inertia_kgm2 * plant->omega_mech_rad_s * plant->omega_mech_rad_s;
+}
+
+static bool _host_check_spin_up(HostCheckRig_t *rig, float speed_rpm)
+{
+    esc_set_throttle(&rig->esc, 1.0f);
+    const uint32_t end_us = rig->time_us + HOST_CHECK_SPIN_UP_TIMEOUT_US;
+    while (host_plant_get_speed_rpm(&rig->plant) < speed_rpm) {
+        if (rig->time_us >= end_us || esc_is_faulted(&rig->esc)) {
+            return false;
+        }
+        host_check_rig_step(rig);
+    }
+    return true;
+}
+
+/**
+ * @brief   Set up a fresh rig and run it at full throttle to top speed
+ * @return  true if the ESC accepted the configuration and nothing faulted
+ */
+static bool _host_check_reversal_start(HostCheckRig_t *rig, const HostPlantParams_t *params, const EscConfig_t *cfg)
+{
+    if (!host_check_rig_init(rig, params, cfg)) {
+        return false;
+    }
+    esc_set_throttle(&rig->esc, 1.0f);
+    host_check_rig_run(rig, HOST_CHECK_REVERSAL_TOP_US);
+    host_plant_reset_stats(&rig->plant);
+    return rig->fault_flags == ESC_FAULT_NONE;
+}
+
+/**
+ * @brief   Step the plant under a direct plug, bypassing the ESC: the 6-step sequence shifted by half a turn from the
+ *          Hall state at a fixed duty, as negative throttle did before the direction state machine
+ */
+static void _host_check_plug_step(HostCheckRig_t *rig, float duty)
+{
+    host_plant_step(&rig->plant, HAL_PWM_PERIOD_US);
+    MotorState_t motor_state;
+    hal_host_test_utils_get_motor_state(rig->esc.hal_motor, &motor_state);
+
+    /* The ESC's last command supplies the dead time and the alignment */
+    EscInverterCmd_t cmd = esc_get_inverter_cmd(&rig->esc);
+    MotorPhase_t high;
+    MotorPhase_t low;
+    cmd.commutation_step = (uint8_t)((trapezoidal_hall_to_step(motor_state.hall_abc) + 3U) % 6U);
+    cmd.enable = trapezoidal_step_to_phases(cmd.commutation_step, &high, &low);
+    cmd.brake = false;
+    cmd.duty = duty * MAX_PWM_DUTY;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        cmd.phase_duty[i] = 0.0f;
+    }
+    cmd.high_enable_mask = 0U;
+    cmd.low_enable_mask = 0U;
+    if (cmd.enable) {
+        cmd.phase_duty[high] = duty;
+        cmd.high_enable_mask = ESC_PHASE_MASK(high);
+        cmd.low_enable_mask = ESC_PHASE_MASK(low);
+    }
+    hal_pwm_apply_inverter_cmd(rig->esc.hal_motor, &cmd);
+    rig->time_us += HAL_PWM_PERIOD_US;
+}
+
+static uint32_t _host_check_reversal(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    _host_check_default_setup(&params, &cfg);
+    const float trip_A = cfg.limits.max_phase_current_A;
+
+    /* Baseline: the direct plug at full reverse throttle, with no trip to cut it short */
+    if (!_host_check_reversal_start(rig, &params, &cfg)) {
+        return host_check_expect(false, "spin-up to top speed without a fault");
+    }
+    const float plug_rpm = host_plant_get_speed_rpm(&rig->plant);
+    const uint32_t plug_end_us = rig->time_us + HOST_CHECK_REVERSAL_PLUG_US;
+    while ((int32_t)(plug_end_us - rig->time_us) > 0) {
+        _host_check_plug_step(rig, 1.0f);
+    }
+    const float plug_peak_A = rig->plant.peak_phase_current_A;
+    printf("  direct plug at throttle -1.0 from %.0f rpm peaks at %.1f A\n", (double)plug_rpm, (double)plug_peak_A);
+
+    uint32_t failures = 0U;
+    for (uint32_t t = 0U; t < HOST_CHECK_REVERSAL_COUNT; ++t) {
+        const float throttle = host_check_reversal_throttles[t];
+        if (!_host_check_reversal_start(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "spin-up to top speed without a fault");
+        }
+        const float start_rpm = host_plant_get_speed_rpm(&rig->plant);
+        esc_set_throttle(&rig->esc, throttle);
+        const uint32_t start_us = rig->time_us;
+        while (host_plant_get_speed_rpm(&rig->plant) > HOST_CHECK_REVERSAL_PASS_RPM &&
+               rig->time_us - start_us < HOST_CHECK_REVERSAL_TIMEOUT_US) {
+            host_check_rig_step(rig);
+        }
+        const uint32_t reversal_us = rig->time_us - start_us;
+        const float peak_A = rig->plant.peak_phase_current_A;
+
+        failures += host_check_expect(reversal_us < HOST_CHECK_REVERSAL_TIMEOUT_US,
+                                      "throttle %.1f from %.0f rpm passes %.0f rpm after %.1f ms, within %.0f ms",
+                                      (double)throttle, (double)start_rpm, (double)HOST_CHECK_REVERSAL_PASS_RPM,
+                                      reversal_us / 1000.0, HOST_CHECK_REVERSAL_TIMEOUT_US / 1000.0);
+        failures += host_check_expect(peak_A <= HOST_CHECK_REVERSAL_MAX_PEAK * trip_A &&
+                                      peak_A <= HOST_CHECK_REVERSAL_MAX_PLUG_RATIO * plug_peak_A,
+                                      "throttle %.1f: peak phase current %.1f A, at most %.0f%% of the %.0f A trip "
+                                      "and %.0f%% of the direct plug's",
+                                      (double)throttle, (double)peak_A, 100.0 * (double)HOST_CHECK_REVERSAL_MAX_PEAK,
+                                      (double)trip_A, 100.0 * (double)HOST_CHECK_REVERSAL_MAX_PLUG_RATIO);
+        failures += host_check_expect(rig->esc.direction_state == ESC_DIRECTION_STATE_REVERSE &&
+                                      rig->fault_flags == ESC_FAULT_NONE,
+                                      "throttle %.1f: direction state %d, reverse; fault flags 0x%02x, none",
+                                      (double)throttle, (int)rig->esc.direction_state, (unsigned)rig->fault_flags);
+    }
+    return failures;
+}
+
+static uint32_t _host_check_regen(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    uint32_t failures = 0U;
+    for (int full = 0; full <= 1; ++full) {
+        _host_check_default_setup(&params, &cfg);
+        params.battery_accepts_charge = (full == 0);
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+
+        const char *pack = (full == 0) ? "charging pack" : "full pack";
+        failures += host_check_expect(_host_check_spin_up(rig, HOST_CHECK_REGEN_START_RPM), "%s: spin-up to %.0f rpm",
+                                      pack, (double)HOST_CHECK_REGEN_START_RPM);
+        const float kinetic_J = _host_check_kinetic_energy_J(&rig->plant);
+        host_plant_reset_stats(&rig->plant);
+        esc_set_throttle(&rig->esc, 0.0f);
+        esc_set_brake(&rig->esc, HOST_CHECK_REGEN_BRAKE);
+        const uint32_t start_us = rig->time_us;
+        while (host_plant_get_speed_rpm(&rig->plant) > HOST_CHECK_REGEN_STOP_RPM &&
+               rig->time_us - start_us < HOST_CHECK_REGEN_TIMEOUT_US) {
+            host_check_rig_step(rig);
+        }
+        const uint32_t stop_us = rig->time_us - start_us;
+        const float recovered = (float)(rig->plant.battery_energy_in_J - rig->plant.battery_energy_out_J) / kinetic_J;
+
+        /* A full pack takes nothing back: the brake may only release into the DC link, so the rotor coasts once the
+         * link is up to the release voltage, and only the bus voltage and faults are checked */
+        if (full == 0) {
+            failures += host_check_expect(stop_us < HOST_CHECK_REGEN_TIMEOUT_US,
+                                          "%s: brake %.1f stops in %.1f ms, within %.0f ms", pack,
+                                          (double)HOST_CHECK_REGEN_BRAKE, stop_us / 1000.0,
+                                          HOST_CHECK_REGEN_TIMEOUT_US / 1000.0);
+            failures += host_check_expect(recovered >= HOST_CHECK_REGEN_MIN_RECOVERED,
+                                          "%s: recovered %.0f%% of %.0f J kinetic, at least %.0f%%", pack,
+                                          100.0 * (double)recovered, (double)kinetic_J,
+                                          100.0 * (double)HOST_CHECK_REGEN_MIN_RECOVERED);
+        }
+        failures += host_check_expect(rig->plant.peak_bus_voltage_V < cfg.limits.vbus_ovlo_V,
+                                      "%s: peak bus %.2f V, below the %.0f V OVLO", pack,
+                                      (double)rig->plant.peak_bus_voltage_V, (double)cfg.limits.vbus_ovlo_V);
+        failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%s: fault flags 0x%02x, none", pack,
+                                      (unsigned)rig->fault_flags);
+    }
+    return failures;
+}
+
+static uint32_t _host_check_stall(void)
+{
+    static const float throttles[] = { 1.0f, 0.3f };
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    uint32_t failures = 0U;
+    for (uint32_t t = 0U; t < sizeof(throttles) / sizeof(throttles[0]); ++t) {
+        _host_check_default_setup(&params, &cfg);
+        params.load_torque_Nm = HOST_CHECK_STALL_LOCKED_NM;
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+
+        esc_set_throttle(&rig->esc, throttles[t]);
+        uint32_t cutback_us = 0U;
+        uint32_t fault_us = 0U;
+        while (rig->time_us < HOST_CHECK_STALL_RUN_US && fault_us == 0U) {
+            host_check_rig_step(rig);
+            if (cutback_us == 0U && rig->esc.stall_cutback) {
+                cutback_us = rig->time_us;
+            }
+            if ((rig->fault_flags & (uint32_t)ESC_FAULT_STALL) != 0U) {
+                fault_us = rig->time_us;
+            }
+        }
+
+        failures += host_check_expect(cutback_us >= HOST_CHECK_STALL_MIN_CUTBACK_US &&
+                                      cutback_us <= HOST_CHECK_STALL_MAX_CUTBACK_US,
+                                      "locked rotor, throttle %.1f: cut back at %.3f s, within %.1f-%.1f s",
+                                      (double)throttles[t], cutback_us / 1e6, HOST_CHECK_STALL_MIN_CUTBACK_US / 1e6,
+                                      HOST_CHECK_STALL_MAX_CUTBACK_US / 1e6);
+        failures += host_check_expect(fault_us >= HOST_CHECK_STALL_MIN_FAULT_US &&
+                                      fault_us <= HOST_CHECK_STALL_MAX_FAULT_US,
+                                      "locked rotor, throttle %.1f: stall fault at %.3f s, within %.1f-%.1f s",
+                                      (double)throttles[t], fault_us / 1e6, HOST_CHECK_STALL_MIN_FAULT_US / 1e6,
+                                      HOST_CHECK_STALL_MAX_FAULT_US / 1e6);
+        failures += host_check_expect(rig->fault_flags == (uint32_t)ESC_FAULT_STALL,
+                                      "locked rotor, throttle %.1f: fault flags 0x%02x, stall only",
+                                      (double)throttles[t], (unsigned)rig->fault_flags);
+    }
+
+    _host_check_default_setup(&params, &cfg);
+    params.load_torque_Nm = HOST_CHECK_STALL_START_NM;
+    if (!host_check_rig_init(rig, &params, &cfg)) {
+        return failures + host_check_expect(false, "configuration accepted");
+    }
+    esc_set_throttle(&rig->esc, 1.0f);
+    host_check_rig_run(rig, HOST_CHECK_STALL_START_US);
+    failures += host_check_expect(host_plant_get_speed_rpm(&rig->plant) >= HOST_CHECK_STALL_START_MIN_RPM &&
+                                  rig->fault_flags == ESC_FAULT_NONE,
+                                  "full-throttle start against %.0f N*m: %.0f rpm after %.0f s, fault flags 0x%02x, "
+                                  "at least %.0f rpm and none", (double)HOST_CHECK_STALL_START_NM,
+                                  (double)host_plant_get_speed_rpm(&rig->plant), HOST_CHECK_STALL_START_US / 1e6,
+                                  (unsigned)rig->fault_flags, (double)HOST_CHECK_STALL_START_MIN_RPM);
+    return failures;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_check_reversal(void)
+{
+    return _host_check_each_method(_host_check_reversal);
+}
+
+uint32_t host_check_regen(void)
+{
+    return _host_check_each_method(_host_check_regen);
+}
+
+uint32_t host_check_sync_rect(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    double loss_J[2];
+    float speed_rpm[2];
+    uint32_t failures = 0U;
+    for (int sr = 0; sr <= 1; ++sr) {
+        _host_check_default_setup(&params, &cfg);
+        params.load_torque_Nm = HOST_CHECK_SR_LOAD_NM;
+        cfg.pwm.synchronous_rectification = (sr == 1);
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+
+        esc_set_throttle(&rig->esc, HOST_CHECK_SR_THROTTLE);
+        host_check_rig_run(rig, HOST_CHECK_SETTLE_US);
+        host_plant_reset_stats(&rig->plant);
+        host_check_rig_run(rig, HOST_CHECK_MEASURE_US);
+        loss_J[sr] = rig->plant.conduction_loss_J;
+        speed_rpm[sr] = host_plant_get_speed_rpm(&rig->plant);
+        failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "rectification %s: fault flags 0x%02x, none",
+                                      (sr == 1) ? "on" : "off", (unsigned)rig->fault_flags);
+    }
+
+    failures += host_check_expect(loss_J[1] <= HOST_CHECK_SR_MAX_LOSS_RATIO * loss_J[0],
+                                  "conduction loss over %.0f s: %.2f J at %.0f rpm -> %.2f J at %.0f rpm, "
+                                  "at most %.0f%%",
+                                  HOST_CHECK_MEASURE_US / 1e6, loss_J[0], (double)speed_rpm[0], loss_J[1],
+                                  (double)speed_rpm[1], 100.0 * (double)HOST_CHECK_SR_MAX_LOSS_RATIO);
+    return failures;
+}
+
+uint32_t host_check_thermal(void)
+{
+    static const float loads_Nm[] = { HOST_CHECK_THERMAL_LOAD_NM, HOST_CHECK_THERMAL_HEAVY_NM };
+    static const uint32_t runs_us[] = { HOST_CHECK_THERMAL_RUN_US, HOST_CHECK_THERMAL_HEAVY_RUN_US };
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    uint32_t failures = 0U;
+    for (uint32_t l = 0U; l < sizeof(loads_Nm) / sizeof(loads_Nm[0]); ++l) {
+        _host_check_default_setup(&params, &cfg);
+        params.load_torque_Nm = loads_Nm[l];
+        params.winding_c_th_J_per_K /= HOST_CHECK_THERMAL_SCALE;
+        params.stator_c_th_J_per_K /= HOST_CHECK_THERMAL_SCALE;
+        params.fet_c_th_J_per_K /= HOST_CHECK_THERMAL_SCALE;
+        cfg.thermal.winding_c_th_J_per_K /= HOST_CHECK_THERMAL_SCALE;
+        cfg.thermal.fet_c_th_J_per_K /= HOST_CHECK_THERMAL_SCALE;
+        cfg.thermal.max_winding_temp_C = HOST_CHECK_THERMAL_MAX_WINDING_C;
+        cfg.thermal.derate_band_C = HOST_CHECK_THERMAL_BAND_C;
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+
+        esc_set_throttle(&rig->esc, 1.0f);
+        double peak_winding_C = rig->plant.winding_temp_C;
+        while (rig->time_us < runs_us[l]) {
+            host_check_rig_step(rig);
+            if (rig->plant.winding_temp_C > peak_winding_C) {
+                peak_winding_C = rig->plant.winding_temp_C;
+            }
+        }
+
+        const double load_Nm = (double)loads_Nm[l];
+        failures += host_check_expect(peak_winding_C < cfg.thermal.max_winding_temp_C,
+                                      "%.1f N*m for %.0f s: peak winding %.1f C, below the %.0f C limit", load_Nm,
+                                      runs_us[l] / 1e6, peak_winding_C, (double)cfg.thermal.max_winding_temp_C);
+        if (l == 0U) {
+            failures += host_check_expect(rig->esc.thermal_derate <= HOST_CHECK_THERMAL_MAX_DERATE &&
+                                          host_plant_get_speed_rpm(&rig->plant) >= HOST_CHECK_THERMAL_MIN_RPM,
+                                          "%.1f N*m: derated to %.2f at %.0f rpm, at most %.2f and at least %.0f rpm",
+                                          load_Nm, (double)rig->esc.thermal_derate,
+                                          (double)host_plant_get_speed_rpm(&rig->plant),
+                                          (double)HOST_CHECK_THERMAL_MAX_DERATE, (double)HOST_CHECK_THERMAL_MIN_RPM);
+            failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%.1f N*m: fault flags 0x%02x, none",
+                                          load_Nm, (unsigned)rig->fault_flags);
+        } else {
+            /* The derated current cannot hold the load, so the rotor slows to a stall, which is the only fault */
+            failures += host_check_expect(rig->fault_flags == (uint32_t)ESC_FAULT_STALL,
+                                          "%.1f N*m: fault flags 0x%02x, stall only", load_Nm,
+                                          (unsigned)rig->fault_flags);
+        }
+    }
+    return failures;
+}
+
+uint32_t host_check_battery(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_drive_rig;
+    uint32_t failures = 0U;
+    for (uint32_t r = 0U; r < HOST_CHECK_BATTERY_RUN_COUNT; ++r) {
+        const HostCheckBatteryRun_t *run = &host_check_battery_runs[r];
+        _host_check_default_setup(&params, &cfg);
+        params.load_torque_Nm = HOST_CHECK_BATTERY_LOAD_NM;
+        params.battery_resistance_Ohm = run->battery_Ohm;
+        cfg.battery.max_discharge_current_A = run->max_discharge_A;
+        cfg.battery.max_power_W = run->max_power_W;
+        cfg.battery.sag_foldback_band_V = run->sag_band_V;
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "%s: configuration accepted", run->name);
+        }
+
+        /* Peak of the battery current averaged over each window */
+        esc_set_throttle(&rig->esc, 1.0f);
+        double window_sum_A = 0.0;
+        uint32_t window_steps = 0U;
+        float peak_A = 0.0f;
+        while (rig->time_us < HOST_CHECK_BATTERY_RUN_US && !esc_is_faulted(&rig->esc)) {
+            host_check_rig_step(rig);
+            window_sum_A += (double)rig->plant.battery_current_A;
+            if (++window_steps * HAL_PWM_PERIOD_US >= HOST_CHECK_BATTERY_WINDOW_US) {
+                peak_A = fmaxf(peak_A, (float)(window_sum_A / window_steps));
+                window_sum_A = 0.0;
+                window_steps = 0U;
+            }
+        }
+
+        if (run->max_discharge_A > 0.0f) {
+            const float use = peak_A / run->max_discharge_A;
+            const bool ok = use >= HOST_CHECK_BATTERY_MIN_USE && use <= 1.0f + HOST_CHECK_BATTERY_TOLERANCE;
+            failures += host_check_expect(ok,
+                                          "%s: peak %.0f ms battery current %.1f A, %.0f-%.0f%% of the %.0f A limit",
+                                          run->name, HOST_CHECK_BATTERY_WINDOW_US / 1000.0, (double)peak_A,
+                                          100.0 * (double)HOST_CHECK_BATTERY_MIN_USE,
+                                          100.0 * (double)(1.0f + HOST_CHECK_BATTERY_TOLERANCE),
+                                          (double)run->max_discharge_A);
+        }
+        if (run->max_power_W > 0.0f) {
+            const float peak_W = peak_A * params.battery_ocv_V;
+            const float use = peak_W / run->max_power_W;
+            const bool ok = use >= HOST_CHECK_BATTERY_MIN_USE && use <= 1.0f + HOST_CHECK_BATTERY_TOLERANCE;
+            failures += host_check_expect(ok,
+                                          "%s: peak %.0f ms battery current %.1f A, %.0f W at %.0f V, %.0f-%.0f%% of "
+                                          "the %.0f W limit", run->name, HOST_CHECK_BATTERY_WINDOW_US / 1000.0,
+                                          (double)peak_A, (double)peak_W, (double)params.battery_ocv_V,
+                                          100.0 * (double)HOST_CHECK_BATTERY_MIN_USE,
+                                          100.0 * (double)(1.0f + HOST_CHECK_BATTERY_TOLERANCE),
+                                          (double)run->max_power_W);
+        }
+
+        /* The weak pack sags into UVLO unless the foldback holds the bus above it */
+        const bool uvlo = (rig->fault_flags & (uint32_t)ESC_FAULT_UVLO) != 0U;
+        if (run->battery_Ohm == HOST_CHECK_BATTERY_WEAK_OHM && run->sag_band_V == 0.0f) {
+            failures += host_check_expect(uvlo, "%s: %.2f ohm pack trips UVLO at %.2f s, fault flags 0x%02x",
+                                          run->name, (double)run->battery_Ohm, rig->time_us / 1e6,
+                                          (unsigned)rig->fault_flags);
+        } else {
+            failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE,
+                                          "%s: %.2f ohm pack at %.0f rpm, fault flags 0x%02x, none", run->name,
+                                          (double)run->battery_Ohm, (double)host_plant_get_speed_rpm(&rig->plant),
+                                          (unsigned)rig->fault_flags);
+        }
+    }
+    return failures;
+}
+
+uint32_t host_check_stall(void)
+{
+    return _host_check_each_method(_host_check_stall);
+}
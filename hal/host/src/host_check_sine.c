@@ -0,0 +1,394 @@
+/*******************************************************************************************************************************
+ * @file   host_check_sine.c
+ *
+ * @brief  Source file for the host sinusoidal drive scenario checks
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "host_check.h"
+#include "host_plant.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_CHECK_RAMP_US 1000000U             /* Throttle ramp to a waveform run's throttle */
+#define HOST_CHECK_SETTLE_US 2000000U           /* Time at that throttle before measuring */
+#define HOST_CHECK_MEASURE_US 1000000U          /* Waveform measurement window */
+
+#define HOST_CHECK_SINE_THROTTLE 0.5f           /* Throttle of the sine against 6-step comparison */
+#define HOST_CHECK_SINE_MAX_THD_RATIO 0.5f      /* Sine phase current THD over the 6-step one, at most */
+#define HOST_CHECK_SINE_MAX_RIPPLE_RATIO 0.7f   /* Sine torque ripple over the 6-step one, at most */
+
+#define HOST_CHECK_DEAD_TIME_THROTTLE 0.2f      /* Throttle of the dead-time compensation comparison */
+#define HOST_CHECK_DEAD_TIME_MAX_THD_RATIO 0.85f /* Phase current THD compensated over uncompensated, at most */
+
+#define HOST_CHECK_FW_SETTLE_US 6000000U        /* Time at full throttle before taking the top speed */
+#define HOST_CHECK_FW_MIN_GAIN 1.25f            /* Top speed at the first field weakening current over base, at least */
+
+#define HOST_CHECK_MTPA_SALIENCY 3.0f           /* Plant q-axis inductance over its d-axis one */
+#define HOST_CHECK_MTPA_LOAD_NM 1.5f            /* Load of the MTPA comparison */
+#define HOST_CHECK_MTPA_THROTTLE 0.5f           /* Throttle of the MTPA comparison */
+#define HOST_CHECK_MTPA_MAX_CURRENT_RATIO 0.95f /* Current per torque with MTPA over without, at most */
+
+#define HOST_CHECK_RPM_TO_RAD_S (6.28318530718f / 60.0f) /* Mechanical rpm to rad/s */
+
+#define HOST_CHECK_SENSORLESS_THROTTLE 0.5f        /* Throttle of the sensorless start-ups */
+#define HOST_CHECK_SENSORLESS_CONVERGE_US 1500000U /* Time to run on the observer, at most */
+#define HOST_CHECK_SENSORLESS_FORWARD_RPM 1500.0f  /* Forward speed to reach on the observer before settling */
+#define HOST_CHECK_SENSORLESS_FORWARD_US 3000000U  /* Time to reach that speed, at most */
+#define HOST_CHECK_SENSORLESS_SETTLE_US 500000U    /* Time at that speed before measuring the angle error */
+#define HOST_CHECK_SENSORLESS_MEASURE_US 500000U   /* Angle error measurement window */
+#define HOST_CHECK_SENSORLESS_MAX_MEAN_DEG 2.0f    /* Mean angle error magnitude, at most */
+#define HOST_CHECK_SENSORLESS_MAX_ERROR_DEG 5.0f   /* Angle error magnitude, at most */
+
+/**
+ * @brief   Phase A current and torque statistics over a whole number of samples
+ */
+typedef struct {
+    double current_sq_sum;       /**< Sum of squared phase A current */
+    double current_cos_sum;      /**< Phase A current times the cosine of the electrical angle */
+    double current_sin_sum;      /**< Phase A current times the sine of the electrical angle */
+    double torque_sum;           /**< Sum of electromagnetic torque */
+    double torque_sq_sum;        /**< Sum of squared electromagnetic torque */
+    uint32_t samples;            /**< Samples taken */
+} HostCheckWaveform_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static HostCheckRig_t host_check_sine_rig;
+
+static const float host_check_sine_loads_Nm[] = { 0.6f, 1.5f };
+
+#define HOST_CHECK_SINE_LOAD_COUNT (sizeof(host_check_sine_loads_Nm) / sizeof(host_check_sine_loads_Nm[0]))
+
+/* Field weakening current limits of the top speed runs, the first with it off */
+static const float host_check_fw_currents_A[] = { 0.0f, 20.0f, 30.0f, 48.0f };
+
+#define HOST_CHECK_FW_CURRENT_COUNT (sizeof(host_check_fw_currents_A) / sizeof(host_check_fw_currents_A[0]))
+
+/* Rotor speeds the sensorless drive starts against: at rest, caught spinning forward, and spinning the wrong way */
+static const float host_check_sensorless_speeds_rpm[] = { 0.0f, 1000.0f, 2500.0f, 4000.0f, -1000.0f, -2500.0f };
+
+#define HOST_CHECK_SENSORLESS_SPEED_COUNT \
+    (sizeof(host_check_sensorless_speeds_rpm) / sizeof(host_check_sensorless_speeds_rpm[0]))
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/* Phase current THD: everything but the fundamental, found synchronously with the rotor angle, over the fundamental */
+static float _host_check_waveform_thd(const HostCheckWaveform_t *w)
+{
+    const double rms_sq = w->current_sq_sum / w->samples;
+    const double fundamental_sq = 2.0 * (w->current_cos_sum * w->current_cos_sum +
+                                         w->current_sin_sum * w->current_sin_sum) / ((double)w->samples * w->samples);
+    return (float)(sqrt(fmax(rms_sq - fundamental_sq, 0.0)) / sqrt(fundamental_sq));
+}
+
+/* Torque ripple: RMS deviation from the mean torque over the mean */
+static float _host_check_waveform_ripple(const HostCheckWaveform_t *w)
+{
+    const double mean = w->torque_sum / w->samples;
+    const double var = w->torque_sq_sum / w->samples - mean * mean;
+    return (float)(sqrt(fmax(var, 0.0)) / fabs(mean));
+}
+
+/*
+ * Ramp to the throttle, settle and sample the plant every PWM period over the measurement window. The plant averages
+ * each leg over the period, so the samples miss no switching ripple.
+ */
+static bool _host_check_waveform_run(HostCheckRig_t *rig, const HostPlantParams_t *params, const EscConfig_t *cfg,
+                                     float throttle, HostCheckWaveform_t *w)
+{
+    if (!host_check_rig_init(rig, params, cfg)) {
+        return false;
+    }
+    while (rig->time_us < HOST_CHECK_RAMP_US) {
+        esc_set_throttle(&rig->esc, throttle * (float)rig->time_us / (float)HOST_CHECK_RAMP_US);
+        host_check_rig_step(rig);
+    }
+    esc_set_throttle(&rig->esc, throttle);
+    host_check_rig_run(rig, HOST_CHECK_SETTLE_US);
+
+    *w = (HostCheckWaveform_t){ 0 };
+    const uint32_t end_us = rig->time_us + HOST_CHECK_MEASURE_US;
+    while (rig->time_us < end_us) {
+        host_check_rig_step(rig);
+        const double current_A = (double)rig->plant.phase_currents_A[0];
+        const double theta = (double)rig->plant.theta_elec_rad;
+        w->current_sq_sum += current_A * current_A;
+        w->current_cos_sum += current_A * cos(theta);
+        w->current_sin_sum += current_A * sin(theta);
+        w->torque_sum += (double)rig->plant.torque_Nm;
+        w->torque_sq_sum += (double)rig->plant.torque_Nm * (double)rig->plant.torque_Nm;
+        w->samples++;
+    }
+    return true;
+}
+
+/* Defaults on a sinusoidal back-EMF plant, driven by the sinusoidal commutation */
+static void _host_check_sine_plant_setup(HostPlantParams_t *params, EscConfig_t *cfg)
+{
+    host_check_default_setup(params, cfg);
+    params->sinusoidal_bemf = true;
+    /* The default flux linkage is the trapezoid's fundamental; this plant's is its back-EMF peak */
+    cfg->motor_config.flux_linkage_Wb = params->bemf_constant_Vs / (float)params->num_pole_pairs;
+    cfg->commutation_method = ESC_COMMUTATION_METHOD_SINE;
+}
+
+/* PLL angle less the plant rotor angle in degrees, within +-180; the back-EMF phase leads the plant angle by 30 deg */
+static float _host_check_sensorless_angle_error_deg(const HostCheckRig_t *rig)
+{
+    const float plant_counts = rig->plant.theta_elec_rad * TRIG_ANGLE_COUNTS_PER_RAD + TRIG_ANGLE_COUNTS / 12.0f;
+    float error = fmodf(rig->esc.sensorless.pll_angle - plant_counts, TRIG_ANGLE_COUNTS);
+    if (error >= 0.5f * TRIG_ANGLE_COUNTS) {
+        error -= TRIG_ANGLE_COUNTS;
+    } else if (error < -0.5f * TRIG_ANGLE_COUNTS) {
+        error += TRIG_ANGLE_COUNTS;
+    }
+    return error * 360.0f / TRIG_ANGLE_COUNTS;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_check_sine(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_sine_rig;
+    uint32_t failures = 0U;
+    for (uint32_t l = 0U; l < HOST_CHECK_SINE_LOAD_COUNT; ++l) {
+        float thd[2];
+        float ripple[2];
+        float speed_rpm[2];
+        for (int sine = 0; sine <= 1; ++sine) {
+            HostCheckWaveform_t w;
+            host_check_default_setup(&params, &cfg);
+            params.load_torque_Nm = host_check_sine_loads_Nm[l];
+            cfg.commutation_method = (sine == 1) ? ESC_COMMUTATION_METHOD_SINE : ESC_COMMUTATION_METHOD_TRAP;
+            if (!_host_check_waveform_run(rig, &params, &cfg, HOST_CHECK_SINE_THROTTLE, &w)) {
+                return failures + host_check_expect(false, "configuration accepted");
+            }
+            thd[sine] = _host_check_waveform_thd(&w);
+            ripple[sine] = _host_check_waveform_ripple(&w);
+            speed_rpm[sine] = host_plant_get_speed_rpm(&rig->plant);
+            failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%.1f N*m %s: fault flags 0x%02x, none",
+                                          (double)params.load_torque_Nm, (sine == 1) ? "sine" : "6-step",
+                                          (unsigned)rig->fault_flags);
+        }
+
+        const double load_Nm = (double)host_check_sine_loads_Nm[l];
+        failures += host_check_expect(thd[1] <= HOST_CHECK_SINE_MAX_THD_RATIO * thd[0],
+                                      "%.1f N*m: phase current THD %.1f%% at %.0f rpm 6-step -> %.1f%% at %.0f rpm "
+                                      "sine, at most %.0f%% of it", load_Nm, 100.0 * (double)thd[0],
+                                      (double)speed_rpm[0], 100.0 * (double)thd[1], (double)speed_rpm[1],
+                                      100.0 * (double)HOST_CHECK_SINE_MAX_THD_RATIO);
+        failures += host_check_expect(ripple[1] <= HOST_CHECK_SINE_MAX_RIPPLE_RATIO * ripple[0],
+                                      "%.1f N*m: torque ripple %.1f%% RMS 6-step -> %.1f%% sine, at most %.0f%% of it",
+                                      load_Nm, 100.0 * (double)ripple[0], 100.0 * (double)ripple[1],
+                                      100.0 * (double)HOST_CHECK_SINE_MAX_RIPPLE_RATIO);
+    }
+    return failures;
+}
+
+uint32_t host_check_dead_time(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_sine_rig;
+    uint32_t failures = 0U;
+    for (uint32_t l = 0U; l < HOST_CHECK_SINE_LOAD_COUNT; ++l) {
+        float thd[2];
+        for (int compensated = 0; compensated <= 1; ++compensated) {
+            HostCheckWaveform_t w;
+            host_check_default_setup(&params, &cfg);
+            params.load_torque_Nm = host_check_sine_loads_Nm[l];
+            cfg.commutation_method = ESC_COMMUTATION_METHOD_SINE;
+            cfg.pwm.dead_time_compensation = (compensated == 1);
+            if (!_host_check_waveform_run(rig, &params, &cfg, HOST_CHECK_DEAD_TIME_THROTTLE, &w)) {
+                return failures + host_check_expect(false, "configuration accepted");
+            }
+            thd[compensated] = _host_check_waveform_thd(&w);
+            failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%.1f N*m %s: fault flags 0x%02x, none",
+                                          (double)params.load_torque_Nm,
+                                          (compensated == 1) ? "compensated" : "uncompensated",
+                                          (unsigned)rig->fault_flags);
+        }
+
+        failures += host_check_expect(thd[1] <= HOST_CHECK_DEAD_TIME_MAX_THD_RATIO * thd[0],
+                                      "%.1f N*m: phase current THD %.1f%% -> %.1f%% with dead-time compensation, at "
+                                      "most %.0f%% of it", (double)host_check_sine_loads_Nm[l], 100.0 * (double)thd[0],
+                                      100.0 * (double)thd[1], 100.0 * (double)HOST_CHECK_DEAD_TIME_MAX_THD_RATIO);
+    }
+    return failures;
+}
+
+uint32_t host_check_field_weakening(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_sine_rig;
+    uint32_t failures = 0U;
+    float base_rpm = 0.0f;
+    float last_rpm = 0.0f;
+    for (uint32_t c = 0U; c < HOST_CHECK_FW_CURRENT_COUNT; ++c) {
+        _host_check_sine_plant_setup(&params, &cfg);
+        cfg.field_weakening.max_current_A = host_check_fw_currents_A[c];
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+        while (rig->time_us < HOST_CHECK_RAMP_US) {
+            esc_set_throttle(&rig->esc, (float)rig->time_us / (float)HOST_CHECK_RAMP_US);
+            host_check_rig_step(rig);
+        }
+        esc_set_throttle(&rig->esc, 1.0f);
+        host_check_rig_run(rig, HOST_CHECK_FW_SETTLE_US);
+
+        const float top_rpm = host_plant_get_speed_rpm(&rig->plant);
+        const double current_A = (double)cfg.field_weakening.max_current_A;
+        if (c == 0U) {
+            base_rpm = top_rpm;
+            printf("  no field weakening: top speed %.0f rpm\n", (double)top_rpm);
+        } else if (c == 1U) {
+            failures += host_check_expect(top_rpm >= HOST_CHECK_FW_MIN_GAIN * base_rpm,
+                                          "%.0f A field weakening: top speed %.0f rpm, %.2f times base, at least %.2f",
+                                          current_A, (double)top_rpm, (double)(top_rpm / base_rpm),
+                                          (double)HOST_CHECK_FW_MIN_GAIN);
+        } else {
+            failures += host_check_expect(top_rpm > last_rpm,
+                                          "%.0f A field weakening: top speed %.0f rpm, %.2f times base, above "
+                                          "%.0f rpm", current_A, (double)top_rpm, (double)(top_rpm / base_rpm),
+                                          (double)last_rpm);
+        }
+        last_rpm = top_rpm;
+        failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%.0f A field weakening: fault flags "
+                                      "0x%02x, none", current_A, (unsigned)rig->fault_flags);
+    }
+    return failures;
+}
+
+uint32_t host_check_mtpa(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_sine_rig;
+    uint32_t failures = 0U;
+    float amps_per_Nm[2];
+    for (int mtpa = 0; mtpa <= 1; ++mtpa) {
+        HostCheckWaveform_t w;
+        _host_check_sine_plant_setup(&params, &cfg);
+        params.q_axis_inductance_H = HOST_CHECK_MTPA_SALIENCY * params.phase_inductance_H;
+        params.load_torque_Nm = HOST_CHECK_MTPA_LOAD_NM;
+        /* Without the q-axis inductance the ESC takes the motor for non-salient and leaves MTPA out */
+        cfg.motor_config.q_axis_inductance_H = (mtpa == 1) ? params.q_axis_inductance_H : 0.0f;
+        if (!_host_check_waveform_run(rig, &params, &cfg, HOST_CHECK_MTPA_THROTTLE, &w)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+
+        const double current_rms_A = sqrt(w.current_sq_sum / w.samples);
+        const double torque_Nm = w.torque_sum / w.samples;
+        amps_per_Nm[mtpa] = (float)(current_rms_A / torque_Nm);
+        printf("  %s: %.0f rpm, %.1f A RMS for %.2f N*m, %.2f A/(N*m)\n", (mtpa == 1) ? "MTPA" : "no MTPA",
+               (double)host_plant_get_speed_rpm(&rig->plant), current_rms_A, torque_Nm, (double)amps_per_Nm[mtpa]);
+        failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "%s: fault flags 0x%02x, none",
+                                      (mtpa == 1) ? "MTPA" : "no MTPA", (unsigned)rig->fault_flags);
+    }
+    failures += host_check_expect(amps_per_Nm[1] <= HOST_CHECK_MTPA_MAX_CURRENT_RATIO * amps_per_Nm[0],
+                                  "current per torque %.2f -> %.2f A/(N*m) with MTPA, at most %.0f%% of it",
+                                  (double)amps_per_Nm[0], (double)amps_per_Nm[1],
+                                  100.0 * (double)HOST_CHECK_MTPA_MAX_CURRENT_RATIO);
+    return failures;
+}
+
+uint32_t host_check_sensorless(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_sine_rig;
+    uint32_t failures = 0U;
+    for (uint32_t v = 0U; v < HOST_CHECK_SENSORLESS_SPEED_COUNT; ++v) {
+        const float start_rpm = host_check_sensorless_speeds_rpm[v];
+        _host_check_sine_plant_setup(&params, &cfg);
+        cfg.feedback_mechanism = ESC_FEEDBACK_MECHANISM_SENSORLESS;
+        if (!host_check_rig_init(rig, &params, &cfg)) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+        rig->plant.omega_mech_rad_s = start_rpm * HOST_CHECK_RPM_TO_RAD_S;
+
+        esc_set_throttle(&rig->esc, HOST_CHECK_SENSORLESS_THROTTLE);
+        while (rig->esc.sensorless.state != ESC_SENSORLESS_STATE_RUN &&
+               rig->time_us < HOST_CHECK_SENSORLESS_CONVERGE_US && rig->fault_flags == ESC_FAULT_NONE) {
+            host_check_rig_step(rig);
+        }
+        const uint32_t converge_us = rig->time_us;
+        const bool converged = rig->esc.sensorless.state == ESC_SENSORLESS_STATE_RUN;
+        failures += host_check_expect(converged, "from %.0f rpm: on the observer after %.3f s, within %.1f s",
+                                      (double)start_rpm, converge_us / 1e6,
+                                      HOST_CHECK_SENSORLESS_CONVERGE_US / 1e6);
+        if (!converged) {
+            continue;
+        }
+
+        /* A rotor caught turning the wrong way is braked and restarted first */
+        const uint32_t forward_end_us = rig->time_us + HOST_CHECK_SENSORLESS_FORWARD_US;
+        while ((rig->esc.sensorless.state != ESC_SENSORLESS_STATE_RUN ||
+                host_plant_get_speed_rpm(&rig->plant) < HOST_CHECK_SENSORLESS_FORWARD_RPM) &&
+               rig->time_us < forward_end_us && rig->fault_flags == ESC_FAULT_NONE) {
+            host_check_rig_step(rig);
+        }
+        const bool forward = rig->esc.sensorless.state == ESC_SENSORLESS_STATE_RUN &&
+                             host_plant_get_speed_rpm(&rig->plant) >= HOST_CHECK_SENSORLESS_FORWARD_RPM;
+        failures += host_check_expect(forward, "from %.0f rpm: forward past %.0f rpm on the observer after %.3f s, "
+                                      "within %.1f s more", (double)start_rpm,
+                                      (double)HOST_CHECK_SENSORLESS_FORWARD_RPM, rig->time_us / 1e6,
+                                      HOST_CHECK_SENSORLESS_FORWARD_US / 1e6);
+        if (!forward) {
+            continue;
+        }
+
+        host_check_rig_run(rig, HOST_CHECK_SENSORLESS_SETTLE_US);
+        double error_sum_deg = 0.0;
+        float error_max_deg = 0.0f;
+        uint64_t fast_cycles = 0U;
+        uint32_t samples = 0U;
+        const uint32_t end_us = rig->time_us + HOST_CHECK_SENSORLESS_MEASURE_US;
+        while (rig->time_us < end_us) {
+            host_check_rig_step(rig);
+            const float error_deg = _host_check_sensorless_angle_error_deg(rig);
+            error_sum_deg += (double)fabsf(error_deg);
+            error_max_deg = fmaxf(error_max_deg, fabsf(error_deg));
+            fast_cycles += rig->esc.tasks[ESC_TASK_FAST].last_cycles;
+            samples++;
+        }
+        const float error_mean_deg = (float)(error_sum_deg / samples);
+        failures += host_check_expect(error_mean_deg <= HOST_CHECK_SENSORLESS_MAX_MEAN_DEG &&
+                                      error_max_deg <= HOST_CHECK_SENSORLESS_MAX_ERROR_DEG &&
+                                      rig->esc.sensorless.state == ESC_SENSORLESS_STATE_RUN,
+                                      "from %.0f rpm: angle error %.2f deg mean, %.2f deg max at %.0f rpm, at most "
+                                      "%.0f and %.0f deg; fast task %.0f cycles", (double)start_rpm,
+                                      (double)error_mean_deg, (double)error_max_deg,
+                                      (double)host_plant_get_speed_rpm(&rig->plant),
+                                      (double)HOST_CHECK_SENSORLESS_MAX_MEAN_DEG,
+                                      (double)HOST_CHECK_SENSORLESS_MAX_ERROR_DEG, (double)fast_cycles / samples);
+        failures += host_check_expect(rig->fault_flags == ESC_FAULT_NONE, "from %.0f rpm: fault flags 0x%02x, none",
+                                      (double)start_rpm, (unsigned)rig->fault_flags);
+    }
+    return failures;
+}
@@ -0,0 +1,518 @@
+/*******************************************************************************************************************************
+ * @file   host_check_system.c
+ *
+ * @brief  Source file for the host system scenario checks: command latching, timing, deadlines and fault records
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "blackbox.h"
+#include "esc.h"
+#include "fault.h"
+#include "hal_time.h"
+#include "motor.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_blackbox.h"
+#include "host_check.h"
+#include "host_plant.h"
+#include "host_pwm.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_CHECK_TORN_WRITE_PAIRS 14U     /* Command pairs, the second written over the first at every hook point */
+
+#define HOST_CHECK_DEADLINE_NS 1U           /* Deadline every esc_step() call overruns */
+#define HOST_CHECK_DEADLINE_DEGRADE 5U      /* Overruns that latch degraded mode */
+#define HOST_CHECK_DEADLINE_THROTTLE 0.3f   /* Throttle of the degraded run */
+#define HOST_CHECK_DEADLINE_RUN_US 1000000U /* Degraded run */
+
+#define HOST_CHECK_BLACKBOX_THROTTLE 0.3f    /* Throttle of the runs the faults hit */
+#define HOST_CHECK_BLACKBOX_LEAD_US 100000U  /* Run before the fault, enough to wrap the ring */
+#define HOST_CHECK_BLACKBOX_SPIKE_A 90.0f    /* Injected phase A current sample, past the overcurrent limit */
+#define HOST_CHECK_BLACKBOX_LINE_LEN 256U    /* Longest export line read back */
+
+#define HOST_CHECK_WRAP_LOAD_NM 0.05f       /* Load of the steady-speed run */
+#define HOST_CHECK_WRAP_RAMP_US 1000000U    /* Throttle ramp to full */
+#define HOST_CHECK_WRAP_SETTLE_US 2000000U  /* Full throttle before measuring */
+#define HOST_CHECK_WRAP_MEASURE_US 2000000U /* Speed estimate measurement window */
+#define HOST_CHECK_WRAP_LEAD_US 1000000U    /* Start of the wrapping run before the 32-bit tick counter wraps */
+#define HOST_CHECK_WRAP_MIN_RPM 4000.0f     /* Steady speed, at least */
+#define HOST_CHECK_WRAP_MAX_RMS_RPM 1.0f    /* Speed estimate error RMS, at most */
+#define HOST_CHECK_WRAP_MAX_ERROR_RPM 2.0f  /* Speed estimate error, at most */
+#define HOST_CHECK_WRAP_EDGE_US 1000U       /* Hall edge interval of the stop-and-go run */
+#define HOST_CHECK_WRAP_EDGES 12U           /* Hall edges before the stop */
+#define HOST_CHECK_WRAP_MAX_EDGE_ERROR 0.01f /* Speed estimate error of the stop-and-go run, at most, relative */
+
+/**
+ * @brief   Steady-speed run results
+ */
+typedef struct {
+    float speed_rpm;             /**< Plant speed at the end */
+    float error_rms_rpm;         /**< Speed estimate error RMS over the measurement window */
+    float error_max_rpm;         /**< Largest speed estimate error over the measurement window */
+    uint32_t fault_flags;        /**< EscFault_t bits raised during the run */
+    uint64_t end_ticks;          /**< Timer ticks at the end */
+} HostCheckWrapRun_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static uint32_t host_check_torn_write_hook_calls;  /* Hook calls since the current command write started */
+static uint32_t host_check_torn_write_event_at;    /* Hook call the update event is injected at, 0 for none */
+
+static HostCheckRig_t host_check_system_rig;
+
+/* Hall states in forward order */
+static const uint8_t host_check_wrap_hall_sequence[6] = { 0x4U, 0x5U, 0x1U, 0x3U, 0x2U, 0x6U };
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static void _host_check_torn_write_hook(void)
+{
+    host_check_torn_write_hook_calls++;
+    if (host_check_torn_write_hook_calls == host_check_torn_write_event_at) {
+        hal_host_pwm_update_event(HAL_MOTOR_0);
+    }
+}
+
+/* Command number n, differing from its neighbours in every field */
+static EscInverterCmd_t _host_check_torn_write_cmd(uint32_t n)
+{
+    EscInverterCmd_t cmd = { 0 };
+    cmd.enable = (n % 2U) == 0U;
+    cmd.duty = 0.05f * (float)(n + 1U);
+    cmd.commutation_step = (uint8_t)(n % 6U);
+    cmd.brake = (n % 2U) == 1U;
+    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+        cmd.phase_duty[i] = 0.01f * (float)(n + 1U) + 0.3f * (float)i;
+    }
+    cmd.high_enable_mask = (uint8_t)((n % 2U) == 0U ? ESC_PHASE_MASK_ALL : 0U);
+    cmd.low_enable_mask = (uint8_t)((n % 2U) == 0U ? 0U : ESC_PHASE_MASK_ALL);
+    cmd.dead_time_ns = (uint16_t)(100U + 10U * n);
+    cmd.center_aligned = (n % 2U) == 1U;
+    return cmd;
+}
+
+static bool _host_check_cmd_equal(const EscInverterCmd_t *a, const EscInverterCmd_t *b)
+{
+    bool equal = a->enable == b->enable && a->duty == b->duty && a->commutation_step == b->commutation_step &&
+                 a->brake == b->brake && a->high_enable_mask == b->high_enable_mask &&
+                 a->low_enable_mask == b->low_enable_mask && a->dead_time_ns == b->dead_time_ns &&
+                 a->center_aligned == b->center_aligned;
+    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+        equal = equal && a->phase_duty[i] == b->phase_duty[i];
+    }
+    return equal;
+}
+
+static bool _host_check_latched_is(const EscInverterCmd_t *expected)
+{
+    EscInverterCmd_t latched;
+    return hal_host_test_utils_get_inverter_cmd(HAL_MOTOR_0, &latched) && _host_check_cmd_equal(&latched, expected);
+}
+
+/* Step the rig n times and return whether degraded mode is latched after the last */
+static bool _host_check_deadline_steps(HostCheckRig_t *rig, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; ++i) {
+        host_check_rig_step(rig);
+    }
+    return esc_get_deadline_stats(&rig->esc).degraded;
+}
+
+/* Step the rig until its black box freezes, at most one ring's worth of ticks */
+static bool _host_check_blackbox_freeze(HostCheckRig_t *rig)
+{
+    for (uint32_t i = 0U; i < BLACKBOX_SAMPLES && !blackbox_is_frozen(&rig->esc); ++i) {
+        host_check_rig_step(rig);
+    }
+    return blackbox_is_frozen(&rig->esc);
+}
+
+/*
+ * Replay an export's first seven columns through a fresh ESC the way the real-time runner's -f does, returning the
+ * row that first shows fault, or -1
+ */
+static int32_t _host_check_blackbox_replay(HostCheckRig_t *rig, const HostPlantParams_t *params,
+                                           const EscConfig_t *cfg, FILE *file, uint32_t fault)
+{
+    if (!host_check_rig_init(rig, params, cfg)) {
+        return -1;
+    }
+    esc_set_throttle(&rig->esc, HOST_CHECK_BLACKBOX_THROTTLE);
+
+    char line[HOST_CHECK_BLACKBOX_LINE_LEN];
+    int32_t row = 0;
+    uint32_t last_us = 0U;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        unsigned int time_us;
+        float i_A[NUM_MOTOR_PHASES];
+        float vbus_V;
+        float temperature_C;
+        unsigned int hall;
+        /* Header and comment lines do not parse and are skipped */
+        if (sscanf(line, "%u,%f,%f,%f,%f,%f,%u", &time_us, &i_A[MOTOR_PHASE_A], &i_A[MOTOR_PHASE_B],
+                   &i_A[MOTOR_PHASE_C], &vbus_V, &temperature_C, &hall) != 7) {
+            continue;
+        }
+
+        hal_host_test_utils_advance_time_ticks(hal_time_us_to_ticks(time_us - last_us));
+        last_us = time_us;
+        hal_host_test_utils_set_phase_currents(HAL_MOTOR_0, i_A[MOTOR_PHASE_A], i_A[MOTOR_PHASE_B],
+                                               i_A[MOTOR_PHASE_C]);
+        hal_host_test_utils_set_bus_voltage(HAL_MOTOR_0, vbus_V);
+        hal_host_test_utils_set_temperature(HAL_MOTOR_0, temperature_C);
+        if ((uint8_t)hall != hal_host_state.motors[HAL_MOTOR_0].hall_abc) {
+            hal_host_test_utils_set_hall_state(HAL_MOTOR_0, (uint8_t)hall);
+            hal_host_test_utils_set_hall_timestamp_ticks(HAL_MOTOR_0, (uint32_t)hal_host_state.time_ticks);
+        }
+
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(HAL_MOTOR_0, &motor_state);
+        esc_set_motor_state(&rig->esc, &motor_state);
+        esc_step(&rig->esc, HAL_PWM_PERIOD_US);
+        if (((uint32_t)esc_get_fault_flags(&rig->esc) & fault) != 0U) {
+            return row;
+        }
+        row++;
+    }
+    return -1;
+}
+
+/* Ramp to full throttle and measure the speed estimate at steady speed, starting start_ticks into the timebase */
+static bool _host_check_wrap_run(uint64_t start_ticks, HostCheckWrapRun_t *run)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_system_rig;
+    host_check_default_setup(&params, &cfg);
+    params.load_torque_Nm = HOST_CHECK_WRAP_LOAD_NM;
+
+    /* host_check_rig_init() with the timebase advanced before the plant takes its time from it */
+    hal_host_test_utils_reset();
+    hal_host_test_utils_advance_time_ticks(start_ticks);
+    hal_pwm_init();
+    host_plant_init(&rig->plant, HAL_MOTOR_0, &params);
+    rig->time_us = 0U;
+    rig->fault_flags = ESC_FAULT_NONE;
+    if (!esc_init(&rig->esc, HAL_MOTOR_0, &cfg)) {
+        return false;
+    }
+
+    while (rig->time_us < HOST_CHECK_WRAP_RAMP_US) {
+        esc_set_throttle(&rig->esc, (float)rig->time_us / (float)HOST_CHECK_WRAP_RAMP_US);
+        host_check_rig_step(rig);
+    }
+    esc_set_throttle(&rig->esc, 1.0f);
+    host_check_rig_run(rig, HOST_CHECK_WRAP_SETTLE_US);
+
+    double error_sum = 0.0;
+    uint32_t samples = 0U;
+    run->error_max_rpm = 0.0f;
+    const uint32_t end_us = rig->time_us + HOST_CHECK_WRAP_MEASURE_US;
+    while (rig->time_us < end_us) {
+        host_check_rig_step(rig);
+        const float error_rpm = rig->esc.velocity_mech_rpm - host_plant_get_speed_rpm(&rig->plant);
+        error_sum += (double)(error_rpm * error_rpm);
+        samples++;
+        run->error_max_rpm = fmaxf(run->error_max_rpm, fabsf(error_rpm));
+    }
+    run->speed_rpm = host_plant_get_speed_rpm(&rig->plant);
+    run->error_rms_rpm = (float)sqrt(error_sum / samples);
+    run->fault_flags = rig->fault_flags;
+    run->end_ticks = hal_time_get_ticks();
+    return true;
+}
+
+/* Run the ESC with the bridge off, on whatever Hall state the host HAL holds */
+static void _host_check_wrap_steps(HostCheckRig_t *rig, uint32_t duration_us)
+{
+    for (uint32_t t = 0U; t < duration_us; t += HAL_PWM_PERIOD_US) {
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(HAL_MOTOR_0, &motor_state);
+        esc_set_motor_state(&rig->esc, &motor_state);
+        esc_step(&rig->esc, HAL_PWM_PERIOD_US);
+    }
+}
+
+/* Move the Hall state on by one forward edge, captured at the given tick */
+static void _host_check_wrap_edge(uint32_t *edge, uint32_t ticks)
+{
+    (*edge)++;
+    hal_host_test_utils_set_hall_state(HAL_MOTOR_0, host_check_wrap_hall_sequence[*edge % 6U]);
+    hal_host_test_utils_set_hall_timestamp_ticks(HAL_MOTOR_0, ticks);
+}
+
+/* Hall edges at a steady interval, a stop of just over a whole wrap of the 32-bit timestamp, and edges again */
+static uint32_t _host_check_wrap_stop(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_system_rig;
+    host_check_default_setup(&params, &cfg);
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    hal_host_test_utils_set_bus_voltage(HAL_MOTOR_0, params.battery_ocv_V);
+    if (!esc_init(&rig->esc, HAL_MOTOR_0, &cfg)) {
+        return host_check_expect(false, "configuration accepted");
+    }
+
+    const uint32_t edge_ticks = (uint32_t)hal_time_us_to_ticks(HOST_CHECK_WRAP_EDGE_US);
+    const float expected_rpm = MICROSECONDS_PER_MINUTE / ((float)HOST_CHECK_WRAP_EDGE_US *
+                               HALL_TRANSITIONS_PER_ELECTRICAL_REVOLUTION * (float)cfg.motor_config.num_pole_pairs);
+    uint32_t edge = 0U;
+    uint32_t ticks = 0U;
+    hal_host_test_utils_set_hall_state(HAL_MOTOR_0, host_check_wrap_hall_sequence[0]);
+    hal_host_test_utils_set_hall_timestamp_ticks(HAL_MOTOR_0, ticks);
+    for (uint32_t e = 0U; e < HOST_CHECK_WRAP_EDGES; ++e) {
+        _host_check_wrap_steps(rig, HOST_CHECK_WRAP_EDGE_US);
+        ticks += edge_ticks;
+        _host_check_wrap_edge(&edge, ticks);
+    }
+    _host_check_wrap_steps(rig, HAL_PWM_PERIOD_US);
+    const float running_rpm = rig->esc.velocity_mech_rpm;
+    _host_check_wrap_steps(rig, 2U * HALL_SPEED_TIMEOUT_US);
+    const float stopped_rpm = rig->esc.velocity_mech_rpm;
+
+    /* The stop ends a whole wrap plus one interval after the last edge, which the 32-bit difference aliases to one
+     * interval */
+    ticks += edge_ticks;
+    _host_check_wrap_edge(&edge, ticks);
+    _host_check_wrap_steps(rig, HAL_PWM_PERIOD_US);
+    const float first_rpm = rig->esc.velocity_mech_rpm;
+    ticks += edge_ticks;
+    _host_check_wrap_edge(&edge, ticks);
+    _host_check_wrap_steps(rig, HAL_PWM_PERIOD_US);
+    const float second_rpm = rig->esc.velocity_mech_rpm;
+
+    uint32_t failures = host_check_expect(fabsf(running_rpm - expected_rpm) <= HOST_CHECK_WRAP_MAX_EDGE_ERROR *
+                                          expected_rpm && stopped_rpm == 0.0f,
+                                          "stop and go: %.1f rpm on %u us edges, %.1f expected; %.1f rpm stopped",
+                                          (double)running_rpm, (unsigned)HOST_CHECK_WRAP_EDGE_US,
+                                          (double)expected_rpm, (double)stopped_rpm);
+    failures += host_check_expect(first_rpm == 0.0f && fabsf(second_rpm - expected_rpm) <=
+                                  HOST_CHECK_WRAP_MAX_EDGE_ERROR * expected_rpm,
+                                  "stop and go: first edge after a stop of 2^32 ticks reads %.1f rpm, 0 expected; "
+                                  "the next %.1f rpm", (double)first_rpm, (double)second_rpm);
+    return failures;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_check_torn_write(void)
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+
+    /* Count the hook points of one command write */
+    const EscInverterCmd_t first = _host_check_torn_write_cmd(0U);
+    host_check_torn_write_hook_calls = 0U;
+    host_check_torn_write_event_at = 0U;
+    hal_host_test_utils_set_pwm_write_hook(HAL_MOTOR_0, _host_check_torn_write_hook);
+    hal_pwm_apply_inverter_cmd(HAL_MOTOR_0, &first);
+    const uint32_t hook_points = host_check_torn_write_hook_calls;
+
+    /* With A latched, B is written with an update event at each hook point: A must stay latched until B is whole */
+    uint32_t torn = 0U;
+    for (uint32_t p = 0U; p < HOST_CHECK_TORN_WRITE_PAIRS; ++p) {
+        const EscInverterCmd_t a = _host_check_torn_write_cmd(p);
+        const EscInverterCmd_t b = _host_check_torn_write_cmd(p + 1U);
+        for (uint32_t point = 1U; point <= hook_points; ++point) {
+            host_check_torn_write_event_at = 0U;
+            hal_pwm_apply_inverter_cmd(HAL_MOTOR_0, &a);
+            hal_host_pwm_update_event(HAL_MOTOR_0);
+
+            host_check_torn_write_hook_calls = 0U;
+            host_check_torn_write_event_at = point;
+            hal_pwm_apply_inverter_cmd(HAL_MOTOR_0, &b);
+            bool ok = _host_check_latched_is(&a);
+            hal_host_pwm_update_event(HAL_MOTOR_0);
+            ok = ok && _host_check_latched_is(&b);
+            torn += ok ? 0U : 1U;
+        }
+    }
+    hal_host_test_utils_set_pwm_write_hook(HAL_MOTOR_0, NULL);
+
+    uint32_t failures = host_check_expect(hook_points > 0U, "%u hook points per command write, at least 1",
+                                          (unsigned)hook_points);
+    failures += host_check_expect(torn == 0U, "%u hook points x %u command pairs: %u mixed commands latched, none",
+                                  (unsigned)hook_points, (unsigned)HOST_CHECK_TORN_WRITE_PAIRS, (unsigned)torn);
+    return failures;
+}
+
+uint32_t host_check_blackbox(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_system_rig;
+    host_check_default_setup(&params, &cfg);
+    if (!host_check_rig_init(rig, &params, &cfg)) {
+        return host_check_expect(false, "configuration accepted");
+    }
+
+    /* One current sample past the limit, in the measurement only */
+    esc_set_throttle(&rig->esc, HOST_CHECK_BLACKBOX_THROTTLE);
+    host_check_rig_run(rig, HOST_CHECK_BLACKBOX_LEAD_US);
+    host_plant_step(&rig->plant, HAL_PWM_PERIOD_US);
+    MotorState_t motor_state;
+    hal_host_test_utils_get_motor_state(HAL_MOTOR_0, &motor_state);
+    motor_state.phase_currents_A[MOTOR_PHASE_A] = HOST_CHECK_BLACKBOX_SPIKE_A;
+    esc_set_motor_state(&rig->esc, &motor_state);
+    esc_step(&rig->esc, HAL_PWM_PERIOD_US);
+    const EscInverterCmd_t cmd = esc_get_inverter_cmd(&rig->esc);
+    hal_pwm_apply_inverter_cmd(HAL_MOTOR_0, &cmd);
+    rig->time_us += HAL_PWM_PERIOD_US;
+
+    const bool frozen = _host_check_blackbox_freeze(rig);
+    const EscBlackBox_t *bb = &rig->esc.blackbox;
+    uint32_t failures = host_check_expect(frozen && bb->trigger_fault_flags == ESC_FAULT_OVERCURRENT,
+                                          "%.0f A sample: frozen %d, trigger fault flags 0x%02x, overcurrent 0x%02x",
+                                          (double)HOST_CHECK_BLACKBOX_SPIKE_A, (int)frozen,
+                                          (unsigned)bb->trigger_fault_flags, (unsigned)ESC_FAULT_OVERCURRENT);
+    const uint32_t held = blackbox_get_num_samples(&rig->esc);
+    const int32_t trigger = blackbox_get_trigger_index(&rig->esc);
+    const uint32_t pre = (trigger >= 0) ? (uint32_t)trigger : 0U;
+    const uint32_t post = (trigger >= 0) ? held - 1U - (uint32_t)trigger : 0U;
+    failures += host_check_expect(trigger >= 0 && held == BLACKBOX_SAMPLES && post == BLACKBOX_POST_TRIGGER_SAMPLES,
+                                  "record: %u snapshots before the trigger, %u after, %u and %u expected",
+                                  (unsigned)pre, (unsigned)post,
+                                  (unsigned)(BLACKBOX_SAMPLES - 1U - BLACKBOX_POST_TRIGGER_SAMPLES),
+                                  (unsigned)BLACKBOX_POST_TRIGGER_SAMPLES);
+
+    /* Replay the export, which only carries the inputs, and look for the same fault on the same row */
+    FILE *file = tmpfile();
+    const bool exported = (file != NULL) && host_blackbox_write(&rig->esc, file);
+    int32_t replay_row = -1;
+    if (exported) {
+        rewind(file);
+        replay_row = _host_check_blackbox_replay(rig, &params, &cfg, file, ESC_FAULT_OVERCURRENT);
+    }
+    if (file != NULL) {
+        fclose(file);
+    }
+    failures += host_check_expect(exported && replay_row == trigger,
+                                  "replayed export: overcurrent at sample %d, trigger sample %d",
+                                  (int)replay_row, (int)trigger);
+
+    /* A platform fault with no fault flag of its own */
+    if (!host_check_rig_init(rig, &params, &cfg)) {
+        return failures + host_check_expect(false, "configuration accepted");
+    }
+    esc_set_throttle(&rig->esc, HOST_CHECK_BLACKBOX_THROTTLE);
+    host_check_rig_run(rig, HOST_CHECK_BLACKBOX_LEAD_US);
+    hal_host_test_utils_set_fault(HAL_MOTOR_0, true, HAL_FAULT_VDS_PROTECTION);
+    const bool vds_frozen = _host_check_blackbox_freeze(rig);
+    const uint8_t vds_expected = (uint8_t)HAL_FAULT_VDS_PROTECTION | BLACKBOX_HAL_FAULT_ACTIVE;
+    failures += host_check_expect(vds_frozen && bb->trigger_hal_fault == vds_expected,
+                                  "VDS fault: frozen %d, trigger hal_fault 0x%02x, 0x%02x expected", (int)vds_frozen,
+                                  (unsigned)bb->trigger_hal_fault, (unsigned)vds_expected);
+    return failures;
+}
+
+uint32_t host_check_timer_wrap(void)
+{
+    /* The wrapping run starts on a PWM period boundary, so both runs see the same carrier phase */
+    const uint64_t period_ticks = hal_time_us_to_ticks(HAL_PWM_PERIOD_US);
+    const uint64_t lead_ticks = (1ULL << 32) - hal_time_us_to_ticks(HOST_CHECK_WRAP_LEAD_US);
+    const uint64_t start_ticks[2] = { 0U, lead_ticks - lead_ticks % period_ticks };
+    HostCheckWrapRun_t runs[2];
+    uint32_t failures = 0U;
+    for (int wrap = 0; wrap <= 1; ++wrap) {
+        const char *name = (wrap == 0) ? "from 0" : "across the wrap";
+        if (!_host_check_wrap_run(start_ticks[wrap], &runs[wrap])) {
+            return failures + host_check_expect(false, "configuration accepted");
+        }
+        failures += host_check_expect(runs[wrap].speed_rpm >= HOST_CHECK_WRAP_MIN_RPM,
+                                      "%s: steady %.0f rpm, at least %.0f rpm", name, (double)runs[wrap].speed_rpm,
+                                      (double)HOST_CHECK_WRAP_MIN_RPM);
+        failures += host_check_expect(runs[wrap].error_rms_rpm <= HOST_CHECK_WRAP_MAX_RMS_RPM &&
+                                      runs[wrap].error_max_rpm <= HOST_CHECK_WRAP_MAX_ERROR_RPM,
+                                      "%s: speed estimate error %.2f rpm RMS, %.2f rpm max at %u ticks/us, "
+                                      "at most %.1f and %.1f rpm", name, (double)runs[wrap].error_rms_rpm,
+                                      (double)runs[wrap].error_max_rpm, (unsigned)HAL_TIME_TICKS_PER_US,
+                                      (double)HOST_CHECK_WRAP_MAX_RMS_RPM, (double)HOST_CHECK_WRAP_MAX_ERROR_RPM);
+        failures += host_check_expect(runs[wrap].fault_flags == ESC_FAULT_NONE, "%s: fault flags 0x%02x, none", name,
+                                      (unsigned)runs[wrap].fault_flags);
+    }
+
+    failures += host_check_expect(runs[1].end_ticks > (1ULL << 32), "wrapping run ends at tick %llu, past 2^32",
+                                  (unsigned long long)runs[1].end_ticks);
+    failures += host_check_expect(runs[0].speed_rpm == runs[1].speed_rpm &&
+                                  runs[0].error_rms_rpm == runs[1].error_rms_rpm &&
+                                  runs[0].error_max_rpm == runs[1].error_max_rpm,
+                                  "results across the wrap identical to those from 0");
+    return failures + _host_check_wrap_stop();
+}
+
+uint32_t host_check_deadline(void)
+{
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    HostCheckRig_t *rig = &host_check_system_rig;
+    host_plant_default_params(&params);
+    host_plant_default_esc_config(&cfg);
+    cfg.commutation_method = ESC_COMMUTATION_METHOD_SINE;
+    cfg.deadline.deadline_ns = HOST_CHECK_DEADLINE_NS;
+    cfg.deadline.degrade_overruns = HOST_CHECK_DEADLINE_DEGRADE;
+    if (!host_check_rig_init(rig, &params, &cfg)) {
+        return host_check_expect(false, "configuration accepted");
+    }
+
+    esc_set_throttle(&rig->esc, HOST_CHECK_DEADLINE_THROTTLE);
+    const bool early = _host_check_deadline_steps(rig, HOST_CHECK_DEADLINE_DEGRADE - 1U);
+    const bool latched = _host_check_deadline_steps(rig, 1U);
+    uint32_t failures = host_check_expect(!early && latched, "degraded mode latched at overrun %u, not before",
+                                          (unsigned)HOST_CHECK_DEADLINE_DEGRADE);
+
+    const uint32_t slow_runs = rig->esc.tasks[ESC_TASK_SLOW].runs;
+    const uint32_t telemetry_runs = rig->esc.tasks[ESC_TASK_TELEMETRY].runs;
+    host_check_rig_run(rig, HOST_CHECK_DEADLINE_RUN_US);
+    const EscDeadlineStats_t stats = esc_get_deadline_stats(&rig->esc);
+    const EscInverterCmd_t degraded_cmd = esc_get_inverter_cmd(&rig->esc);
+    failures += host_check_expect(stats.overruns == stats.ticks && stats.ticks > 0U,
+                                  "%u overruns of a %u ns deadline in %u calls, every one", (unsigned)stats.overruns,
+                                  (unsigned)HOST_CHECK_DEADLINE_NS, (unsigned)stats.ticks);
+    failures += host_check_expect(stats.worst_task < NUM_ESC_TASKS && stats.worst_task_cycles > 0U &&
+                                  stats.worst_task_cycles <= stats.worst_overrun_cycles,
+                                  "worst overrun %u cycles, task %d taking %u cycles of it",
+                                  (unsigned)stats.worst_overrun_cycles, (int)stats.worst_task,
+                                  (unsigned)stats.worst_task_cycles);
+    failures += host_check_expect(rig->esc.tasks[ESC_TASK_TELEMETRY].runs == telemetry_runs &&
+                                  rig->esc.tasks[ESC_TASK_SLOW].runs > slow_runs,
+                                  "degraded: telemetry ran %u times, supervision %u times, only supervision runs",
+                                  (unsigned)(rig->esc.tasks[ESC_TASK_TELEMETRY].runs - telemetry_runs),
+                                  (unsigned)(rig->esc.tasks[ESC_TASK_SLOW].runs - slow_runs));
+    const uint8_t high_mask = degraded_cmd.high_enable_mask;
+    failures += host_check_expect(degraded_cmd.enable && high_mask != 0U && (high_mask & (high_mask - 1U)) == 0U,
+                                  "degraded: sine drive configured, high-side enable mask 0x%x, 6-step forced",
+                                  (unsigned)high_mask);
+
+    esc_reset(&rig->esc);
+    const EscDeadlineStats_t reset_stats = esc_get_deadline_stats(&rig->esc);
+    failures += host_check_expect(!reset_stats.degraded && reset_stats.overruns == stats.overruns,
+                                  "esc_reset(): degraded %d, %u overruns kept", (int)reset_stats.degraded,
+                                  (unsigned)reset_stats.overruns);
+    const bool relatch_early = _host_check_deadline_steps(rig, HOST_CHECK_DEADLINE_DEGRADE - 1U);
+    const bool relatched = _host_check_deadline_steps(rig, 1U);
+    failures += host_check_expect(!relatch_early && relatched, "degraded mode latched again at overrun %u, not before",
+                                  (unsigned)HOST_CHECK_DEADLINE_DEGRADE);
+    return failures;
+}
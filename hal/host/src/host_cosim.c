@@ -0,0 +1,360 @@
+/*******************************************************************************************************************************
+ * @file   host_cosim.c
+ *
+ * @brief  Source file for the host shared-memory co-simulation module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <fcntl.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "histogram.h"
+#include "motor.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_cosim.h"
+#include "host_plant.h"
+#include "host_state.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#if defined(__linux__)
+
+#define HOST_COSIM_MAGIC 0x45534343U /* "ESCC" */
+#define HOST_COSIM_ATTACH_POLL_US 1000U
+
+/**
+ * @brief   Layout of the shared region
+ */
+typedef struct {
+    uint32_t magic;                /**< Written last by the controller once the region is initialized */
+    uint32_t version;              /**< HOST_COSIM_VERSION of the controller */
+    uint32_t size;                 /**< sizeof(HostCosimRegion_t) of the controller */
+    sem_t to_plant;                /**< Posted by the controller when a command is ready */
+    sem_t to_controller;           /**< Posted by the plant when the motor state is ready */
+    volatile uint32_t shutdown;    /**< Set by the controller before its final post */
+
+    /* Controller to plant */
+    uint32_t dt_us;                /**< Step length */
+    EscInverterCmd_t cmd;          /**< Inverter command for the step */
+
+    /* Plant to controller */
+    MotorState_t motor_state;      /**< Motor state at the end of the step */
+    uint64_t time_ticks;           /**< Plant time at the end of the step */
+} HostCosimRegion_t;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static bool _host_cosim_wait(const HostCosim_t *cosim, sem_t *sem)
+{
+    /* Polling avoids a sleep/wake round trip when the peer runs on another CPU */
+    for (uint32_t i = 0U; i < cosim->spin_tries; ++i) {
+        if (sem_trywait(sem) == 0) {
+            return true;
+        }
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += HOST_COSIM_TIMEOUT_MS / 1000U;
+    deadline.tv_nsec += (long)(HOST_COSIM_TIMEOUT_MS % 1000U) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    while (sem_timedwait(sem, &deadline) != 0) {
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _host_cosim_create(HostCosim_t *cosim)
+{
+    (void)shm_unlink(cosim->name);
+    const int fd = shm_open(cosim->name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, (off_t)sizeof(HostCosimRegion_t)) != 0) {
+        close(fd);
+        shm_unlink(cosim->name);
+        return false;
+    }
+
+    void *mem = mmap(NULL, sizeof(HostCosimRegion_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(cosim->name);
+        return false;
+    }
+
+    HostCosimRegion_t *region = mem;
+    memset(region, 0, sizeof(*region));
+    if (sem_init(&region->to_plant, 1, 0U) != 0 || sem_init(&region->to_controller, 1, 0U) != 0) {
+        munmap(mem, sizeof(HostCosimRegion_t));
+        shm_unlink(cosim->name);
+        return false;
+    }
+    region->version = HOST_COSIM_VERSION;
+    region->size = (uint32_t)sizeof(HostCosimRegion_t);
+    __atomic_store_n(&region->magic, HOST_COSIM_MAGIC, __ATOMIC_RELEASE);
+
+    cosim->region = region;
+    return true;
+}
+
+static bool _host_cosim_attach(HostCosim_t *cosim)
+{
+    /* The controller may not have created the region yet */
+    for (uint32_t waited_us = 0U; waited_us < HOST_COSIM_TIMEOUT_MS * 1000U; waited_us += HOST_COSIM_ATTACH_POLL_US) {
+        const int fd = shm_open(cosim->name, O_RDWR, 0600);
+        if (fd >= 0) {
+            struct stat st;
+            void *mem = MAP_FAILED;
+            if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(HostCosimRegion_t)) {
+                mem = mmap(NULL, sizeof(HostCosimRegion_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+
+            if (mem != MAP_FAILED) {
+                HostCosimRegion_t *region = mem;
+                if (__atomic_load_n(&region->magic, __ATOMIC_ACQUIRE) == HOST_COSIM_MAGIC) {
+                    if (region->version != HOST_COSIM_VERSION || region->size != sizeof(HostCosimRegion_t)) {
+                        munmap(mem, sizeof(HostCosimRegion_t));
+                        return false;
+                    }
+                    cosim->region = region;
+                    return true;
+                }
+                munmap(mem, sizeof(HostCosimRegion_t));
+            }
+        }
+        usleep(HOST_COSIM_ATTACH_POLL_US);
+    }
+    return false;
+}
+
+#endif
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+bool host_cosim_open(HostCosim_t *cosim, const char *name, HostCosimRole_t role)
+{
+    if (cosim == NULL || name == NULL || name[0] != '/' || strlen(name) >= sizeof(cosim->name)) {
+        return false;
+    }
+
+    cosim->role = role;
+    cosim->region = NULL;
+    strcpy(cosim->name, name);
+
+#if defined(__linux__)
+    cosim->spin_tries = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? HOST_COSIM_SPIN_TRIES : 0U;
+    return (role == HOST_COSIM_ROLE_CONTROLLER) ? _host_cosim_create(cosim) : _host_cosim_attach(cosim);
+#else
+    cosim->spin_tries = 0U;
+    return false;
+#endif
+}
+
+void host_cosim_close(HostCosim_t *cosim)
+{
+    if (cosim == NULL || cosim->region == NULL) {
+        return;
+    }
+
+#if defined(__linux__)
+    HostCosimRegion_t *region = cosim->region;
+    if (cosim->role == HOST_COSIM_ROLE_CONTROLLER) {
+        region->shutdown = 1U;
+        sem_post(&region->to_plant);
+        shm_unlink(cosim->name);
+    }
+    munmap(region, sizeof(HostCosimRegion_t));
+#endif
+    cosim->region = NULL;
+}
+
+bool host_cosim_controller_step(HostCosim_t *cosim, const EscInverterCmd_t *cmd, uint32_t dt_us)
+{
+    if (cosim == NULL || cosim->region == NULL || cmd == NULL || cosim->role != HOST_COSIM_ROLE_CONTROLLER) {
+        return false;
+    }
+
+#if defined(__linux__)
+    HostCosimRegion_t *region = cosim->region;
+    region->cmd = *cmd;
+    region->dt_us = dt_us;
+    sem_post(&region->to_plant);
+
+    if (!_host_cosim_wait(cosim, &region->to_controller)) {
+        return false;
+    }
+
+    /* Load the plant outputs as the host HAL inputs */
+    const MotorState_t *state = &region->motor_state;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        hal_host_state.motors[HAL_MOTOR_0].phase_currents_A[i] = state->phase_currents_A[i];
+    }
+    hal_host_state.motors[HAL_MOTOR_0].bus_voltage_V = state->vbus_V;
+    hal_host_state.motors[HAL_MOTOR_0].temperature_C = state->temperature_C;
+    hal_host_state.motors[HAL_MOTOR_0].hall_abc = state->hall_abc;
+    hal_host_state.motors[HAL_MOTOR_0].hall_timestamp_ticks = state->hall_timestamp_ticks;
+    hal_host_state.time_ticks = region->time_ticks;
+    return true;
+#else
+    (void)dt_us;
+    return false;
+#endif
+}
+
+bool host_cosim_plant_receive(HostCosim_t *cosim, EscInverterCmd_t *cmd, uint32_t *dt_us)
+{
+    if (cosim == NULL || cosim->region == NULL || cmd == NULL || dt_us == NULL || cosim->role != HOST_COSIM_ROLE_PLANT) {
+        return false;
+    }
+
+#if defined(__linux__)
+    HostCosimRegion_t *region = cosim->region;
+    if (!_host_cosim_wait(cosim, &region->to_plant) || region->shutdown != 0U) {
+        return false;
+    }
+
+    *cmd = region->cmd;
+    *dt_us = region->dt_us;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void host_cosim_plant_send(HostCosim_t *cosim, const MotorState_t *motor_state, uint64_t time_ticks)
+{
+    if (cosim == NULL || cosim->region == NULL || motor_state == NULL || cosim->role != HOST_COSIM_ROLE_PLANT) {
+        return;
+    }
+
+#if defined(__linux__)
+    HostCosimRegion_t *region = cosim->region;
+    region->motor_state = *motor_state;
+    region->time_ticks = time_ticks;
+    sem_post(&region->to_controller);
+#else
+    (void)time_ticks;
+#endif
+}
+
+int64_t host_cosim_run_plant(const char *name, bool echo)
+{
+    HostCosim_t cosim;
+    if (!host_cosim_open(&cosim, name, HOST_COSIM_ROLE_PLANT)) {
+        return -1;
+    }
+
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    HostPlantParams_t params;
+    HostPlant_t plant;
+    host_plant_default_params(&params);
+    host_plant_init(&plant, HAL_MOTOR_0, &params);
+
+    int64_t steps = 0;
+    EscInverterCmd_t cmd;
+    uint32_t dt_us;
+    while (host_cosim_plant_receive(&cosim, &cmd, &dt_us)) {
+        if (!echo) {
+            hal_pwm_apply_inverter_cmd(HAL_MOTOR_0, &cmd);
+            host_plant_step(&plant, dt_us);
+        }
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(HAL_MOTOR_0, &motor_state);
+        host_cosim_plant_send(&cosim, &motor_state, hal_host_state.time_ticks);
+        steps++;
+    }
+
+    host_cosim_close(&cosim);
+    return steps;
+}
+
+bool host_cosim_run_controller(const char *name, uint32_t duration_us, uint32_t dt_us, float throttle,
+                               Histogram_t *round_trip_ns)
+{
+    if (round_trip_ns == NULL || dt_us == 0U) {
+        return false;
+    }
+    histogram_reset(round_trip_ns);
+
+#if defined(__linux__)
+    HostCosim_t cosim;
+    if (!host_cosim_open(&cosim, name, HOST_COSIM_ROLE_CONTROLLER)) {
+        return false;
+    }
+
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    EscConfig_t cfg;
+    Esc_t esc;
+    host_plant_default_esc_config(&cfg);
+    if (!esc_init(&esc, HAL_MOTOR_0, &cfg)) {
+        host_cosim_close(&cosim);
+        return false;
+    }
+    esc_set_throttle(&esc, throttle);
+
+    /* A zero-length step with the idle command fetches the initial plant state */
+    EscInverterCmd_t cmd = esc_get_inverter_cmd(&esc);
+    bool ok = host_cosim_controller_step(&cosim, &cmd, 0U);
+
+    for (uint32_t t_us = 0U; ok && t_us < duration_us; t_us += dt_us) {
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(HAL_MOTOR_0, &motor_state);
+        esc_set_motor_state(&esc, &motor_state);
+        esc_step(&esc, dt_us);
+        cmd = esc_get_inverter_cmd(&esc);
+
+        struct timespec start;
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        ok = host_cosim_controller_step(&cosim, &cmd, dt_us);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        histogram_record(round_trip_ns, (uint32_t)((end.tv_sec - start.tv_sec) * 1000000000L +
+                                                   (end.tv_nsec - start.tv_nsec)));
+    }
+
+    host_cosim_close(&cosim);
+    return ok;
+#else
+    (void)name;
+    (void)duration_us;
+    (void)throttle;
+    return false;
+#endif
+}
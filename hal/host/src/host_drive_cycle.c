@@ -0,0 +1,420 @@
+/*******************************************************************************************************************************
+ * @file   host_drive_cycle.c
+ *
+ * @brief  Source file for the host drive-cycle benchmark
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "histogram.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_drive_cycle.h"
+#include "host_plant.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_DRIVE_CYCLE_PI 3.14159265358979323846f
+#define HOST_DRIVE_CYCLE_JOULES_PER_WH 3600.0
+#define HOST_DRIVE_CYCLE_MAX_POINTS 6U       /* Points of the longest profile */
+#define HOST_DRIVE_CYCLE_LINE_SIZE 512U      /* Longest summary line read back */
+#define HOST_DRIVE_CYCLE_DRIVER_KP 0.0005f   /* Throttle per rpm of speed error */
+#define HOST_DRIVE_CYCLE_DRIVER_KI 0.002f    /* Throttle per rpm second of speed error */
+
+/**
+ * @brief   Profile point: the speed is interpolated to the next point, the load held until it
+ */
+typedef struct {
+    uint32_t time_ms;  /**< Time from the start of the cycle */
+    float speed_rpm;   /**< Reference speed, negative in reverse */
+    float load_Nm;     /**< Load torque from this point on */
+} HostDriveCyclePoint_t;
+
+/**
+ * @brief   Scripted drive cycle
+ */
+typedef struct {
+    const char *name;                                        /**< Name in the summary and for -c */
+    uint8_t num_points;                                      /**< Points in use; the last one ends the cycle */
+    HostDriveCyclePoint_t points[HOST_DRIVE_CYCLE_MAX_POINTS]; /**< Profile */
+} HostDriveCycle_t;
+
+/**
+ * @brief   Drive cycles, in the order they run
+ */
+typedef enum {
+    HOST_DRIVE_CYCLE_ACCELERATION, /**< Full acceleration to 3000 rpm */
+    HOST_DRIVE_CYCLE_CRUISE,       /**< Steady 2000 rpm */
+    HOST_DRIVE_CYCLE_HILL_CLIMB,   /**< 2000 rpm through a load step to 1.5 Nm and back */
+    HOST_DRIVE_CYCLE_REGEN,        /**< Braking from 3000 rpm to rest */
+    HOST_DRIVE_CYCLE_STALL,        /**< 1000 rpm asked against a load the motor cannot turn */
+    HOST_DRIVE_CYCLE_REVERSAL,     /**< 2000 rpm forward to 2000 rpm in reverse */
+    NUM_HOST_DRIVE_CYCLES
+} HostDriveCycleId_t;
+
+/**
+ * @brief   Summary metrics, in CSV column order
+ */
+typedef enum {
+    HOST_DRIVE_CYCLE_METRIC_ENERGY_OUT,       /**< Energy drawn from the battery */
+    HOST_DRIVE_CYCLE_METRIC_ENERGY_IN,        /**< Energy returned to the battery */
+    HOST_DRIVE_CYCLE_METRIC_DRIVE_EFFICIENCY, /**< Motoring shaft work over energy drawn */
+    HOST_DRIVE_CYCLE_METRIC_REGEN_EFFICIENCY, /**< Energy returned over generating shaft work */
+    HOST_DRIVE_CYCLE_METRIC_TRACKING,         /**< RMS of reference minus plant speed */
+    HOST_DRIVE_CYCLE_METRIC_PEAK_CURRENT,     /**< Largest phase current magnitude */
+    HOST_DRIVE_CYCLE_METRIC_FAULTS,           /**< Fault flags raised at any point */
+    HOST_DRIVE_CYCLE_METRIC_FAULT_FLAGS,      /**< EscFault_t bits raised at any point */
+    HOST_DRIVE_CYCLE_METRIC_TICK_MEAN,        /**< Mean control tick CPU time */
+    HOST_DRIVE_CYCLE_METRIC_TICK_P99,         /**< 99th percentile control tick CPU time */
+    HOST_DRIVE_CYCLE_METRIC_TICK_MAX,         /**< Longest control tick CPU time */
+    NUM_HOST_DRIVE_CYCLE_METRICS
+} HostDriveCycleMetric_t;
+
+/**
+ * @brief   How a metric is named, printed and gated
+ */
+typedef struct {
+    const char *column;  /**< CSV column */
+    const char *heading; /**< Table heading */
+    uint8_t width;       /**< Table column width */
+    uint8_t precision;   /**< Table decimals */
+    int8_t better;       /**< +1 if higher is better, -1 if lower is better, 0 if not gated */
+} HostDriveCycleMetricDesc_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const HostDriveCycle_t drive_cycles[NUM_HOST_DRIVE_CYCLES] = {
+    [HOST_DRIVE_CYCLE_ACCELERATION] = { "acceleration", 3U, {
+        { 0U, 0.0f, 0.2f }, { 1500U, 3000.0f, 0.2f }, { 2500U, 3000.0f, 0.2f } } },
+    [HOST_DRIVE_CYCLE_CRUISE] = { "cruise", 3U, {
+        { 0U, 0.0f, 0.2f }, { 1000U, 2000.0f, 0.2f }, { 4000U, 2000.0f, 0.2f } } },
+    [HOST_DRIVE_CYCLE_HILL_CLIMB] = { "hill-climb", 5U, {
+        { 0U, 0.0f, 0.2f }, { 1000U, 2000.0f, 0.2f }, { 1500U, 2000.0f, 1.5f }, { 3500U, 2000.0f, 0.2f },
+        { 4500U, 2000.0f, 0.2f } } },
+    [HOST_DRIVE_CYCLE_REGEN] = { "regen", 5U, {
+        { 0U, 0.0f, 0.2f }, { 1500U, 3000.0f, 0.2f }, { 2000U, 3000.0f, 0.2f }, { 3500U, 0.0f, 0.2f },
+        { 4500U, 0.0f, 0.2f } } },
+    [HOST_DRIVE_CYCLE_STALL] = { "stall", 2U, {
+        { 0U, 1000.0f, 8.0f }, { 3000U, 1000.0f, 8.0f } } },
+    [HOST_DRIVE_CYCLE_REVERSAL] = { "reversal", 5U, {
+        { 0U, 0.0f, 0.2f }, { 1000U, 2000.0f, 0.2f }, { 1500U, 2000.0f, 0.2f }, { 3000U, -2000.0f, 0.2f },
+        { 4000U, -2000.0f, 0.2f } } },
+};
+
+static const HostDriveCycleMetricDesc_t metric_descs[NUM_HOST_DRIVE_CYCLE_METRICS] = {
+    [HOST_DRIVE_CYCLE_METRIC_ENERGY_OUT] = { "energy_out_Wh", "out Wh", 7U, 3U, -1 },
+    [HOST_DRIVE_CYCLE_METRIC_ENERGY_IN] = { "energy_in_Wh", "in Wh", 7U, 3U, 1 },
+    [HOST_DRIVE_CYCLE_METRIC_DRIVE_EFFICIENCY] = { "drive_efficiency", "drive", 6U, 3U, 1 },
+    [HOST_DRIVE_CYCLE_METRIC_REGEN_EFFICIENCY] = { "regen_efficiency", "regen", 6U, 3U, 1 },
+    [HOST_DRIVE_CYCLE_METRIC_TRACKING] = { "tracking_rms_rpm", "track rpm", 9U, 1U, -1 },
+    [HOST_DRIVE_CYCLE_METRIC_PEAK_CURRENT] = { "peak_current_A", "peak A", 7U, 1U, -1 },
+    [HOST_DRIVE_CYCLE_METRIC_FAULTS] = { "faults", "faults", 6U, 0U, -1 },
+    [HOST_DRIVE_CYCLE_METRIC_FAULT_FLAGS] = { "fault_flags", "flags", 5U, 0U, 0 },
+    [HOST_DRIVE_CYCLE_METRIC_TICK_MEAN] = { "tick_mean_ns", "mean ns", 7U, 0U, 0 },
+    [HOST_DRIVE_CYCLE_METRIC_TICK_P99] = { "tick_p99_ns", "p99 ns", 7U, 0U, 0 },
+    [HOST_DRIVE_CYCLE_METRIC_TICK_MAX] = { "tick_max_ns", "max ns", 7U, 0U, 0 },
+};
+
+static Histogram_t host_drive_cycle_tick_ns;
+static float host_drive_cycle_results[NUM_HOST_DRIVE_CYCLES][NUM_HOST_DRIVE_CYCLE_METRICS];
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint64_t _host_drive_cycle_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+static float _host_drive_cycle_reference(const HostDriveCycle_t *cycle, uint32_t time_ms, float *load_Nm)
+{
+    uint8_t i = 0U;
+    while (i + 2U < cycle->num_points && cycle->points[i + 1U].time_ms <= time_ms) {
+        i++;
+    }
+    const HostDriveCyclePoint_t *from = &cycle->points[i];
+    const HostDriveCyclePoint_t *to = &cycle->points[i + 1U];
+    *load_Nm = from->load_Nm;
+
+    const float span_ms = (float)(to->time_ms - from->time_ms);
+    float fraction = (span_ms > 0.0f) ? (float)(time_ms - from->time_ms) / span_ms : 1.0f;
+    if (fraction > 1.0f) {
+        fraction = 1.0f;
+    }
+    return from->speed_rpm + (to->speed_rpm - from->speed_rpm) * fraction;
+}
+
+static void _host_drive_cycle_drive(Esc_t *esc, float reference_rpm, float error_rpm, float throttle_per_rpm,
+                                    float *integral)
+{
+    /* Feed-forward from the no-load speed, corrected by the speed error; the integrator holds while saturated */
+    const float command = reference_rpm * throttle_per_rpm + HOST_DRIVE_CYCLE_DRIVER_KP * error_rpm +
+                          HOST_DRIVE_CYCLE_DRIVER_KI * *integral;
+    if (fabsf(command) < 1.0f) {
+        *integral += error_rpm * (float)HOST_DRIVE_CYCLE_DRIVER_PERIOD_US / MICROSECONDS_PER_SECOND;
+    }
+
+    /* A command against the reference direction asks for more deceleration than coasting gives */
+    const float direction = (reference_rpm < 0.0f) ? -1.0f : 1.0f;
+    if (command * direction >= 0.0f) {
+        esc_set_throttle(esc, command);
+        esc_set_brake(esc, 0.0f);
+    } else {
+        esc_set_throttle(esc, 0.0f);
+        esc_set_brake(esc, fabsf(command));
+    }
+}
+
+static bool _host_drive_cycle_simulate(const HostDriveCycle_t *cycle, float metrics[NUM_HOST_DRIVE_CYCLE_METRICS])
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    HostPlantParams_t params;
+    HostPlant_t plant;
+    host_plant_default_params(&params);
+    params.load_torque_Nm = cycle->points[0].load_Nm;
+    host_plant_init(&plant, HAL_MOTOR_0, &params);
+
+    EscConfig_t cfg;
+    Esc_t esc;
+    host_plant_default_esc_config(&cfg);
+    cfg.deadline.degrade_overruns = 0U;
+    if (!esc_init(&esc, HAL_MOTOR_0, &cfg)) {
+        return false;
+    }
+
+    /* The 6-step line-to-line back-EMF is twice the phase plateau */
+    const float throttle_per_rpm =
+        2.0f * params.bemf_constant_Vs * (2.0f * HOST_DRIVE_CYCLE_PI / 60.0f) / params.battery_ocv_V;
+    const uint32_t dt_us = HAL_PWM_PERIOD_US;
+    const uint32_t duration_us = cycle->points[cycle->num_points - 1U].time_ms * 1000U;
+    float integral = 0.0f;
+    double error_sq_sum = 0.0;
+    uint32_t error_samples = 0U;
+    uint64_t tick_ns_sum = 0U;
+    uint32_t fault_flags = ESC_FAULT_NONE;
+    histogram_reset(&host_drive_cycle_tick_ns);
+
+    for (uint32_t t_us = 0U; t_us < duration_us; t_us += dt_us) {
+        if ((t_us % HOST_DRIVE_CYCLE_DRIVER_PERIOD_US) == 0U) {
+            float load_Nm;
+            const float reference_rpm = _host_drive_cycle_reference(cycle, t_us / 1000U, &load_Nm);
+            const float error_rpm = reference_rpm - host_plant_get_speed_rpm(&plant);
+            plant.params.load_torque_Nm = load_Nm;
+            error_sq_sum += (double)error_rpm * error_rpm;
+            error_samples++;
+            _host_drive_cycle_drive(&esc, reference_rpm, error_rpm, throttle_per_rpm, &integral);
+        }
+
+        host_plant_step(&plant, dt_us);
+        const uint64_t start_ns = _host_drive_cycle_now_ns();
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(esc.hal_motor, &motor_state);
+        esc_set_motor_state(&esc, &motor_state);
+        esc_step(&esc, dt_us);
+        const EscInverterCmd_t cmd = esc_get_inverter_cmd(&esc);
+        hal_pwm_apply_inverter_cmd(esc.hal_motor, &cmd);
+        const uint64_t tick_ns = _host_drive_cycle_now_ns() - start_ns;
+        histogram_record(&host_drive_cycle_tick_ns, (uint32_t)tick_ns);
+        tick_ns_sum += tick_ns;
+        fault_flags |= (uint32_t)esc_get_fault_flags(&esc);
+    }
+
+    uint32_t faults = 0U;
+    for (uint32_t flags = fault_flags; flags != 0U; flags &= flags - 1U) {
+        faults++;
+    }
+    const uint64_t ticks = host_drive_cycle_tick_ns.total;
+    metrics[HOST_DRIVE_CYCLE_METRIC_ENERGY_OUT] = (float)(plant.battery_energy_out_J / HOST_DRIVE_CYCLE_JOULES_PER_WH);
+    metrics[HOST_DRIVE_CYCLE_METRIC_ENERGY_IN] = (float)(plant.battery_energy_in_J / HOST_DRIVE_CYCLE_JOULES_PER_WH);
+    metrics[HOST_DRIVE_CYCLE_METRIC_DRIVE_EFFICIENCY] =
+        (plant.battery_energy_out_J > 0.0) ? (float)(plant.shaft_energy_out_J / plant.battery_energy_out_J) : 0.0f;
+    metrics[HOST_DRIVE_CYCLE_METRIC_REGEN_EFFICIENCY] =
+        (plant.shaft_energy_in_J > 0.0) ? (float)(plant.battery_energy_in_J / plant.shaft_energy_in_J) : 0.0f;
+    metrics[HOST_DRIVE_CYCLE_METRIC_TRACKING] = (error_samples > 0U) ? (float)sqrt(error_sq_sum / error_samples) : 0.0f;
+    metrics[HOST_DRIVE_CYCLE_METRIC_PEAK_CURRENT] = plant.peak_phase_current_A;
+    metrics[HOST_DRIVE_CYCLE_METRIC_FAULTS] = (float)faults;
+    metrics[HOST_DRIVE_CYCLE_METRIC_FAULT_FLAGS] = (float)fault_flags;
+    metrics[HOST_DRIVE_CYCLE_METRIC_TICK_MEAN] = (ticks > 0U) ? (float)((double)tick_ns_sum / (double)ticks) : 0.0f;
+    metrics[HOST_DRIVE_CYCLE_METRIC_TICK_P99] = (float)histogram_percentile(&host_drive_cycle_tick_ns, 99.0f);
+    metrics[HOST_DRIVE_CYCLE_METRIC_TICK_MAX] = (float)host_drive_cycle_tick_ns.max;
+    return true;
+}
+
+static bool _host_drive_cycle_write_csv(const char *path, const bool ran[NUM_HOST_DRIVE_CYCLES])
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    fprintf(file, "# esc drive cycles: control tick every %u us, driver every %u us, CPU times in ns\n",
+            (unsigned)HAL_PWM_PERIOD_US, (unsigned)HOST_DRIVE_CYCLE_DRIVER_PERIOD_US);
+    fprintf(file, "cycle");
+    for (int m = 0; m < NUM_HOST_DRIVE_CYCLE_METRICS; ++m) {
+        fprintf(file, ",%s", metric_descs[m].column);
+    }
+    fprintf(file, "\n");
+    for (int c = 0; c < NUM_HOST_DRIVE_CYCLES; ++c) {
+        if (!ran[c]) {
+            continue;
+        }
+        fprintf(file, "%s", drive_cycles[c].name);
+        for (int m = 0; m < NUM_HOST_DRIVE_CYCLE_METRICS; ++m) {
+            fprintf(file, ",%.7g", (double)host_drive_cycle_results[c][m]);
+        }
+        fprintf(file, "\n");
+    }
+    return fclose(file) == 0;
+}
+
+static int _host_drive_cycle_find(const char *name)
+{
+    for (int c = 0; c < NUM_HOST_DRIVE_CYCLES; ++c) {
+        if (strcmp(drive_cycles[c].name, name) == 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+static uint32_t _host_drive_cycle_compare(const char *path, const bool ran[NUM_HOST_DRIVE_CYCLES], bool *read_ok)
+{
+    FILE *file = fopen(path, "r");
+    *read_ok = (file != NULL);
+    if (file == NULL) {
+        return 0U;
+    }
+
+    /* Columns are matched by name, so a baseline from before a column was added still compares */
+    int column_metric[NUM_HOST_DRIVE_CYCLE_METRICS + 1U];
+    uint32_t num_columns = 0U;
+    uint32_t regressions = 0U;
+    uint32_t compared = 0U;
+    char line[HOST_DRIVE_CYCLE_LINE_SIZE];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0') {
+            continue;
+        }
+
+        if (num_columns == 0U) {
+            for (char *field = strtok(line, ","); field != NULL && num_columns <= NUM_HOST_DRIVE_CYCLE_METRICS;
+                 field = strtok(NULL, ",")) {
+                column_metric[num_columns] = -1;
+                for (int m = 0; m < NUM_HOST_DRIVE_CYCLE_METRICS; ++m) {
+                    if (strcmp(field, metric_descs[m].column) == 0) {
+                        column_metric[num_columns] = m;
+                    }
+                }
+                num_columns++;
+            }
+            continue;
+        }
+
+        const char *name = strtok(line, ",");
+        const int c = (name != NULL) ? _host_drive_cycle_find(name) : -1;
+        if (c < 0 || !ran[c]) {
+            continue;
+        }
+        compared++;
+        uint32_t column = 1U;
+        for (char *field = strtok(NULL, ","); field != NULL && column < num_columns; field = strtok(NULL, ",")) {
+            const int m = column_metric[column++];
+            if (m < 0 || metric_descs[m].better == 0) {
+                continue;
+            }
+            const float base = strtof(field, NULL);
+            const float now = host_drive_cycle_results[c][m];
+            const float worse = (now - base) * (float)(-metric_descs[m].better);
+            if (worse > HOST_DRIVE_CYCLE_TOLERANCE * fabsf(base)) {
+                regressions++;
+                printf("  regression: %s %s %.4g -> %.4g\n", drive_cycles[c].name, metric_descs[m].column,
+                       (double)base, (double)now);
+            }
+        }
+    }
+    fclose(file);
+
+    printf("drive-cycle: %u cycles compared with %s, %u regressions\n", (unsigned)compared, path,
+           (unsigned)regressions);
+    return regressions;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_drive_cycle_run(const HostDriveCycleConfig_t *cfg)
+{
+    const int only = (cfg->cycle != NULL) ? _host_drive_cycle_find(cfg->cycle) : -1;
+    if (cfg->cycle != NULL && only < 0) {
+        fprintf(stderr, "drive-cycle: unknown cycle %s\n", cfg->cycle);
+        return 1U;
+    }
+
+    printf("  %-13s", "cycle");
+    for (int m = 0; m < NUM_HOST_DRIVE_CYCLE_METRICS; ++m) {
+        printf(" %*s", (int)metric_descs[m].width, metric_descs[m].heading);
+    }
+    printf("\n");
+
+    bool ran[NUM_HOST_DRIVE_CYCLES] = { false };
+    for (int c = 0; c < NUM_HOST_DRIVE_CYCLES; ++c) {
+        if (only >= 0 && c != only) {
+            continue;
+        }
+        if (!_host_drive_cycle_simulate(&drive_cycles[c], host_drive_cycle_results[c])) {
+            fprintf(stderr, "drive-cycle: ESC configuration rejected\n");
+            return 1U;
+        }
+        ran[c] = true;
+        printf("  %-13s", drive_cycles[c].name);
+        for (int m = 0; m < NUM_HOST_DRIVE_CYCLE_METRICS; ++m) {
+            if (m == HOST_DRIVE_CYCLE_METRIC_FAULT_FLAGS) {
+                printf("  0x%02x", (unsigned)host_drive_cycle_results[c][m]);
+            } else {
+                printf(" %*.*f", (int)metric_descs[m].width, (int)metric_descs[m].precision,
+                       (double)host_drive_cycle_results[c][m]);
+            }
+        }
+        printf("\n");
+    }
+
+    /* Compare before writing, so the summary may replace its own baseline */
+    uint32_t regressions = 0U;
+    if (cfg->baseline_path != NULL) {
+        bool read_ok;
+        regressions = _host_drive_cycle_compare(cfg->baseline_path, ran, &read_ok);
+        if (!read_ok) {
+            fprintf(stderr, "drive-cycle: cannot read %s\n", cfg->baseline_path);
+            return 1U;
+        }
+    }
+    if (cfg->path != NULL && !_host_drive_cycle_write_csv(cfg->path, ran)) {
+        fprintf(stderr, "drive-cycle: cannot write %s\n", cfg->path);
+        return 1U;
+    }
+    return regressions;
+}
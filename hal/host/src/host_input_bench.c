@@ -0,0 +1,249 @@
+/*******************************************************************************************************************************
+ * @file   host_input_bench.c
+ *
+ * @brief  Source file for the host throttle input check and benchmark
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "input.h"
+
+/* Intra-component Headers */
+#include "host_input_bench.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_INPUT_BENCH_DSHOT_PERIOD_US 125U  /* 8 kHz frame rate */
+#define HOST_INPUT_BENCH_PWM_PERIOD_US 20000U  /* 50 Hz frame rate */
+#define HOST_INPUT_BENCH_JITTER_TICKS 2U       /* Edge timing noise, +/- */
+#define HOST_INPUT_BENCH_MAX_EDGES 32U         /* Edges of one frame */
+#define HOST_INPUT_BENCH_TIMING_PASSES 20000U
+
+/**
+ * @brief   One generated frame
+ */
+typedef struct {
+    uint32_t timestamp_ticks;  /**< First rising edge */
+    uint16_t value;            /**< DShot value or pulse width in microseconds */
+    bool telemetry_request;    /**< DShot telemetry request bit */
+    bool corrupt;              /**< Generated to fail decoding */
+} HostInputBenchFrame_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const char *const protocol_names[NUM_HAL_INPUT_PROTOCOLS] = {
+    "servo PWM", "DShot150", "DShot300", "DShot600",
+};
+
+static const uint32_t dshot_kbit_s[NUM_HAL_INPUT_PROTOCOLS] = { 0U, 150U, 300U, 600U };
+
+static uint32_t bench_seed = 1U;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint32_t _host_input_bench_rand(void)
+{
+    bench_seed = bench_seed * 1664525U + 1013904223U;
+    return bench_seed >> 8;
+}
+
+static uint32_t _host_input_bench_jitter(void)
+{
+    return _host_input_bench_rand() % (2U * HOST_INPUT_BENCH_JITTER_TICKS + 1U) - HOST_INPUT_BENCH_JITTER_TICKS;
+}
+
+/**
+ * @brief   Write the edges of one frame
+ * @return  Number of edges
+ */
+static uint32_t _host_input_bench_edges(HalInputProtocol_t protocol, const HostInputBenchFrame_t *frame,
+                                        uint32_t edges[HOST_INPUT_BENCH_MAX_EDGES])
+{
+    if (protocol == HAL_INPUT_PROTOCOL_PWM) {
+        const uint32_t width_us = frame->corrupt ? HAL_INPUT_PWM_MAX_US + 500U : frame->value;
+        edges[0] = frame->timestamp_ticks;
+        edges[1] = frame->timestamp_ticks + width_us * HAL_INPUT_CAPTURE_TICKS_PER_US + _host_input_bench_jitter();
+        return 2U;
+    }
+
+    const uint32_t payload = ((uint32_t)frame->value << 1) | (frame->telemetry_request ? 1U : 0U);
+    uint32_t bits = (payload << 4) | ((payload ^ (payload >> 4) ^ (payload >> 8)) & 0x0FU);
+    if (frame->corrupt) {
+        bits ^= 1U << (_host_input_bench_rand() % HAL_INPUT_DSHOT_BITS);
+    }
+    const uint32_t bit_ticks = (HAL_INPUT_CAPTURE_TICKS_PER_US * 1000U) / dshot_kbit_s[protocol];
+    for (uint32_t i = 0U; i < HAL_INPUT_DSHOT_BITS; ++i) {
+        const bool one = ((bits >> (HAL_INPUT_DSHOT_BITS - 1U - i)) & 1U) != 0U;
+        const uint32_t rise = frame->timestamp_ticks + i * bit_ticks + ((i > 0U) ? _host_input_bench_jitter() : 0U);
+        edges[2U * i] = rise;
+        edges[2U * i + 1U] = rise + (one ? (3U * bit_ticks) / 4U : (3U * bit_ticks) / 8U) + _host_input_bench_jitter();
+    }
+    return HOST_INPUT_BENCH_MAX_EDGES;
+}
+
+static void _host_input_bench_make_frame(HalInputProtocol_t protocol, uint32_t index, uint32_t timestamp_ticks,
+                                         HostInputBenchFrame_t *frame)
+{
+    frame->timestamp_ticks = timestamp_ticks;
+    frame->corrupt = (index % HOST_INPUT_BENCH_CORRUPT_EVERY) == HOST_INPUT_BENCH_CORRUPT_EVERY / 2U;
+    if (protocol == HAL_INPUT_PROTOCOL_PWM) {
+        frame->value = (uint16_t)(HAL_INPUT_PWM_ZERO_US + _host_input_bench_rand() %
+                                  (HAL_INPUT_PWM_FULL_US - HAL_INPUT_PWM_ZERO_US + 1U));
+        frame->telemetry_request = false;
+    } else {
+        frame->value = (uint16_t)(_host_input_bench_rand() % (HAL_INPUT_DSHOT_MAX_THROTTLE + 1U));
+        frame->telemetry_request = (_host_input_bench_rand() % 8U) == 0U;
+    }
+}
+
+/**
+ * @brief   Stream frames through the host capture ring and match what comes out
+ * @return  true if every decoded frame matched and no more were lost than the faults account for
+ */
+static bool _host_input_bench_check(HalInputProtocol_t protocol, uint32_t num_frames)
+{
+    HostInputBenchFrame_t *frames = malloc(num_frames * sizeof(*frames));
+    if (frames == NULL) {
+        return false;
+    }
+
+    hal_host_test_utils_reset();
+    hal_input_init(protocol);
+    const uint32_t period_ticks = HAL_INPUT_CAPTURE_TICKS_PER_US *
+        ((protocol == HAL_INPUT_PROTOCOL_PWM) ? HOST_INPUT_BENCH_PWM_PERIOD_US : HOST_INPUT_BENCH_DSHOT_PERIOD_US);
+    uint32_t pending[2U * HOST_INPUT_BENCH_MAX_EDGES];
+    uint32_t num_pending = 0U;
+    uint32_t next = 0U;
+    uint32_t missed = 0U;
+    uint32_t mismatched = 0U;
+    uint32_t drops = 0U;
+    uint32_t corrupts = 0U;
+    bool first_decoded = false;
+
+    for (uint32_t i = 0U; i < num_frames; ++i) {
+        _host_input_bench_make_frame(protocol, i, (i + 1U) * period_ticks, &frames[i]);
+        uint32_t edges[HOST_INPUT_BENCH_MAX_EDGES];
+        uint32_t num_edges = _host_input_bench_edges(protocol, &frames[i], edges);
+        corrupts += frames[i].corrupt ? 1U : 0U;
+        if (i % HOST_INPUT_BENCH_DROP_EVERY == HOST_INPUT_BENCH_DROP_EVERY - 1U) {
+            /* Lose the falling edge of the first pulse, so the rest of the stream comes out of phase */
+            for (uint32_t e = 1U; e + 1U < num_edges; ++e) {
+                edges[e] = edges[e + 1U];
+            }
+            num_edges--;
+            drops++;
+        }
+        for (uint32_t e = 0U; e < num_edges; ++e) {
+            pending[num_pending++] = edges[e];
+        }
+
+        /* Hand the edges over in chunks of up to one frame, so each update finishes one frame at most */
+        while (num_pending >= num_edges) {
+            const uint32_t chunk = 1U + _host_input_bench_rand() % num_edges;
+            hal_host_test_utils_capture_input_edges(pending, chunk);
+            for (uint32_t e = chunk; e < num_pending; ++e) {
+                pending[e - chunk] = pending[e];
+            }
+            num_pending -= chunk;
+
+            HalInputFrame_t out;
+            if (hal_input_update(&out) == 0U) {
+                continue;
+            }
+            first_decoded |= (next == 0U && frames[0].timestamp_ticks == out.timestamp_ticks);
+            while (next < i && (int32_t)(frames[next].timestamp_ticks - out.timestamp_ticks) < 0) {
+                missed++;
+                next++;
+            }
+            if (frames[next].timestamp_ticks != out.timestamp_ticks || frames[next].corrupt ||
+                frames[next].value != out.value || frames[next].telemetry_request != out.telemetry_request) {
+                mismatched++;
+            }
+            next++;
+        }
+    }
+    free(frames);
+
+    /* A dropped edge costs the frames until the decoder gives up on the swapped polarity */
+    const uint32_t edges_per_frame = (protocol == HAL_INPUT_PROTOCOL_PWM) ? 2U : HOST_INPUT_BENCH_MAX_EDGES;
+    const uint32_t lost_per_drop = (2U * HAL_INPUT_RESYNC_PULSES) / edges_per_frame + 3U;
+    const uint32_t allowed = corrupts + drops * lost_per_drop + 2U;
+    const HalInputStats_t stats = hal_input_get_stats();
+    printf("  %-10s %9u %9u %7u %7u %8u %10u", protocol_names[protocol], (unsigned)stats.frames,
+           (unsigned)stats.errors, (unsigned)stats.resyncs, (unsigned)stats.overruns, (unsigned)missed,
+           (unsigned)mismatched);
+    return (mismatched == 0U) && (missed <= allowed) && (stats.overruns == 0U) && first_decoded;
+}
+
+/**
+ * @brief   Time the decoder over a full ring of good frames
+ * @return  Nanoseconds per frame
+ */
+static double _host_input_bench_time(HalInputProtocol_t protocol)
+{
+    static uint32_t ring[HAL_INPUT_CAPTURE_SIZE];
+    const uint32_t period_ticks = HAL_INPUT_CAPTURE_TICKS_PER_US *
+        ((protocol == HAL_INPUT_PROTOCOL_PWM) ? HOST_INPUT_BENCH_PWM_PERIOD_US : HOST_INPUT_BENCH_DSHOT_PERIOD_US);
+    uint32_t count = 0U;
+    for (uint32_t i = 0U; count < HAL_INPUT_CAPTURE_SIZE; ++i) {
+        HostInputBenchFrame_t frame;
+        _host_input_bench_make_frame(protocol, 0U, (i + 1U) * period_ticks, &frame);
+        uint32_t edges[HOST_INPUT_BENCH_MAX_EDGES];
+        const uint32_t num_edges = _host_input_bench_edges(protocol, &frame, edges);
+        for (uint32_t e = 0U; e < num_edges && count < HAL_INPUT_CAPTURE_SIZE; ++e) {
+            ring[count++] = edges[e];
+        }
+    }
+
+    HalInputDecoder_t decoder;
+    HalInputFrame_t frame;
+    uint64_t frames = 0U;
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t pass = 0U; pass < HOST_INPUT_BENCH_TIMING_PASSES; ++pass) {
+        hal_input_decoder_init(&decoder, protocol, 0U, 0U);
+        frames += hal_input_decode(&decoder, ring, HAL_INPUT_CAPTURE_SIZE, &frame);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    const double elapsed_ns = (double)(end.tv_sec - start.tv_sec) * NANOSECONDS_PER_SECOND +
+                              (double)(end.tv_nsec - start.tv_nsec);
+    return (frames > 0U) ? elapsed_ns / (double)frames : 0.0;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_input_bench_run(uint32_t frames)
+{
+    printf("input-bench: %u frames per protocol, a corrupted frame every %u and a dropped edge every %u\n",
+           (unsigned)frames, (unsigned)HOST_INPUT_BENCH_CORRUPT_EVERY, (unsigned)HOST_INPUT_BENCH_DROP_EVERY);
+    printf("  %-10s %9s %9s %7s %7s %8s %10s %9s\n", "protocol", "decoded", "rejected", "resyncs", "overrun", "missed",
+           "mismatched", "ns/frame");
+
+    uint32_t failures = 0U;
+    for (uint32_t p = 0U; p < NUM_HAL_INPUT_PROTOCOLS; ++p) {
+        const bool ok = _host_input_bench_check((HalInputProtocol_t)p, frames);
+        printf(" %9.1f %s\n", _host_input_bench_time((HalInputProtocol_t)p), ok ? "ok" : "FAIL");
+        failures += ok ? 0U : 1U;
+    }
+    return failures;
+}
@@ -0,0 +1,528 @@
+/*******************************************************************************************************************************
+ * @file   host_link.c
+ *
+ * @brief  Source file for the host protocol loopback and bandwidth check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* Inter-component Headers */
+#include "blackbox.h"
+#include "esc.h"
+#include "protocol.h"
+#include "pwm.h"
+#include "scope.h"
+
+/* Intra-component Headers */
+#include "host_link.h"
+#include "host_plant.h"
+#include "host_test_utils.h"
+
+#if defined(__linux__)
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_LINK_REPLY_TICKS 100U        /* Ticks a reply may take before the request counts as lost */
+#define HOST_LINK_STREAM_TICKS 20000U     /* Ticks of telemetry streaming checked, one second */
+#define HOST_LINK_SCOPE_TICKS 100000U     /* Ticks the scope capture may take */
+#define HOST_LINK_READ_SIZE 65536U        /* Bytes per socket read in the bandwidth check */
+#define HOST_LINK_CODEC_FRAMES 1000U      /* Telemetry frames per pass of the encode and decode timing */
+#define HOST_LINK_CODEC_PASSES 200U
+
+/**
+ * @brief   ESC end of the loopback
+ */
+typedef struct {
+    int fd;                               /**< Socket */
+    Esc_t esc;                            /**< ESC instance */
+    HostPlant_t plant;                    /**< Plant it drives */
+    Protocol_t protocol;                  /**< Protocol serving the ESC */
+} HostLinkDevice_t;
+
+/**
+ * @brief   Host end of the loopback or bandwidth check
+ */
+typedef struct {
+    int fd;                               /**< Socket */
+    ProtocolRx_t rx;                      /**< Reply and telemetry receiver */
+    uint8_t sequence;                     /**< Sequence of the last request */
+    bool has_reply;                       /**< A reply to the last request arrived */
+    uint8_t reply_type;                   /**< Its type */
+    uint8_t reply[PROTOCOL_MAX_PAYLOAD + 1U]; /**< Its payload */
+    size_t reply_len;                     /**< Its payload length */
+    uint32_t telemetry_frames;            /**< TELEMETRY frames received */
+    uint32_t telemetry_gaps;              /**< TELEMETRY frames missed, from the sequence */
+    uint8_t next_stream_sequence;         /**< Sequence the next TELEMETRY frame should have */
+    EscTelemetry_t telemetry;             /**< Last snapshot received */
+} HostLinkClient_t;
+
+/**
+ * @brief   Bandwidth check context shared by the two threads
+ */
+typedef struct {
+    int fd;                               /**< Streaming end */
+    Esc_t *esc;                           /**< ESC whose snapshot is streamed */
+    int stop;                             /**< Set to end the stream */
+} HostLinkStream_t;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint64_t _host_link_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t _host_link_check(const char *name, bool ok)
+{
+    printf("  %-28s %s\n", name, ok ? "ok" : "FAIL");
+    return ok ? 0U : 1U;
+}
+
+static void _host_link_write_all(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0U) {
+        const ssize_t sent = send(fd, data, len, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return;
+        }
+        data += sent;
+        len -= (size_t)sent;
+    }
+}
+
+static void _host_link_client_handle(void *ctx, const ProtocolFrame_t *frame)
+{
+    HostLinkClient_t *client = (HostLinkClient_t *)ctx;
+    if (frame->type == PROTOCOL_MSG_TELEMETRY) {
+        if (client->telemetry_frames > 0U) {
+            client->telemetry_gaps += (uint8_t)(frame->sequence - client->next_stream_sequence);
+        }
+        client->next_stream_sequence = (uint8_t)(frame->sequence + 1U);
+        client->telemetry_frames++;
+        if (frame->len == PROTOCOL_TELEMETRY_SIZE) {
+            protocol_unpack_telemetry(frame->payload, &client->telemetry);
+        }
+        return;
+    }
+    if (frame->sequence == client->sequence && frame->len <= sizeof(client->reply)) {
+        client->has_reply = true;
+        client->reply_type = frame->type;
+        memcpy(client->reply, frame->payload, frame->len);
+        client->reply_len = frame->len;
+    }
+}
+
+static void _host_link_client_poll(HostLinkClient_t *client)
+{
+    uint8_t buf[PROTOCOL_MAX_FRAME];
+    ssize_t len;
+    while ((len = read(client->fd, buf, sizeof(buf))) > 0) {
+        protocol_rx_feed(&client->rx, buf, (size_t)len, _host_link_client_handle, client);
+    }
+}
+
+/**
+ * @brief   One control period of the ESC end: requests in, plant and ESC step, frames out
+ */
+static void _host_link_device_tick(HostLinkDevice_t *dev)
+{
+    uint8_t buf[PROTOCOL_MAX_FRAME];
+    ssize_t len;
+    while ((len = read(dev->fd, buf, sizeof(buf))) > 0) {
+        protocol_receive(&dev->protocol, buf, (size_t)len);
+    }
+
+    const uint32_t dt_us = HAL_PWM_PERIOD_US;
+    host_plant_step(&dev->plant, dt_us);
+    MotorState_t motor_state;
+    hal_host_test_utils_get_motor_state(dev->esc.hal_motor, &motor_state);
+    esc_set_motor_state(&dev->esc, &motor_state);
+    esc_step(&dev->esc, dt_us);
+    const EscInverterCmd_t cmd = esc_get_inverter_cmd(&dev->esc);
+    hal_pwm_apply_inverter_cmd(dev->esc.hal_motor, &cmd);
+    protocol_update(&dev->protocol);
+
+    size_t pending;
+    const uint8_t *tx = protocol_get_tx(&dev->protocol, &pending);
+    if (pending > 0U) {
+        const ssize_t sent = send(dev->fd, tx, pending, MSG_NOSIGNAL);
+        protocol_consume_tx(&dev->protocol, (sent > 0) ? (size_t)sent : 0U);
+    }
+}
+
+static void _host_link_run_ticks(HostLinkDevice_t *dev, HostLinkClient_t *client, uint32_t ticks)
+{
+    for (uint32_t i = 0U; i < ticks; ++i) {
+        _host_link_device_tick(dev);
+        _host_link_client_poll(client);
+    }
+}
+
+/**
+ * @brief   Send a request and run the ESC until its reply arrives
+ * @return  Reply status, or -1 if no reply came
+ */
+static int _host_link_request(HostLinkDevice_t *dev, HostLinkClient_t *client, ProtocolMsg_t type,
+                              const void *payload, size_t len)
+{
+    uint8_t frame[PROTOCOL_MAX_FRAME];
+    ProtocolWriter_t writer;
+    client->sequence++;
+    client->has_reply = false;
+    protocol_frame_begin(&writer, frame, sizeof(frame), (uint8_t)type, client->sequence);
+    protocol_frame_write(&writer, payload, len);
+    _host_link_write_all(client->fd, frame, protocol_frame_end(&writer));
+
+    for (uint32_t i = 0U; i < HOST_LINK_REPLY_TICKS && !client->has_reply; ++i) {
+        _host_link_run_ticks(dev, client, 1U);
+    }
+    if (!client->has_reply || client->reply_type != (uint8_t)(type | PROTOCOL_REPLY_FLAG) || client->reply_len == 0U) {
+        return -1;
+    }
+    return client->reply[0];
+}
+
+static bool _host_link_read_scope(HostLinkDevice_t *dev, HostLinkClient_t *client)
+{
+    const Esc_t *esc = &dev->esc;
+    const uint32_t channels = esc->scope.config.num_channels;
+    const uint32_t frames = scope_get_num_frames(esc);
+    uint32_t first = 0U;
+    while (first < frames) {
+        const uint8_t request[2] = { (uint8_t)first, (uint8_t)(first >> 8) };
+        if (_host_link_request(dev, client, PROTOCOL_MSG_READ_SCOPE, request, sizeof(request)) != PROTOCOL_STATUS_OK) {
+            return false;
+        }
+        /* status, state, channels, frames, trigger, first, count */
+        const uint8_t *reply = client->reply;
+        const uint32_t count = reply[9];
+        const uint32_t held = (uint32_t)(reply[3] | (reply[4] << 8));
+        if (reply[1] != ESC_SCOPE_STATE_DONE || reply[2] != channels || held != frames || count == 0U ||
+            client->reply_len != 10U + count * channels * PROTOCOL_SCOPE_SAMPLE_SIZE) {
+            return false;
+        }
+        for (uint32_t i = 0U; i < count * channels; ++i) {
+            uint8_t held[PROTOCOL_SCOPE_SAMPLE_SIZE];
+            protocol_pack_scope_sample(scope_peek_frame(esc, first + i / channels)[i % channels], held);
+            if (memcmp(&reply[10U + i * PROTOCOL_SCOPE_SAMPLE_SIZE], held, sizeof(held)) != 0) {
+                return false;
+            }
+        }
+        first += count;
+    }
+    return frames > 0U;
+}
+
+static bool _host_link_read_blackbox(HostLinkDevice_t *dev, HostLinkClient_t *client)
+{
+    const Esc_t *esc = &dev->esc;
+    const uint32_t samples = blackbox_get_num_samples(esc);
+    uint32_t first = 0U;
+    while (first < samples) {
+        const uint8_t request[2] = { (uint8_t)first, (uint8_t)(first >> 8) };
+        if (_host_link_request(dev, client, PROTOCOL_MSG_READ_BLACKBOX, request, sizeof(request)) !=
+            PROTOCOL_STATUS_OK) {
+            return false;
+        }
+        /* status, frozen, trigger faults, HAL fault, samples, trigger, first, count */
+        const uint8_t *reply = client->reply;
+        const uint32_t count = reply[10];
+        if (count == 0U || client->reply_len != 11U + count * PROTOCOL_BLACKBOX_SAMPLE_SIZE) {
+            return false;
+        }
+
+        /* The ring has moved on since the reply was encoded, so match the snapshots by time */
+        for (uint32_t i = 0U; i < count; ++i) {
+            const uint8_t *packed = &reply[11U + i * PROTOCOL_BLACKBOX_SAMPLE_SIZE];
+            EscBlackBoxSample_t sample;
+            protocol_unpack_blackbox_sample(packed, &sample);
+            const uint32_t oldest_us = blackbox_peek_sample(esc, 0U)->time_us;
+            if (sample.time_us < oldest_us) {
+                continue;
+            }
+            const uint32_t index = (sample.time_us - oldest_us) / HAL_PWM_PERIOD_US;
+            const EscBlackBoxSample_t *held = blackbox_peek_sample(esc, index);
+            uint8_t held_packed[PROTOCOL_BLACKBOX_SAMPLE_SIZE];
+            if (held == NULL) {
+                return false;
+            }
+            protocol_pack_blackbox_sample(held, held_packed);
+            if (memcmp(held_packed, packed, sizeof(held_packed)) != 0) {
+                return false;
+            }
+        }
+        first += count;
+    }
+    return samples > 0U;
+}
+
+static uint32_t _host_link_run_loopback(int device_fd, int client_fd, HostLinkDevice_t *dev, HostLinkClient_t *client)
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    HostPlantParams_t params;
+    host_plant_default_params(&params);
+    host_plant_init(&dev->plant, HAL_MOTOR_0, &params);
+    EscConfig_t cfg;
+    host_plant_default_esc_config(&cfg);
+    if (!esc_init(&dev->esc, HAL_MOTOR_0, &cfg)) {
+        return 1U;
+    }
+    dev->fd = device_fd;
+    protocol_init(&dev->protocol, &dev->esc);
+    memset(client, 0, sizeof(*client));
+    client->fd = client_fd;
+    protocol_rx_reset(&client->rx);
+
+    uint32_t failures = 0U;
+    int status = _host_link_request(dev, client, PROTOCOL_MSG_PING, NULL, 0U);
+    failures += _host_link_check("ping", status == PROTOCOL_STATUS_OK && client->reply_len == 2U &&
+                                         client->reply[1] == PROTOCOL_VERSION);
+
+    /* Configurations are compared packed, so their padding does not count */
+    uint8_t packed[PROTOCOL_CONFIG_SIZE];
+    uint8_t held[PROTOCOL_CONFIG_SIZE];
+    protocol_pack_config(&dev->esc.config, held);
+    status = _host_link_request(dev, client, PROTOCOL_MSG_GET_CONFIG, NULL, 0U);
+    failures += _host_link_check("get config", status == PROTOCOL_STATUS_OK &&
+                                               client->reply_len == 1U + PROTOCOL_CONFIG_SIZE &&
+                                               memcmp(&client->reply[1], held, sizeof(held)) == 0);
+
+    EscConfig_t changed = cfg;
+    changed.thermal.ambient_temp_C += 5.0f;
+    changed.battery.dc_link_capacitance_F *= 2.0f;
+    protocol_pack_config(&changed, packed);
+    status = _host_link_request(dev, client, PROTOCOL_MSG_SET_CONFIG, packed, sizeof(packed) - 1U);
+    failures += _host_link_check("set config, short", status == PROTOCOL_STATUS_LENGTH);
+    const uint32_t blackbox_before = blackbox_get_num_samples(&dev->esc);
+    status = _host_link_request(dev, client, PROTOCOL_MSG_SET_CONFIG, packed, sizeof(packed));
+    protocol_pack_config(&dev->esc.config, held);
+    failures += _host_link_check("set config", status == PROTOCOL_STATUS_OK &&
+                                               memcmp(held, packed, sizeof(packed)) == 0 &&
+                                               blackbox_get_num_samples(&dev->esc) >= blackbox_before);
+
+    changed.limits.max_phase_current_A = NAN;
+    protocol_pack_config(&changed, packed);
+    status = _host_link_request(dev, client, PROTOCOL_MSG_SET_CONFIG, packed, sizeof(packed));
+    failures += _host_link_check("set config NaN rejected", status == PROTOCOL_STATUS_REJECTED);
+
+    /* A corrupted frame gets no reply and counts as an error at the ESC */
+    uint8_t frame[PROTOCOL_MAX_FRAME];
+    ProtocolWriter_t writer;
+    protocol_frame_begin(&writer, frame, sizeof(frame), PROTOCOL_MSG_PING, ++client->sequence);
+    const size_t len = protocol_frame_end(&writer);
+    frame[1] ^= 0x10U;
+    client->has_reply = false;
+    _host_link_write_all(client->fd, frame, len);
+    _host_link_run_ticks(dev, client, HOST_LINK_REPLY_TICKS);
+    failures += _host_link_check("corrupted frame dropped", !client->has_reply && dev->protocol.rx.errors == 1U);
+
+    const float nan = NAN;
+    status = _host_link_request(dev, client, PROTOCOL_MSG_SET_THROTTLE, &nan, sizeof(nan));
+    failures += _host_link_check("throttle NaN rejected", status == PROTOCOL_STATUS_REJECTED);
+    status = _host_link_request(dev, client, 0x3FU, NULL, 0U);
+    failures += _host_link_check("unknown type", status == PROTOCOL_STATUS_UNKNOWN);
+
+    const uint8_t on = 1U;
+    const float throttle = 0.3f;
+    status = _host_link_request(dev, client, PROTOCOL_MSG_STREAM_TELEMETRY, &on, sizeof(on));
+    status |= _host_link_request(dev, client, PROTOCOL_MSG_SET_THROTTLE, &throttle, sizeof(throttle));
+    const uint32_t frames_before = client->telemetry_frames;
+    _host_link_run_ticks(dev, client, HOST_LINK_STREAM_TICKS);
+    const uint32_t streamed = client->telemetry_frames - frames_before;
+    failures += _host_link_check("telemetry stream", status == PROTOCOL_STATUS_OK &&
+                                 streamed == HOST_LINK_STREAM_TICKS / ESC_SCHED_SLOW_DIVIDER &&
+                                 client->telemetry_gaps == 0U && client->telemetry.velocity_mech_rpm > 0.0f &&
+                                 client->telemetry.sequence == dev->esc.telemetry.sequence);
+
+    EscScopeConfig_t scope_cfg;
+    memset(&scope_cfg, 0, sizeof(scope_cfg));
+    scope_cfg.num_channels = 3U;
+    scope_cfg.channels[0] = ESC_SCOPE_SIGNAL_CURRENT_A;
+    scope_cfg.channels[1] = ESC_SCOPE_SIGNAL_CURRENT_B;
+    scope_cfg.channels[2] = ESC_SCOPE_SIGNAL_SPEED;
+    scope_cfg.trigger = ESC_SCOPE_TRIGGER_NONE;
+    scope_cfg.decimation = 4U;
+    uint8_t packed_scope_cfg[PROTOCOL_SCOPE_CONFIG_SIZE];
+    protocol_pack_scope_config(&scope_cfg, packed_scope_cfg);
+    status = _host_link_request(dev, client, PROTOCOL_MSG_ARM_SCOPE, packed_scope_cfg, sizeof(packed_scope_cfg));
+    for (uint32_t i = 0U; i < HOST_LINK_SCOPE_TICKS && scope_get_state(&dev->esc) != ESC_SCOPE_STATE_DONE; ++i) {
+        _host_link_run_ticks(dev, client, 1U);
+    }
+    failures += _host_link_check("scope readout", status == PROTOCOL_STATUS_OK && _host_link_read_scope(dev, client));
+    failures += _host_link_check("black box readout", _host_link_read_blackbox(dev, client));
+
+    const float stop = 0.0f;
+    status = _host_link_request(dev, client, PROTOCOL_MSG_SET_THROTTLE, &stop, sizeof(stop));
+    failures += _host_link_check("throttle", status == PROTOCOL_STATUS_OK && dev->esc.throttle_cmd == 0.0f);
+
+    printf("link: ESC received %u frames, %u bad; sent %u frames, %u dropped; host received %u frames, %u bad\n",
+           (unsigned)dev->protocol.rx.frames, (unsigned)dev->protocol.rx.errors, (unsigned)dev->protocol.tx_frames,
+           (unsigned)dev->protocol.tx_dropped, (unsigned)client->rx.frames, (unsigned)client->rx.errors);
+    return failures;
+}
+
+static void *_host_link_stream_thread(void *arg)
+{
+    HostLinkStream_t *stream = (HostLinkStream_t *)arg;
+    Protocol_t protocol;
+    protocol_init(&protocol, stream->esc);
+
+    while (!__atomic_load_n(&stream->stop, __ATOMIC_RELAXED)) {
+        while (protocol_send_telemetry(&protocol)) {
+        }
+        size_t pending;
+        const uint8_t *tx = protocol_get_tx(&protocol, &pending);
+        const ssize_t sent = send(stream->fd, tx, pending, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            break;
+        }
+        protocol_consume_tx(&protocol, (size_t)sent);
+    }
+    return NULL;
+}
+
+static uint32_t _host_link_run_bench(Esc_t *esc, uint32_t duration_ms)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return 1U;
+    }
+
+    /* Codec cost alone: encode a batch of frames, then decode it */
+    Protocol_t *protocol = malloc(sizeof(*protocol));
+    uint8_t *batch = malloc(HOST_LINK_CODEC_FRAMES * PROTOCOL_MAX_FRAME);
+    uint8_t *work = malloc(HOST_LINK_CODEC_FRAMES * PROTOCOL_MAX_FRAME);
+    if (protocol == NULL || batch == NULL || work == NULL) {
+        free(protocol);
+        free(batch);
+        free(work);
+        close(fds[0]);
+        close(fds[1]);
+        return 1U;
+    }
+    protocol_init(protocol, esc);
+    HostLinkClient_t client;
+    memset(&client, 0, sizeof(client));
+    protocol_rx_reset(&client.rx);
+    size_t batch_len = 0U;
+    uint64_t encode_ns = 0U;
+    uint64_t decode_ns = 0U;
+    for (uint32_t pass = 0U; pass < HOST_LINK_CODEC_PASSES; ++pass) {
+        batch_len = 0U;
+        const uint64_t start = _host_link_now_ns();
+        for (uint32_t i = 0U; i < HOST_LINK_CODEC_FRAMES; ++i) {
+            (void)protocol_send_telemetry(protocol);
+            size_t len;
+            const uint8_t *tx = protocol_get_tx(protocol, &len);
+            memcpy(&batch[batch_len], tx, len);
+            batch_len += len;
+            protocol_consume_tx(protocol, len);
+        }
+        encode_ns += _host_link_now_ns() - start;
+
+        memcpy(work, batch, batch_len);
+        const uint64_t decode_start = _host_link_now_ns();
+        protocol_rx_feed(&client.rx, work, batch_len, _host_link_client_handle, &client);
+        decode_ns += _host_link_now_ns() - decode_start;
+    }
+    const uint32_t codec_frames = HOST_LINK_CODEC_FRAMES * HOST_LINK_CODEC_PASSES;
+    const uint32_t frame_len = (uint32_t)(batch_len / HOST_LINK_CODEC_FRAMES);
+    const bool codec_ok = (client.telemetry_frames == codec_frames) && (client.telemetry_gaps == 0U) &&
+                          (client.rx.errors == 0U);
+    free(protocol);
+    free(batch);
+    free(work);
+
+    /* Sustained stream through the socket */
+    HostLinkStream_t stream = { .fd = fds[0], .esc = esc, .stop = 0 };
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, _host_link_stream_thread, &stream) != 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return 1U;
+    }
+    memset(&client, 0, sizeof(client));
+    protocol_rx_reset(&client.rx);
+    static uint8_t buf[HOST_LINK_READ_SIZE];
+    uint64_t bytes = 0U;
+    const uint64_t start = _host_link_now_ns();
+    uint64_t elapsed = 0U;
+    while (elapsed < (uint64_t)duration_ms * 1000000ULL) {
+        const ssize_t len = read(fds[1], buf, sizeof(buf));
+        if (len <= 0) {
+            break;
+        }
+        bytes += (uint64_t)len;
+        protocol_rx_feed(&client.rx, buf, (size_t)len, _host_link_client_handle, &client);
+        elapsed = _host_link_now_ns() - start;
+    }
+    __atomic_store_n(&stream.stop, 1, __ATOMIC_RELAXED);
+    shutdown(fds[1], SHUT_RDWR);
+    pthread_join(thread, NULL);
+    close(fds[0]);
+    close(fds[1]);
+
+    const double seconds = (double)elapsed / NANOSECONDS_PER_SECOND;
+    printf("link: telemetry frame %u bytes on the wire; encode %.0f ns, decode %.0f ns per frame\n",
+           (unsigned)frame_len, (double)encode_ns / codec_frames, (double)decode_ns / codec_frames);
+    printf("link: streamed %.0f frames/s, %.1f MB/s through the socket, %u missed, %u bad; a %u baud UART carries "
+           "%u frames/s\n", client.telemetry_frames / seconds, bytes / seconds / 1e6,
+           (unsigned)client.telemetry_gaps, (unsigned)client.rx.errors, (unsigned)HOST_LINK_UART_BAUD,
+           (unsigned)(HOST_LINK_UART_BAUD / 10U / frame_len));
+    return (codec_ok && client.telemetry_frames > 0U && client.telemetry_gaps == 0U && client.rx.errors == 0U) ?
+               0U : 1U;
+}
+
+#endif
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_link_run(uint32_t duration_ms)
+{
+#if defined(__linux__)
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return 1U;
+    }
+    (void)fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    (void)fcntl(fds[1], F_SETFL, O_NONBLOCK);
+
+    HostLinkDevice_t dev;
+    HostLinkClient_t client;
+    uint32_t failures = _host_link_run_loopback(fds[0], fds[1], &dev, &client);
+    close(fds[0]);
+    close(fds[1]);
+
+    failures += _host_link_run_bench(&dev.esc, duration_ms);
+    return failures;
+#else
+    (void)duration_ms;
+    return 1U;
+#endif
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************************************************************
+ * @file   host_motor_id.c
+ *
+ * @brief  Source file for the host motor identification check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_motor_id.h"
+#include "host_plant.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_MOTOR_ID_PI 3.14159265358979323846f
+#define HOST_MOTOR_ID_TRAP_FUNDAMENTAL (12.0f / (HOST_MOTOR_ID_PI * HOST_MOTOR_ID_PI)) /* 120 degree plateau */
+#define HOST_MOTOR_ID_PARAMETERS 3U
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const char *const state_names[NUM_ESC_MOTOR_ID_STATES] = {
+    "idle", "ramp", "resistance", "inductance", "spin", "flux", "done", "failed",
+};
+
+static const char *const error_names[NUM_ESC_MOTOR_ID_ERRORS] = {
+    "none", "fault", "no current", "no rest", "parameters", "hall", "no rotation",
+};
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint32_t _host_motor_id_report(const char *name, float identified, float expected, const char *unit)
+{
+    const float error = (identified - expected) / expected;
+    const bool ok = fabsf(error) <= HOST_MOTOR_ID_TOLERANCE;
+    printf("  %-16s %10.4g %s, plant %10.4g %s, error %+6.2f%% %s\n", name, identified, unit, expected, unit,
+           100.0f * error, ok ? "ok" : "FAIL");
+    return ok ? 0U : 1U;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_motor_id_run(bool sinusoidal_bemf)
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    HostPlantParams_t params;
+    HostPlant_t plant;
+    host_plant_default_params(&params);
+    params.sinusoidal_bemf = sinusoidal_bemf;
+    host_plant_init(&plant, HAL_MOTOR_0, &params);
+
+    EscConfig_t cfg;
+    Esc_t esc;
+    host_plant_default_esc_config(&cfg);
+    cfg.motor_config.phase_resistance_Ohm = 0.0f;
+    cfg.motor_config.phase_inductance_H = 0.0f;
+    cfg.motor_config.flux_linkage_Wb = 0.0f;
+    if (!esc_init(&esc, HAL_MOTOR_0, &cfg)) {
+        return HOST_MOTOR_ID_PARAMETERS;
+    }
+
+    /* Let the measurements settle with the bridge off before starting */
+    const uint32_t dt_us = HAL_PWM_PERIOD_US;
+    uint32_t t_us = 0U;
+    bool started = false;
+    EscMotorId_t id = esc_get_motor_id(&esc);
+    while (t_us < HOST_MOTOR_ID_TIMEOUT_US) {
+        host_plant_step(&plant, dt_us);
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(esc.hal_motor, &motor_state);
+        esc_set_motor_state(&esc, &motor_state);
+        esc_step(&esc, dt_us);
+        const EscInverterCmd_t cmd = esc_get_inverter_cmd(&esc);
+        hal_pwm_apply_inverter_cmd(esc.hal_motor, &cmd);
+        t_us += dt_us;
+
+        if (!started) {
+            started = esc_start_motor_id(&esc);
+            continue;
+        }
+        id = esc_get_motor_id(&esc);
+        if (id.state == ESC_MOTOR_ID_STATE_DONE || id.state == ESC_MOTOR_ID_STATE_FAILED) {
+            break;
+        }
+    }
+
+    printf("motor-id: %s back-EMF plant, %s after %.3f s", sinusoidal_bemf ? "sinusoidal" : "trapezoidal",
+           state_names[id.state], (double)t_us / MICROSECONDS_PER_SECOND);
+    if (id.state == ESC_MOTOR_ID_STATE_FAILED) {
+        printf(" (%s, faults 0x%x)\n", error_names[id.error], (unsigned)esc_get_fault_flags(&esc));
+        return HOST_MOTOR_ID_PARAMETERS;
+    }
+    printf("\n");
+    if (id.state != ESC_MOTOR_ID_STATE_DONE) {
+        return HOST_MOTOR_ID_PARAMETERS;
+    }
+
+    const float fundamental = sinusoidal_bemf ? 1.0f : HOST_MOTOR_ID_TRAP_FUNDAMENTAL;
+    uint32_t failures = 0U;
+    failures += _host_motor_id_report("resistance", id.resistance_Ohm,
+                                      params.phase_resistance_Ohm + params.fet_rds_on_Ohm, "Ohm");
+    failures += _host_motor_id_report("inductance", id.inductance_H, params.phase_inductance_H, "H");
+    failures += _host_motor_id_report("flux linkage", id.flux_linkage_Wb,
+                                      fundamental * params.bemf_constant_Vs / (float)params.num_pole_pairs, "Wb");
+    printf("  %-16s %10.3f per electrical turn\n", "hall edges", id.hall_edges_per_turn);
+    printf("  %-16s kp %.4g duty/A, ki %.4g duty/(A s) (defaults %.4g, %.4g)\n", "current loop", id.current_kp,
+           id.current_ki, CURRENT_LIMIT_KP, CURRENT_LIMIT_KI);
+    return failures;
+}
@@ -0,0 +1,204 @@
+/*******************************************************************************************************************************
+ * @file   host_multi.c
+ *
+ * @brief  Source file for the host multi-motor check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "esc_group.h"
+#include "histogram.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_multi.h"
+#include "host_plant.h"
+#include "host_state.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HOST_MULTI_SLOT_US (HAL_PWM_PERIOD_US / NUM_HAL_MOTORS) /* Scheduler interrupt period */
+#define HOST_MULTI_RIPPLE_POINTS 200U /* DC-link current samples per PWM period */
+#define HOST_MULTI_RIPPLE_EVERY 20U   /* PWM periods between ripple evaluations */
+
+/**
+ * @brief   Carrier placement for the ripple estimate
+ */
+typedef enum {
+    HOST_MULTI_CARRIERS_ALIGNED,   /**< Every period starts together */
+    HOST_MULTI_CARRIERS_STAGGERED, /**< Periods start HAL_PWM_PHASE_US() apart */
+    NUM_HOST_MULTI_CARRIERS
+} HostMultiCarriers_t;
+
+/**
+ * @brief   Results of one run
+ */
+typedef struct {
+    uint8_t num_motors;                          /**< Inverters driven */
+    HostPlant_t plant[NUM_HAL_MOTORS];           /**< Final plant state */
+    bool faulted[NUM_HAL_MOTORS];                /**< ESC faulted at the end */
+    Histogram_t tick_ns[NUM_HAL_MOTORS];         /**< Cost of each slot run */
+    double ripple_A2[NUM_HOST_MULTI_CARRIERS];   /**< Sum of the DC-link current variance of every evaluation */
+    uint32_t ripple_samples;                     /**< Ripple evaluations */
+} HostMultiRun_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static Esc_t host_multi_escs[NUM_HAL_MOTORS];
+static HostMultiRun_t host_multi_group_run;
+static HostMultiRun_t host_multi_solo_run;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static double _host_multi_ripple_A2(uint8_t num_motors, HostMultiCarriers_t carriers)
+{
+    /* DC-link current over one period: each phase current flows while its high-side switch conducts */
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for (uint32_t n = 0U; n < HOST_MULTI_RIPPLE_POINTS; ++n) {
+        const float t = ((float)n + 0.5f) / (float)HOST_MULTI_RIPPLE_POINTS;
+        float bus_A = 0.0f;
+        for (uint8_t m = 0U; m < num_motors; ++m) {
+            const HalHostMotorState_t *state = &hal_host_state.motors[m];
+            if (!state->pwm_outputs_enabled || !state->inverter_cmd_valid) {
+                continue;
+            }
+            const bool center_aligned = state->inverter_cmd_buffer[state->inverter_cmd_active].center_aligned;
+            float u = t;
+            if (carriers == HOST_MULTI_CARRIERS_STAGGERED) {
+                u -= (float)HAL_PWM_PHASE_US(m) / (float)HAL_PWM_PERIOD_US;
+                if (u < 0.0f) {
+                    u += 1.0f;
+                }
+            }
+            for (int k = 0; k < NUM_MOTOR_PHASES; ++k) {
+                const float d = state->phase_switching[k].high_on_fraction;
+                const bool on = center_aligned ? (fabsf(u - 0.5f) < 0.5f * d) : (u < d);
+                if (on) {
+                    bus_A += state->phase_currents_A[k];
+                }
+            }
+        }
+        sum += bus_A;
+        sum_sq += (double)bus_A * bus_A;
+    }
+    const double mean = sum / HOST_MULTI_RIPPLE_POINTS;
+    return sum_sq / HOST_MULTI_RIPPLE_POINTS - mean * mean;
+}
+
+static bool _host_multi_simulate(HostMultiRun_t *run, uint8_t num_motors, uint32_t duration_ms, float throttle)
+{
+    memset(run, 0, sizeof(*run));
+    run->num_motors = num_motors;
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+
+    HostPlantParams_t params;
+    EscConfig_t cfg;
+    EscGroup_t group;
+    host_plant_default_params(&params);
+    host_plant_default_esc_config(&cfg);
+    esc_group_init(&group);
+    for (uint8_t m = 0U; m < num_motors; ++m) {
+        Esc_t *esc = &host_multi_escs[m];
+        host_plant_init(&run->plant[m], (HalMotor_t)m, &params);
+        params.load_torque_Nm *= HOST_MULTI_LOAD_STEP;
+        if (!esc_init(esc, (HalMotor_t)m, &cfg) || !esc_group_add(&group, esc)) {
+            return false;
+        }
+        esc_set_throttle(esc, throttle);
+        histogram_reset(&run->tick_ns[m]);
+    }
+
+    const uint32_t num_slots = (duration_ms * 1000U) / HOST_MULTI_SLOT_US;
+    for (uint32_t slot = 0U; slot < num_slots; ++slot) {
+        for (uint8_t m = 0U; m < num_motors; ++m) {
+            host_plant_step(&run->plant[m], HOST_MULTI_SLOT_US);
+        }
+        const HalMotor_t motor = esc_group_tick(&group);
+        if (group.escs[motor] != NULL) {
+            histogram_record(&run->tick_ns[motor], group.last_cycles[motor]);
+        }
+        if ((slot % (HOST_MULTI_RIPPLE_EVERY * NUM_HAL_MOTORS)) == 0U) {
+            for (int c = 0; c < NUM_HOST_MULTI_CARRIERS; ++c) {
+                run->ripple_A2[c] += _host_multi_ripple_A2(num_motors, (HostMultiCarriers_t)c);
+            }
+            run->ripple_samples++;
+        }
+    }
+
+    for (uint8_t m = 0U; m < num_motors; ++m) {
+        run->faulted[m] = esc_is_faulted(&host_multi_escs[m]);
+    }
+    return true;
+}
+
+static float _host_multi_ripple_rms(const HostMultiRun_t *run, HostMultiCarriers_t carriers)
+{
+    return (run->ripple_samples > 0U) ? (float)sqrt(run->ripple_A2[carriers] / run->ripple_samples) : 0.0f;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_multi_run(uint32_t duration_ms, float throttle)
+{
+    HostMultiRun_t *group = &host_multi_group_run;
+    HostMultiRun_t *solo = &host_multi_solo_run;
+    if (!_host_multi_simulate(group, NUM_HAL_MOTORS, duration_ms, throttle) ||
+        !_host_multi_simulate(solo, 1U, duration_ms, throttle)) {
+        fprintf(stderr, "multi: ESC configuration rejected\n");
+        return 1U;
+    }
+
+    uint32_t failures = 0U;
+    printf("multi: %u ESCs on one scheduler, a slot every %u us, %u ms at throttle %.2f\n", (unsigned)NUM_HAL_MOTORS,
+           (unsigned)HOST_MULTI_SLOT_US, (unsigned)duration_ms, (double)throttle);
+    printf("  %-6s %8s %10s %8s %9s %7s %7s %7s\n", "motor", "load Nm", "speed rpm", "fault", "ticks", "p50 ns",
+           "p99 ns", "max ns");
+    for (uint8_t m = 0U; m < NUM_HAL_MOTORS; ++m) {
+        const float speed_rpm = host_plant_get_speed_rpm(&group->plant[m]);
+        const bool ok = !group->faulted[m] && speed_rpm > HOST_MULTI_MIN_SPEED_RPM;
+        failures += ok ? 0U : 1U;
+        printf("  %-6u %8.3f %10.1f %8s %9llu %7u %7u %7u %s\n", (unsigned)m,
+               (double)group->plant[m].params.load_torque_Nm, (double)speed_rpm, group->faulted[m] ? "yes" : "no",
+               (unsigned long long)group->tick_ns[m].total, (unsigned)histogram_percentile(&group->tick_ns[m], 50.0f),
+               (unsigned)histogram_percentile(&group->tick_ns[m], 99.0f), (unsigned)group->tick_ns[m].max,
+               ok ? "ok" : "FAIL");
+    }
+
+    /* The first inverter's slot and plant steps are the same in both runs, so nothing may differ */
+    const HostPlant_t *a = &group->plant[HAL_MOTOR_0];
+    const HostPlant_t *b = &solo->plant[HAL_MOTOR_0];
+    const bool isolated = a->omega_mech_rad_s == b->omega_mech_rad_s && a->theta_elec_rad == b->theta_elec_rad &&
+                          memcmp(a->phase_currents_A, b->phase_currents_A, sizeof(a->phase_currents_A)) == 0;
+    failures += isolated ? 0U : 1U;
+    printf("  motor 0 alone: %.1f rpm, %s\n", (double)host_plant_get_speed_rpm(b),
+           isolated ? "identical ok" : "differs FAIL");
+
+    const float aligned_A = _host_multi_ripple_rms(group, HOST_MULTI_CARRIERS_ALIGNED);
+    const float staggered_A = _host_multi_ripple_rms(group, HOST_MULTI_CARRIERS_STAGGERED);
+    const bool reduced = staggered_A < aligned_A;
+    failures += reduced ? 0U : 1U;
+    printf("  DC-link ripple rms over %u periods: aligned %.2f A, staggered %.2f A (%+.0f%%) %s\n",
+           (unsigned)group->ripple_samples, (double)aligned_A, (double)staggered_A,
+           (aligned_A > 0.0f) ? 100.0 * (double)(staggered_A / aligned_A - 1.0f) : 0.0, reduced ? "ok" : "FAIL");
+    return failures;
+}
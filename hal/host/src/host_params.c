@@ -0,0 +1,248 @@
+/*******************************************************************************************************************************
+ * @file   host_params.c
+ *
+ * @brief  Source file for the host parameter store check
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "flash.h"
+#include "param_store.h"
+#include "protocol.h"
+
+/* Intra-component Headers */
+#include "host_flash.h"
+#include "host_params.h"
+#include "host_plant.h"
+#include "host_state.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_PARAMS_BOOT_PASSES 10000U
+#define HOST_PARAMS_EXTRA_KEY (PARAM_STORE_MAX_KEYS - 1U) /* Key of the value that must survive compaction */
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static Esc_t esc;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint32_t _host_params_check(const char *name, bool ok)
+{
+    printf("  %-36s %s\n", name, ok ? "ok" : "FAIL");
+    return ok ? 0U : 1U;
+}
+
+static bool _host_params_config_equal(const EscConfig_t *a, const EscConfig_t *b)
+{
+    return memcmp(a, b, sizeof(*a)) == 0;
+}
+
+/**
+ * @brief   Remount, as at a reboot, and load the configuration
+ */
+static bool _host_params_reboot(ParamStore_t *store, EscConfig_t *cfg)
+{
+    return param_store_mount(store) && param_store_load_config(store, HAL_MOTOR_0, cfg);
+}
+
+/**
+ * @brief   Time a mount and configuration load
+ * @return  Nanoseconds per boot
+ */
+static double _host_params_time_boot(void)
+{
+    ParamStore_t store;
+    EscConfig_t cfg;
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0U; i < HOST_PARAMS_BOOT_PASSES; ++i) {
+        (void)_host_params_reboot(&store, &cfg);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    const double elapsed_ns = (double)(end.tv_sec - start.tv_sec) * NANOSECONDS_PER_SECOND +
+                              (double)(end.tv_nsec - start.tv_nsec);
+    return elapsed_ns / HOST_PARAMS_BOOT_PASSES;
+}
+
+/**
+ * @brief   Repeat each save with the power cut after ever more flash operations until it completes
+ * @param   cuts Output number of power cuts made
+ * @return  true if every reboot found the old or the new configuration
+ */
+static bool _host_params_power_cuts(ParamStore_t *store, EscConfig_t *current, uint32_t *cuts)
+{
+    *cuts = 0U;
+    for (uint32_t i = 0U; i < HOST_PARAMS_POWER_CUT_SAVES; ++i) {
+        EscConfig_t next = *current;
+        next.thermal.ambient_temp_C = 30.0f + (float)i;
+        for (uint32_t ops = 0U;; ++ops) {
+            hal_host_test_utils_cut_flash_power_after(ops);
+            (void)param_store_save_config(store, HAL_MOTOR_0, &next);
+            const bool lost = hal_host_test_utils_restore_flash_power();
+
+            EscConfig_t loaded;
+            if (!_host_params_reboot(store, &loaded)) {
+                return false;
+            }
+            const bool is_new = _host_params_config_equal(&loaded, &next);
+            if (!is_new && (!lost || !_host_params_config_equal(&loaded, current))) {
+                return false;
+            }
+            if (!lost) {
+                break;
+            }
+            (*cuts)++;
+            if (is_new) {
+                /* The cut came after the commit; the rest of the save found no power */
+                break;
+            }
+        }
+        *current = next;
+    }
+    return true;
+}
+
+/**
+ * @brief   Save the configuration in use through the protocol and check the reply
+ */
+static bool _host_params_save_via_protocol(ParamStore_t *store)
+{
+    static Protocol_t protocol;
+    protocol_init(&protocol, &esc);
+    protocol.store = store;
+
+    uint8_t frame[PROTOCOL_MAX_FRAME];
+    ProtocolWriter_t writer;
+    protocol_frame_begin(&writer, frame, sizeof(frame), PROTOCOL_MSG_SAVE_CONFIG, 1U);
+    protocol_receive(&protocol, frame, protocol_frame_end(&writer));
+
+    size_t len;
+    const uint8_t *tx = protocol_get_tx(&protocol, &len);
+    if (len < 2U || len > sizeof(frame)) {
+        return false;
+    }
+    memcpy(frame, tx, len);
+    ProtocolFrame_t reply;
+    return protocol_frame_decode(frame, len - 1U, &reply) &&
+           reply.type == (PROTOCOL_MSG_SAVE_CONFIG | PROTOCOL_REPLY_FLAG) && reply.len == 1U &&
+           reply.payload[0] == PROTOCOL_STATUS_OK;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_params_run(const char *path)
+{
+    hal_host_test_utils_reset();
+    if (!hal_host_flash_open(path)) {
+        printf("params: cannot map %s\n", path);
+        return 1U;
+    }
+
+    ParamStore_t store;
+    EscConfig_t cfg;
+    const bool stored = _host_params_reboot(&store, &cfg);
+    printf("params: %s holds %s; mount and load take %.2f us\n", path,
+           stored ? "a configuration" : "no configuration", _host_params_time_boot() / 1000.0);
+
+    uint32_t failures = 0U;
+    for (uint32_t s = 0U; s < HAL_FLASH_NUM_SECTORS; ++s) {
+        (void)hal_flash_erase(s);
+    }
+    memset(hal_host_state.flash_erase_count, 0, sizeof(hal_host_state.flash_erase_count));
+    failures += _host_params_check("erased flash mounts empty", param_store_mount(&store) &&
+                                                                !param_store_load_config(&store, HAL_MOTOR_0, &cfg));
+
+    EscConfig_t saved;
+    host_plant_default_esc_config(&saved);
+    failures += _host_params_check("saved configuration reloads",
+                                   param_store_save_config(&store, HAL_MOTOR_0, &saved) &&
+                                   _host_params_reboot(&store, &cfg) && _host_params_config_equal(&cfg, &saved));
+
+    EscConfig_t invalid = saved;
+    invalid.control_mode = (EscControlMode_t)(NUM_ESC_CONTROL_MODES + 1);
+    failures += _host_params_check("invalid configuration refused",
+                                   !param_store_save_config(&store, HAL_MOTOR_0, &invalid) &&
+                                   _host_params_reboot(&store, &cfg) && _host_params_config_equal(&cfg, &saved));
+
+    /* Records written around the save checks, as by an older firmware, are not taken on load */
+    invalid = saved;
+    invalid.limits.max_phase_current_A = NAN;
+    failures += _host_params_check("non-finite stored record ignored",
+                                   param_store_write(&store, PARAM_STORE_KEY_ESC_CONFIG, ESC_CONFIG_VERSION, &invalid,
+                                                     sizeof(invalid)) && !_host_params_reboot(&store, &cfg));
+    invalid = saved;
+    invalid.limits.max_phase_current_A = 0.0f;
+    failures += _host_params_check("zero current limit record ignored",
+                                   param_store_write(&store, PARAM_STORE_KEY_ESC_CONFIG, ESC_CONFIG_VERSION, &invalid,
+                                                     sizeof(invalid)) && !_host_params_reboot(&store, &cfg));
+
+    failures += _host_params_check("other layout version ignored",
+                                   !param_store_read(&store, PARAM_STORE_KEY_ESC_CONFIG, ESC_CONFIG_VERSION + 1U,
+                                                     &cfg, sizeof(cfg)) &&
+                                   !param_store_read(&store, PARAM_STORE_KEY_ESC_CONFIG, ESC_CONFIG_VERSION, &cfg,
+                                                     sizeof(cfg) - 1U));
+
+    /* Wear: many saves, with a second key that must be carried through every compaction */
+    const uint32_t extra = 0xC0FFEEU;
+    bool ok = param_store_write(&store, HOST_PARAMS_EXTRA_KEY, 1U, &extra, sizeof(extra));
+    const uint32_t start_generation = store.generation;
+    for (uint32_t i = 0U; i < HOST_PARAMS_WEAR_SAVES && ok; ++i) {
+        saved.thermal.ambient_temp_C = (float)(i % 50U);
+        ok = param_store_save_config(&store, HAL_MOTOR_0, &saved);
+    }
+    uint32_t extra_loaded = 0U;
+    ok = ok && _host_params_reboot(&store, &cfg) && _host_params_config_equal(&cfg, &saved) &&
+         param_store_read(&store, HOST_PARAMS_EXTRA_KEY, 1U, &extra_loaded, sizeof(extra_loaded)) &&
+         extra_loaded == extra;
+    failures += _host_params_check("other keys survive compaction", ok);
+
+    uint32_t min_erases = UINT32_MAX;
+    uint32_t max_erases = 0U;
+    for (uint32_t s = 0U; s < HAL_FLASH_NUM_SECTORS; ++s) {
+        const uint32_t erases = hal_host_state.flash_erase_count[s];
+        min_erases = (erases < min_erases) ? erases : min_erases;
+        max_erases = (erases > max_erases) ? erases : max_erases;
+    }
+    failures += _host_params_check("erases spread over the sectors", max_erases - min_erases <= 1U);
+    printf("params: %u saves of a %u-byte configuration took %u compactions, %u to %u erases per sector\n",
+           (unsigned)HOST_PARAMS_WEAR_SAVES, (unsigned)sizeof(EscConfig_t),
+           (unsigned)(store.generation - start_generation), (unsigned)min_erases, (unsigned)max_erases);
+
+    uint32_t cuts = 0U;
+    ok = _host_params_power_cuts(&store, &saved, &cuts);
+    failures += _host_params_check("power cut at every flash operation", ok);
+    printf("params: %u saves survived %u power cuts\n", (unsigned)HOST_PARAMS_POWER_CUT_SAVES, (unsigned)cuts);
+
+    saved.thermal.ambient_temp_C = 25.0f;
+    ok = esc_init(&esc, HAL_MOTOR_0, &saved) && _host_params_save_via_protocol(&store) &&
+         _host_params_reboot(&store, &cfg) && _host_params_config_equal(&cfg, &esc.config);
+    failures += _host_params_check("SAVE_CONFIG over the protocol", ok);
+
+    printf("params: mount and load of %u bytes in use take %.2f us\n", (unsigned)store.write_offset,
+           _host_params_time_boot() / 1000.0);
+    hal_host_flash_close();
+    return failures;
+}
@@ -0,0 +1,539 @@
+/*******************************************************************************************************************************
+ * @file   host_plant.c
+ *
+ * @brief  Source file for the host BLDC plant model
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "thermal.h"
+
+/* Intra-component Headers */
+#include "host_plant.h"
+#include "host_pwm.h"
+#include "host_state.h"
+#include "hal_time.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define PLANT_TWO_PI 6.28318530718f
+#define PLANT_SECTOR_RAD (PLANT_TWO_PI / 6.0f)
+#define PLANT_SPEED_EPSILON_RAD_S 1e-3f
+#define PLANT_SQRT3 1.7320508f
+#define PLANT_INV_SQRT3 0.57735027f
+#define PLANT_D_AXIS_RAD (2.5f * PLANT_SECTOR_RAD) /* Rotor flux on phase A, a quarter turn past its back-EMF peak */
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+/* Hall state reported in each electrical sector, inverse of the trapezoidal Hall-to-step table */
+static const uint8_t sector_to_hall[6] = { 0x4U, 0x5U, 0x1U, 0x3U, 0x2U, 0x6U };
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Normalized back-EMF of phase A. Trapezoidal: +1 on [0, 120) deg, -1 on [180, 300) deg, linear between.
+ *          Sinusoidal: a sine peaking at 60 deg, the middle of the trapezoid plateau.
+ */
+static float _host_plant_bemf_shape(float theta, bool sinusoidal)
+{
+    if (sinusoidal) {
+        return sinf(theta + 0.5f * PLANT_SECTOR_RAD);
+    }
+
+    while (theta < 0.0f) {
+        theta += PLANT_TWO_PI;
+    }
+    while (theta >= PLANT_TWO_PI) {
+        theta -= PLANT_TWO_PI;
+    }
+
+    const float sector = theta / PLANT_SECTOR_RAD;
+    if (sector < 2.0f) {
+        return 1.0f;
+    }
+    if (sector < 3.0f) {
+        return 1.0f - 2.0f * (sector - 2.0f);
+    }
+    if (sector < 5.0f) {
+        return -1.0f;
+    }
+    return -1.0f + 2.0f * (sector - 5.0f);
+}
+
+/* Ticks into a substep at which theta crossed into the given sector, assuming constant speed over the substep */
+static uint64_t _host_plant_crossing_ticks(float theta_prev, float dtheta, uint8_t sector, uint64_t substep_ticks)
+{
+    if (dtheta == 0.0f) {
+        return substep_ticks;
+    }
+
+    const float boundary = (dtheta > 0.0f) ? (float)sector * PLANT_SECTOR_RAD : (float)(sector + 1U) * PLANT_SECTOR_RAD;
+    float to_boundary = boundary - theta_prev;
+    if (dtheta > 0.0f && to_boundary < 0.0f) {
+        to_boundary += PLANT_TWO_PI;
+    } else if (dtheta < 0.0f && to_boundary > 0.0f) {
+        to_boundary -= PLANT_TWO_PI;
+    }
+
+    float fraction = to_boundary / dtheta;
+    if (fraction < 0.0f) {
+        fraction = 0.0f;
+    } else if (fraction > 1.0f) {
+        fraction = 1.0f;
+    }
+    return (uint64_t)(fraction * (float)substep_ticks);
+}
+
+/**
+ * @brief   Phase current slopes of a salient rotor, whose inductance depends on the angle of the current to it
+ * @details In the stationary frame the inductance is (Ld + Lq) / 2 plus (Ld - Lq) / 2 times a reflection about the
+ *          rotor flux axis, so it turns at twice the rotor angle. With two legs conducting the current is held to
+ *          the line between them and only the voltage along that line drives it.
+ * @param   u Per-leg voltage across the inductance, ignored for a leg that does not conduct
+ * @param   didt Output per-leg current slope
+ */
+static void _host_plant_salient_slopes(const HostPlant_t *plant, const float u[NUM_MOTOR_PHASES],
+                                       const bool conducting[NUM_MOTOR_PHASES], int num_conducting,
+                                       float didt[NUM_MOTOR_PHASES])
+{
+    const HostPlantParams_t *p = &plant->params;
+    const float sum_H = 0.5f * (p->phase_inductance_H + p->q_axis_inductance_H);
+    const float diff_H = 0.5f * (p->phase_inductance_H - p->q_axis_inductance_H);
+    const float c2 = cosf(2.0f * (plant->theta_elec_rad - PLANT_D_AXIS_RAD));
+    const float s2 = sinf(2.0f * (plant->theta_elec_rad - PLANT_D_AXIS_RAD));
+    const float omega_elec = plant->omega_mech_rad_s * (float)p->num_pole_pairs;
+    const float *i_abc = plant->phase_currents_A;
+
+    /* Voltage across the inductance less the part its turning takes, in the stationary frame */
+    float u_abc[NUM_MOTOR_PHASES];
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        u_abc[i] = conducting[i] ? u[i] : 0.0f;
+    }
+    const float i_alpha = i_abc[0];
+    const float i_beta = PLANT_INV_SQRT3 * (i_abc[1] - i_abc[2]);
+    const float turning = 2.0f * diff_H * omega_elec;
+    const float y_alpha = u_abc[0] - turning * (-s2 * i_alpha + c2 * i_beta);
+    const float y_beta = PLANT_INV_SQRT3 * (u_abc[1] - u_abc[2]) - turning * (c2 * i_alpha + s2 * i_beta);
+
+    float d_alpha;
+    float d_beta;
+    if (num_conducting == NUM_MOTOR_PHASES) {
+        const float det = sum_H * sum_H - diff_H * diff_H;
+        d_alpha = ((sum_H - diff_H * c2) * y_alpha - diff_H * s2 * y_beta) / det;
+        d_beta = (-diff_H * s2 * y_alpha + (sum_H + diff_H * c2) * y_beta) / det;
+    } else {
+        /* Unit current out of the first conducting leg and back through the second */
+        float w[NUM_MOTOR_PHASES] = { 0.0f, 0.0f, 0.0f };
+        float sign = 1.0f;
+        for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+            if (conducting[i]) {
+                w[i] = sign;
+                sign = -1.0f;
+            }
+        }
+        const float w_alpha = w[0];
+        const float w_beta = PLANT_INV_SQRT3 * (w[1] - w[2]);
+        const float l_alpha = (sum_H + diff_H * c2) * w_alpha + diff_H * s2 * w_beta;
+        const float l_beta = diff_H * s2 * w_alpha + (sum_H - diff_H * c2) * w_beta;
+        const float slope = (w_alpha * y_alpha + w_beta * y_beta) / (w_alpha * l_alpha + w_beta * l_beta);
+        d_alpha = slope * w_alpha;
+        d_beta = slope * w_beta;
+    }
+
+    didt[0] = d_alpha;
+    didt[1] = -0.5f * d_alpha + 0.5f * PLANT_SQRT3 * d_beta;
+    didt[2] = -0.5f * d_alpha - 0.5f * PLANT_SQRT3 * d_beta;
+}
+
+/**
+ * @brief   Reluctance torque of a salient rotor, 3/2 p (Ld - Lq) id iq
+ */
+static float _host_plant_reluctance_torque(const HostPlant_t *plant)
+{
+    const HostPlantParams_t *p = &plant->params;
+    const float c = cosf(plant->theta_elec_rad - PLANT_D_AXIS_RAD);
+    const float s = sinf(plant->theta_elec_rad - PLANT_D_AXIS_RAD);
+    const float i_alpha = plant->phase_currents_A[0];
+    const float i_beta = PLANT_INV_SQRT3 * (plant->phase_currents_A[1] - plant->phase_currents_A[2]);
+    const float i_d = c * i_alpha + s * i_beta;
+    const float i_q = -s * i_alpha + c * i_beta;
+    return 1.5f * (float)p->num_pole_pairs * (p->phase_inductance_H - p->q_axis_inductance_H) * i_d * i_q;
+}
+
+static void _host_plant_publish(const HostPlant_t *plant)
+{
+    HalHostMotorState_t *state = &hal_host_state.motors[plant->motor];
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        state->phase_currents_A[i] = plant->phase_currents_A[i];
+    }
+    state->bus_voltage_V = plant->bus_voltage_V;
+    state->temperature_C = (float)plant->stator_temp_C;
+    state->hall_abc = sector_to_hall[plant->sector];
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void host_plant_default_params(HostPlantParams_t *params)
+{
+    if (params == NULL) {
+        return;
+    }
+
+    params->phase_resistance_Ohm = 0.05f;
+    params->phase_inductance_H = 100e-6f;
+    params->q_axis_inductance_H = 0.0f;
+    params->bemf_constant_Vs = 0.05f;
+    params->sinusoidal_bemf = false;
+    params->num_pole_pairs = 7U;
+    params->inertia_kgm2 = 0.005f;
+    params->viscous_friction_Nms = 0.0005f;
+    params->load_torque_Nm = 0.2f;
+    params->battery_ocv_V = 48.0f;
+    params->battery_resistance_Ohm = 0.05f;
+    params->battery_accepts_charge = true;
+    params->dc_link_capacitance_F = 1000e-6f;
+    params->fet_rds_on_Ohm = 0.005f;
+    params->diode_forward_V = 0.8f;
+    params->ambient_temp_C = 25.0f;
+    params->winding_c_th_J_per_K = 150.0f;
+    params->winding_r_th_K_per_W = 0.4f;
+    params->stator_c_th_J_per_K = 1500.0f;
+    params->stator_r_th_K_per_W = 0.5f;
+    params->fet_c_th_J_per_K = 30.0f;
+    params->fet_r_th_K_per_W = 1.5f;
+}
+
+void host_plant_default_esc_config(EscConfig_t *cfg)
+{
+    if (cfg == NULL) {
+        return;
+    }
+
+    *cfg = (EscConfig_t){ 0 };
+    cfg->control_mode = ESC_CONTROL_MODE_TORQUE;
+    cfg->commutation_method = ESC_COMMUTATION_METHOD_TRAP;
+    cfg->feedback_mechanism = ESC_FEEDBACK_MECHANISM_SENSORED;
+    cfg->limits.max_phase_current_A = 60.0f;
+    cfg->limits.max_temp_C = 70.0f;
+    cfg->limits.vbus_uvlo_V = 30.0f;
+    cfg->limits.vbus_ovlo_V = 58.0f;
+    cfg->limits.max_duty = MAX_PWM_DUTY;
+    cfg->limits.max_regen_current_A = 40.0f;
+    cfg->pwm.dead_time_ns = 500U;
+    cfg->pwm.center_aligned = true;
+    cfg->pwm.synchronous_rectification = true;
+    cfg->pwm.dead_time_compensation = true;
+    cfg->pwm.diode_forward_V = 0.8f;
+    cfg->deadline.degrade_overruns = 5U;
+    cfg->deadline.degrade_window_ticks = 20000U;
+    cfg->thermal.ambient_temp_C = 25.0f;
+    cfg->thermal.winding_resistance_Ohm = 0.05f;
+    cfg->thermal.winding_r_th_K_per_W = 0.4f;
+    cfg->thermal.winding_c_th_J_per_K = 150.0f;
+    cfg->thermal.max_winding_temp_C = 120.0f;
+    cfg->thermal.fet_rds_on_Ohm = 0.005f;
+    cfg->thermal.fet_r_th_K_per_W = 1.5f;
+    cfg->thermal.fet_c_th_J_per_K = 30.0f;
+    cfg->thermal.max_fet_temp_C = 100.0f;
+    cfg->thermal.derate_band_C = 15.0f;
+    cfg->battery.max_discharge_current_A = 40.0f;
+    cfg->battery.max_charge_current_A = 20.0f;
+    cfg->battery.sag_foldback_band_V = 4.0f;
+    cfg->battery.dc_link_capacitance_F = 1000e-6f;
+    cfg->motor_config.num_pole_pairs = 7U;
+    /* Winding plus one conducting switch; the trapezoid's fundamental is 1.216 times its plateau */
+    cfg->motor_config.phase_resistance_Ohm = 0.055f;
+    cfg->motor_config.phase_inductance_H = 100e-6f;
+    cfg->motor_config.flux_linkage_Wb = 1.216f * 0.05f / 7.0f;
+}
+
+void host_plant_init(HostPlant_t *plant, HalMotor_t motor, const HostPlantParams_t *params)
+{
+    if (plant == NULL || params == NULL || motor >= NUM_HAL_MOTORS) {
+        return;
+    }
+
+    plant->params = *params;
+    plant->motor = motor;
+    plant->time_ticks = hal_host_state.time_ticks;
+    for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+        plant->phase_currents_A[i] = 0.0f;
+    }
+    plant->omega_mech_rad_s = 0.0f;
+    plant->theta_elec_rad = 0.5f * PLANT_SECTOR_RAD;
+    plant->sector = 0U;
+    plant->bus_voltage_V = params->battery_ocv_V;
+    plant->battery_current_A = 0.0f;
+    plant->torque_Nm = 0.0f;
+    plant->winding_temp_C = params->ambient_temp_C;
+    plant->stator_temp_C = params->ambient_temp_C;
+    plant->fet_temp_C = params->ambient_temp_C;
+    host_plant_reset_stats(plant);
+
+    hal_host_state.motors[motor].hall_timestamp_ticks = (uint32_t)plant->time_ticks;
+    _host_plant_publish(plant);
+}
+
+void host_plant_step(HostPlant_t *plant, uint32_t dt_us)
+{
+    if (plant == NULL) {
+        return;
+    }
+
+    const HostPlantParams_t *p = &plant->params;
+    HalHostMotorState_t *state = &hal_host_state.motors[plant->motor];
+    const float dt_s = (float)HOST_PLANT_SUBSTEP_US / MICROSECONDS_PER_SECOND;
+    const uint64_t substep_ticks = hal_time_us_to_ticks(HOST_PLANT_SUBSTEP_US);
+    const uint64_t pwm_period_ticks = hal_time_us_to_ticks(HAL_PWM_PERIOD_US);
+    const uint64_t pwm_phase_ticks = hal_time_us_to_ticks(HAL_PWM_PHASE_US(plant->motor));
+    const double copper_start_J = plant->copper_loss_J;
+    const double conduction_start_J = plant->conduction_loss_J;
+    const bool salient = (p->q_axis_inductance_H > 0.0f && p->q_axis_inductance_H != p->phase_inductance_H);
+
+    for (uint32_t t = 0U; t < dt_us; t += HOST_PLANT_SUBSTEP_US) {
+        if ((plant->time_ticks % pwm_period_ticks) == pwm_phase_ticks) {
+            hal_host_pwm_update_event(plant->motor);
+        }
+
+        const float vbus_V = plant->bus_voltage_V;
+        float shape[NUM_MOTOR_PHASES];
+        float e[NUM_MOTOR_PHASES];
+        float v[NUM_MOTOR_PHASES];
+        float diode_fraction[NUM_MOTOR_PHASES];
+        float fet_fraction[NUM_MOTOR_PHASES];
+        float high_fraction[NUM_MOTOR_PHASES];
+        bool conducting[NUM_MOTOR_PHASES];
+        int num_conducting = 0;
+
+        for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+            shape[i] = _host_plant_bemf_shape(plant->theta_elec_rad - (float)i * 2.0f * PLANT_SECTOR_RAD,
+                                              p->sinusoidal_bemf);
+            e[i] = p->bemf_constant_Vs * plant->omega_mech_rad_s * shape[i];
+
+            HalHostPhaseSwitching_t leg = state->phase_switching[i];
+            if (!state->pwm_outputs_enabled) {
+                leg.mode = HAL_HOST_PHASE_FLOATING;
+                leg.high_on_fraction = 0.0f;
+                leg.low_on_fraction = 0.0f;
+            }
+
+            const float i_A = plant->phase_currents_A[i];
+            const float diode_V = (i_A >= 0.0f) ? -p->diode_forward_V : vbus_V + p->diode_forward_V;
+
+            conducting[i] = (leg.mode != HAL_HOST_PHASE_FLOATING) || (i_A != 0.0f);
+            high_fraction[i] = leg.high_on_fraction;
+            fet_fraction[i] = leg.high_on_fraction + leg.low_on_fraction;
+            diode_fraction[i] = 1.0f - fet_fraction[i];
+            v[i] = leg.high_on_fraction * (vbus_V - i_A * p->fet_rds_on_Ohm) -
+                   leg.low_on_fraction * i_A * p->fet_rds_on_Ohm +
+                   diode_fraction[i] * diode_V;
+            if (conducting[i]) {
+                num_conducting++;
+            }
+        }
+
+        /* Star point follows the conducting legs so their currents keep summing to zero */
+        if (num_conducting < 2) {
+            for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+                plant->phase_currents_A[i] = 0.0f;
+            }
+        } else {
+            float v_star = 0.0f;
+            for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+                if (conducting[i]) {
+                    v_star += v[i] - p->phase_resistance_Ohm * plant->phase_currents_A[i] - e[i];
+                }
+            }
+            v_star /= (float)num_conducting;
+
+            float salient_didt[NUM_MOTOR_PHASES];
+            if (salient) {
+                float u[NUM_MOTOR_PHASES];
+                for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+                    u[i] = v[i] - p->phase_resistance_Ohm * plant->phase_currents_A[i] - e[i] - v_star;
+                }
+                _host_plant_salient_slopes(plant, u, conducting, num_conducting, salient_didt);
+            }
+
+            float sum_A = 0.0f;
+            int num_remaining = 0;
+            for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+                if (!conducting[i]) {
+                    continue;
+                }
+                const float i_A = plant->phase_currents_A[i];
+                float next_A = salient ? i_A + salient_didt[i] * dt_s
+                                       : i_A + (v[i] - p->phase_resistance_Ohm * i_A - e[i] - v_star) /
+                                                   p->phase_inductance_H * dt_s;
+
+                /* A leg held only by its diode stops conducting when the current reaches zero */
+                if (state->phase_switching[i].mode == HAL_HOST_PHASE_FLOATING || !state->pwm_outputs_enabled) {
+                    if ((i_A > 0.0f && next_A <= 0.0f) || (i_A < 0.0f && next_A >= 0.0f)) {
+                        next_A = 0.0f;
+                        conducting[i] = false;
+                    }
+                }
+                plant->phase_currents_A[i] = next_A;
+                if (conducting[i]) {
+                    sum_A += next_A;
+                    num_remaining++;
+                }
+            }
+
+            /* Re-balance after a diode drops out */
+            for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+                if (conducting[i]) {
+                    plant->phase_currents_A[i] = (num_remaining < 2) ? 0.0f : plant->phase_currents_A[i] - sum_A / (float)num_remaining;
+                }
+            }
+        }
+
+        /* Losses and DC-link current; reverse current in the diode interval flows through the high-side diode */
+        float inverter_A = 0.0f;
+        for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+            const float i_A = plant->phase_currents_A[i];
+            inverter_A += high_fraction[i] * i_A;
+            if (i_A < 0.0f) {
+                inverter_A += diode_fraction[i] * i_A;
+            }
+            plant->conduction_loss_J += (double)((fet_fraction[i] * i_A * i_A * p->fet_rds_on_Ohm +
+                                                  diode_fraction[i] * fabsf(i_A) * p->diode_forward_V) * dt_s);
+            plant->copper_loss_J += (double)(i_A * i_A * p->phase_resistance_Ohm * dt_s);
+
+            if (fabsf(i_A) > plant->peak_phase_current_A) {
+                plant->peak_phase_current_A = fabsf(i_A);
+            }
+        }
+
+        /* DC link: battery current in, inverter input current out */
+        float battery_A = (p->battery_ocv_V - plant->bus_voltage_V) / p->battery_resistance_Ohm;
+        if (!p->battery_accepts_charge && battery_A < 0.0f) {
+            battery_A = 0.0f;
+        }
+        plant->battery_current_A = battery_A;
+        plant->bus_voltage_V += (battery_A - inverter_A) / p->dc_link_capacitance_F * dt_s;
+        if (battery_A >= 0.0f) {
+            plant->battery_energy_out_J += (double)(p->battery_ocv_V * battery_A * dt_s);
+        } else {
+            plant->battery_energy_in_J -= (double)(p->battery_ocv_V * battery_A * dt_s);
+        }
+        if (plant->bus_voltage_V > plant->peak_bus_voltage_V) {
+            plant->peak_bus_voltage_V = plant->bus_voltage_V;
+        }
+
+        /* Electromagnetic torque from back-EMF power, e_i * i_i / omega, and the reluctance torque */
+        float torque_Nm = 0.0f;
+        for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
+            torque_Nm += p->bemf_constant_Vs * shape[i] * plant->phase_currents_A[i];
+        }
+        if (salient) {
+            torque_Nm += _host_plant_reluctance_torque(plant);
+        }
+        plant->torque_Nm = torque_Nm;
+
+        /* Load torque opposes motion and holds the rotor when the drive torque cannot overcome it */
+        float load_Nm = p->load_torque_Nm;
+        if (plant->omega_mech_rad_s < -PLANT_SPEED_EPSILON_RAD_S) {
+            load_Nm = -load_Nm;
+        } else if (plant->omega_mech_rad_s <= PLANT_SPEED_EPSILON_RAD_S) {
+            if (fabsf(torque_Nm) <= p->load_torque_Nm) {
+                plant->omega_mech_rad_s = 0.0f;
+                load_Nm = torque_Nm;
+            } else if (torque_Nm < 0.0f) {
+                load_Nm = -load_Nm;
+            }
+        }
+
+        const float shaft_W = torque_Nm * plant->omega_mech_rad_s;
+        if (shaft_W >= 0.0f) {
+            plant->shaft_energy_out_J += (double)(shaft_W * dt_s);
+        } else {
+            plant->shaft_energy_in_J -= (double)(shaft_W * dt_s);
+        }
+
+        const float omega_elec = plant->omega_mech_rad_s * (float)p->num_pole_pairs;
+        const float accel = (torque_Nm - load_Nm - p->viscous_friction_Nms * plant->omega_mech_rad_s) / p->inertia_kgm2;
+        const float theta_prev = plant->theta_elec_rad;
+        const float dtheta = omega_elec * dt_s;
+        plant->omega_mech_rad_s += accel * dt_s;
+        plant->theta_elec_rad += dtheta;
+        while (plant->theta_elec_rad >= PLANT_TWO_PI) {
+            plant->theta_elec_rad -= PLANT_TWO_PI;
+        }
+        while (plant->theta_elec_rad < 0.0f) {
+            plant->theta_elec_rad += PLANT_TWO_PI;
+        }
+
+        const uint64_t substep_start_ticks = plant->time_ticks;
+        plant->time_ticks += substep_ticks;
+
+        uint8_t sector = (uint8_t)(plant->theta_elec_rad / PLANT_SECTOR_RAD);
+        if (sector > 5U) {
+            sector = 5U;
+        }
+        if (sector != plant->sector) {
+            plant->sector = sector;
+            state->hall_timestamp_ticks =
+                (uint32_t)(substep_start_ticks + _host_plant_crossing_ticks(theta_prev, dtheta, sector, substep_ticks));
+        }
+    }
+
+    /* Thermal masses, once per step from the energy dissipated over it; double because the per-step change is
+     * far below float resolution at these temperatures */
+    if (dt_us > 0U) {
+        const double step_s = (double)dt_us / MICROSECONDS_PER_SECOND;
+        const double copper_W = (plant->copper_loss_J - copper_start_J) / step_s *
+                                (double)thermal_copper_resistance(1.0f, (float)plant->winding_temp_C);
+        const double fet_W = (plant->conduction_loss_J - conduction_start_J) / step_s;
+        const double winding_to_stator_W = (plant->winding_temp_C - plant->stator_temp_C) / p->winding_r_th_K_per_W;
+        const double stator_to_ambient_W = (plant->stator_temp_C - p->ambient_temp_C) / p->stator_r_th_K_per_W;
+        const double fet_to_ambient_W = (plant->fet_temp_C - p->ambient_temp_C) / p->fet_r_th_K_per_W;
+        plant->winding_temp_C += (copper_W - winding_to_stator_W) / p->winding_c_th_J_per_K * step_s;
+        plant->stator_temp_C += (winding_to_stator_W - stator_to_ambient_W) / p->stator_c_th_J_per_K * step_s;
+        plant->fet_temp_C += (fet_W - fet_to_ambient_W) / p->fet_c_th_J_per_K * step_s;
+    }
+
+    if (plant->time_ticks > hal_host_state.time_ticks) {
+        hal_host_state.time_ticks = plant->time_ticks;
+    }
+    _host_plant_publish(plant);
+}
+
+float host_plant_get_speed_rpm(const HostPlant_t *plant)
+{
+    if (plant == NULL) {
+        return 0.0f;
+    }
+    return plant->omega_mech_rad_s * 60.0f / PLANT_TWO_PI;
+}
+
+void host_plant_reset_stats(HostPlant_t *plant)
+{
+    if (plant == NULL) {
+        return;
+    }
+
+    plant->peak_phase_current_A = 0.0f;
+    plant->peak_bus_voltage_V = plant->bus_voltage_V;
+    plant->battery_energy_out_J = 0.0;
+    plant->battery_energy_in_J = 0.0;
+    plant->conduction_loss_J = 0.0;
+    plant->copper_loss_J = 0.0;
+    plant->shaft_energy_out_J = 0.0;
+    plant->shaft_energy_in_J = 0.0;
+}
@@ -0,0 +1,381 @@
+/*******************************************************************************************************************************
+ * @file   host_rt_runner.c
+ *
+ * @brief  Source file for the host real-time runner module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+#define _GNU_SOURCE /* pthread_setaffinity_np */
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* Inter-component Headers */
+#include "esc.h"
+#include "hal_time.h"
+#include "histogram.h"
+#include "pwm.h"
+
+/* Intra-component Headers */
+#include "host_blackbox.h"
+#include "host_plant.h"
+#include "host_pwm.h"
+#include "host_rt_runner.h"
+#include "host_state.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_RT_RUNNER_TRACE_LINE_LEN 256U
+
+/**
+ * @brief   One replay trace sample
+ */
+typedef struct {
+    uint64_t time_us;                         /**< Sample time */
+    float phase_currents_A[NUM_MOTOR_PHASES]; /**< Phase currents */
+    float vbus_V;                             /**< DC bus voltage */
+    float temperature_C;                      /**< Temperature */
+    uint8_t hall_abc;                         /**< Hall state */
+} HostRtRunnerSample_t;
+
+/**
+ * @brief   State shared with the control thread
+ */
+typedef struct {
+    const HostRtRunnerConfig_t *cfg;
+    HostRtRunnerStats_t *stats;
+    Esc_t esc;
+    HostPlant_t plant;
+    HostRtRunnerSample_t *samples;
+    size_t num_samples;
+    bool ok;
+} HostRtRunnerContext_t;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint64_t _host_rt_runner_cycles_to_ns(uint32_t cycles)
+{
+    return (uint64_t)cycles * 1000U / HAL_TIME_CYCLES_PER_US;
+}
+
+#if defined(__linux__)
+
+static bool _host_rt_runner_load_trace(HostRtRunnerContext_t *ctx, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "rt: cannot open trace %s\n", path);
+        return false;
+    }
+
+    size_t capacity = 0U;
+    char line[HOST_RT_RUNNER_TRACE_LINE_LEN];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        HostRtRunnerSample_t sample;
+        unsigned long long time_us;
+        unsigned int hall;
+        /* Header and comment lines do not parse and are skipped */
+        if (sscanf(line, "%llu,%f,%f,%f,%f,%f,%u", &time_us, &sample.phase_currents_A[MOTOR_PHASE_A],
+                   &sample.phase_currents_A[MOTOR_PHASE_B], &sample.phase_currents_A[MOTOR_PHASE_C], &sample.vbus_V,
+                   &sample.temperature_C, &hall) != 7) {
+            continue;
+        }
+        sample.time_us = time_us;
+        sample.hall_abc = (uint8_t)hall;
+
+        if (ctx->num_samples == capacity) {
+            capacity = (capacity == 0U) ? 1024U : capacity * 2U;
+            HostRtRunnerSample_t *grown = realloc(ctx->samples, capacity * sizeof(*grown));
+            if (grown == NULL) {
+                fclose(file);
+                return false;
+            }
+            ctx->samples = grown;
+        }
+        ctx->samples[ctx->num_samples++] = sample;
+    }
+
+    fclose(file);
+    if (ctx->num_samples == 0U) {
+        fprintf(stderr, "rt: trace %s has no samples\n", path);
+        return false;
+    }
+    return true;
+}
+
+/* Load one replay sample into the host HAL inputs, stamping Hall changes at the sample time */
+static void _host_rt_runner_replay(const HostRtRunnerSample_t *sample)
+{
+    const uint64_t sample_ticks = hal_time_us_to_ticks(sample->time_us);
+    if (sample_ticks > hal_host_state.time_ticks) {
+        hal_host_test_utils_advance_time_ticks(sample_ticks - hal_host_state.time_ticks);
+    }
+
+    hal_host_test_utils_set_phase_currents(HAL_MOTOR_0, sample->phase_currents_A[MOTOR_PHASE_A],
+                                           sample->phase_currents_A[MOTOR_PHASE_B],
+                                           sample->phase_currents_A[MOTOR_PHASE_C]);
+    hal_host_test_utils_set_bus_voltage(HAL_MOTOR_0, sample->vbus_V);
+    hal_host_test_utils_set_temperature(HAL_MOTOR_0, sample->temperature_C);
+    if (sample->hall_abc != hal_host_state.motors[HAL_MOTOR_0].hall_abc) {
+        hal_host_test_utils_set_hall_state(HAL_MOTOR_0, sample->hall_abc);
+        hal_host_test_utils_set_hall_timestamp_ticks(HAL_MOTOR_0, (uint32_t)sample_ticks);
+    }
+}
+
+static uint64_t _host_rt_runner_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+static void *_host_rt_runner_thread(void *arg)
+{
+    HostRtRunnerContext_t *ctx = arg;
+    const HostRtRunnerConfig_t *cfg = ctx->cfg;
+    HostRtRunnerStats_t *stats = ctx->stats;
+
+    if (cfg->cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cfg->cpu, &cpus);
+        stats->pinned = (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0);
+    }
+
+    const int fd = timerfd_create(CLOCK_MONOTONIC, 0);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    const uint64_t period_ns = NANOSECONDS_PER_SECOND / cfg->rate_hz;
+    const uint32_t period_us = (uint32_t)(period_ns / 1000U);
+    const uint64_t num_steps = (uint64_t)cfg->duration_ms * cfg->rate_hz / 1000U;
+
+    /* Absolute first expiry one period out, then periodic; expected_ns tracks the nominal expiry of each step */
+    uint64_t expected_ns = _host_rt_runner_now_ns() + period_ns;
+    struct itimerspec spec;
+    spec.it_interval.tv_sec = (time_t)(period_ns / NANOSECONDS_PER_SECOND);
+    spec.it_interval.tv_nsec = (long)(period_ns % NANOSECONDS_PER_SECOND);
+    spec.it_value.tv_sec = (time_t)(expected_ns / NANOSECONDS_PER_SECOND);
+    spec.it_value.tv_nsec = (long)(expected_ns % NANOSECONDS_PER_SECOND);
+    if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, NULL) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    while (stats->cycles < num_steps) {
+        if (ctx->samples != NULL && stats->cycles >= ctx->num_samples) {
+            break;
+        }
+
+        uint64_t expirations = 0U;
+        if (read(fd, &expirations, sizeof(expirations)) != (ssize_t)sizeof(expirations)) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        const uint64_t wake_ns = _host_rt_runner_now_ns();
+        if (expirations > 1U) {
+            stats->overruns += expirations - 1U;
+            expected_ns += (expirations - 1U) * period_ns;
+        }
+        histogram_record(&stats->wakeup_latency_ns, (uint32_t)(wake_ns - expected_ns));
+
+        /* The measured step: what the control ISR does on target */
+        if (ctx->samples != NULL) {
+            _host_rt_runner_replay(&ctx->samples[stats->cycles]);
+        }
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(ctx->esc.hal_motor, &motor_state);
+        esc_set_motor_state(&ctx->esc, &motor_state);
+        esc_step(&ctx->esc, period_us);
+        const EscInverterCmd_t cmd = esc_get_inverter_cmd(&ctx->esc);
+        hal_pwm_apply_inverter_cmd(ctx->esc.hal_motor, &cmd);
+
+        const uint64_t done_ns = _host_rt_runner_now_ns();
+        histogram_record(&stats->exec_time_ns, (uint32_t)(done_ns - wake_ns));
+        if (done_ns > expected_ns + period_ns) {
+            stats->deadline_misses++;
+        }
+        stats->cycles++;
+        expected_ns += period_ns;
+
+        /* Advance the simulated motor to the next step, outside the measured window */
+        if (ctx->samples == NULL) {
+            host_plant_step(&ctx->plant, period_us);
+        } else {
+            hal_host_pwm_update_event(HAL_MOTOR_0);
+        }
+    }
+
+    close(fd);
+    ctx->ok = true;
+    return NULL;
+}
+
+#endif
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void host_rt_runner_default_config(HostRtRunnerConfig_t *cfg)
+{
+    if (cfg == NULL) {
+        return;
+    }
+
+    cfg->rate_hz = HOST_RT_RUNNER_DEFAULT_RATE_HZ;
+    cfg->duration_ms = 1000U;
+    cfg->cpu = -1;
+    cfg->priority = HOST_RT_RUNNER_DEFAULT_PRIORITY;
+    cfg->throttle = 0.3f;
+    cfg->trace_path = NULL;
+    cfg->blackbox_path = NULL;
+}
+
+bool host_rt_runner_run(const HostRtRunnerConfig_t *cfg, HostRtRunnerStats_t *stats)
+{
+    if (cfg == NULL || stats == NULL) {
+        return false;
+    }
+
+    /* The period must be a whole number of microseconds, as esc_step() takes */
+    if (cfg->rate_hz == 0U || cfg->rate_hz > 1000000U || (1000000U % cfg->rate_hz) != 0U) {
+        fprintf(stderr, "rt: rate %u Hz does not give a whole-microsecond period\n", (unsigned)cfg->rate_hz);
+        return false;
+    }
+
+    histogram_reset(&stats->wakeup_latency_ns);
+    histogram_reset(&stats->exec_time_ns);
+    stats->cycles = 0U;
+    stats->deadline_misses = 0U;
+    stats->overruns = 0U;
+    stats->realtime = false;
+    stats->pinned = false;
+    stats->esc_deadline = (EscDeadlineStats_t){ 0 };
+
+#if defined(__linux__)
+    HostRtRunnerContext_t *ctx = calloc(1U, sizeof(*ctx));
+    if (ctx == NULL) {
+        return false;
+    }
+    ctx->cfg = cfg;
+    ctx->stats = stats;
+
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    if (cfg->trace_path != NULL) {
+        if (!_host_rt_runner_load_trace(ctx, cfg->trace_path)) {
+            free(ctx->samples);
+            free(ctx);
+            return false;
+        }
+    } else {
+        HostPlantParams_t params;
+        host_plant_default_params(&params);
+        host_plant_init(&ctx->plant, HAL_MOTOR_0, &params);
+    }
+
+    EscConfig_t esc_cfg;
+    host_plant_default_esc_config(&esc_cfg);
+    if (!esc_init(&ctx->esc, HAL_MOTOR_0, &esc_cfg)) {
+        free(ctx->samples);
+        free(ctx);
+        return false;
+    }
+    esc_set_throttle(&ctx->esc, cfg->throttle);
+
+    /* Page faults in the loop would show up as latency; lock what we can, unprivileged runs carry on without */
+    (void)mlockall(MCL_CURRENT | MCL_FUTURE);
+
+    pthread_attr_t attr;
+    struct sched_param param = { .sched_priority = cfg->priority };
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    pthread_attr_setschedparam(&attr, &param);
+
+    pthread_t thread;
+    int err = pthread_create(&thread, &attr, _host_rt_runner_thread, ctx);
+    stats->realtime = (err == 0);
+    if (err == EPERM) {
+        fprintf(stderr, "rt: SCHED_FIFO not permitted, running with normal scheduling\n");
+        err = pthread_create(&thread, NULL, _host_rt_runner_thread, ctx);
+    }
+    pthread_attr_destroy(&attr);
+    if (err == 0) {
+        pthread_join(thread, NULL);
+    }
+
+    bool ok = (err == 0) && ctx->ok;
+    stats->esc_deadline = esc_get_deadline_stats(&ctx->esc);
+    if (ok && cfg->blackbox_path != NULL && !host_blackbox_write_csv(&ctx->esc, cfg->blackbox_path)) {
+        fprintf(stderr, "rt: cannot write black box %s\n", cfg->blackbox_path);
+        ok = false;
+    }
+    free(ctx->samples);
+    free(ctx);
+    return ok;
+#else
+    fprintf(stderr, "rt: the real-time runner needs Linux (timerfd, SCHED_FIFO)\n");
+    return false;
+#endif
+}
+
+void host_rt_runner_print_stats(const HostRtRunnerConfig_t *cfg, const HostRtRunnerStats_t *stats)
+{
+    if (cfg == NULL || stats == NULL) {
+        return;
+    }
+
+    printf("rt: %llu steps at %u Hz, %s, %s\n", (unsigned long long)stats->cycles, (unsigned)cfg->rate_hz,
+           stats->realtime ? "SCHED_FIFO" : "normal scheduling", stats->pinned ? "pinned" : "unpinned");
+    printf("rt: %-18s %8s %8s %8s %8s %8s\n", "(ns)", "min", "p50", "p99", "p99.9", "max");
+
+    const Histogram_t *hists[] = { &stats->wakeup_latency_ns, &stats->exec_time_ns };
+    const char *names[] = { "wake-up latency", "execution time" };
+    for (size_t i = 0U; i < 2U; ++i) {
+        const Histogram_t *hist = hists[i];
+        printf("rt: %-18s %8u %8u %8u %8u %8u\n", names[i], (unsigned)(hist->total ? hist->min : 0U),
+               (unsigned)histogram_percentile(hist, 50.0f), (unsigned)histogram_percentile(hist, 99.0f),
+               (unsigned)histogram_percentile(hist, 99.9f), (unsigned)hist->max);
+    }
+    printf("rt: deadline misses %llu, timer overruns %llu\n", (unsigned long long)stats->deadline_misses,
+           (unsigned long long)stats->overruns);
+
+    /* The ESC times esc_step() alone, without the HAL reads and writes around it */
+    static const char *task_names[NUM_ESC_TASKS] = { "fast", "medium", "slow", "telemetry" };
+    const EscDeadlineStats_t *dl = &stats->esc_deadline;
+    printf("rt: esc_step max %u ns, overruns %u", (unsigned)_host_rt_runner_cycles_to_ns(dl->max_cycles),
+           (unsigned)dl->overruns);
+    if (dl->overruns > 0U) {
+        printf(" (worst %u ns, %s task %u ns)", (unsigned)_host_rt_runner_cycles_to_ns(dl->worst_overrun_cycles),
+               task_names[dl->worst_task], (unsigned)_host_rt_runner_cycles_to_ns(dl->worst_task_cycles));
+    }
+    printf("%s\n", dl->degraded ? ", degraded" : "");
+}
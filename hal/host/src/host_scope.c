@@ -0,0 +1,167 @@
+/*******************************************************************************************************************************
+ * @file   host_scope.c
+ *
+ * @brief  Source file for the host software oscilloscope command
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdio.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "pwm.h"
+#include "scope.h"
+
+/* Intra-component Headers */
+#include "host_plant.h"
+#include "host_scope.h"
+#include "host_test_utils.h"
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const char *const signal_names[NUM_ESC_SCOPE_SIGNALS] = {
+    "ia", "ib", "ic", "vbus", "hall", "duty", "duty_a", "duty_b", "duty_c", "angle", "lead",
+    "i_drive", "i_quad", "i_advance", "rpm", "throttle", "i_dc", "pll_angle", "pll_speed", "faults",
+};
+
+static const char *const trigger_names[NUM_ESC_SCOPE_TRIGGERS] = {
+    "none", "rising", "falling", "either",
+};
+
+static const char *const state_names[NUM_ESC_SCOPE_STATES] = {
+    "idle", "armed", "triggered", "done",
+};
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static bool _host_scope_write_csv(const Esc_t *esc, const char *path, uint32_t frame_us)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    const EscScopeConfig_t *cfg = &esc->scope.config;
+    const uint32_t count = scope_get_num_frames(esc);
+    const int32_t trigger = scope_get_trigger_index(esc);
+    fprintf(file, "# esc scope: %u frames every %u us, trigger %s %s %g at frame %d, armed tick max %u ns\n",
+            (unsigned)count, (unsigned)frame_us, signal_names[cfg->trigger_signal], trigger_names[cfg->trigger],
+            (double)cfg->trigger_level, (int)trigger, (unsigned)esc->scope.max_cycles);
+    fprintf(file, "time_us");
+    for (uint32_t c = 0U; c < cfg->num_channels; ++c) {
+        fprintf(file, ",%s", signal_names[cfg->channels[c]]);
+    }
+    fprintf(file, "\n");
+
+    const int32_t origin = (trigger >= 0) ? trigger : 0;
+    for (uint32_t i = 0U; i < count; ++i) {
+        float values[SCOPE_MAX_CHANNELS];
+        (void)scope_get_frame(esc, i, values);
+        fprintf(file, "%lld", (long long)((int32_t)i - origin) * (long long)frame_us);
+        for (uint32_t c = 0U; c < cfg->num_channels; ++c) {
+            fprintf(file, ",%g", (double)values[c]);
+        }
+        fprintf(file, "\n");
+    }
+
+    return fclose(file) == 0;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void host_scope_default_config(HostScopeConfig_t *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->scope.num_channels = 3U;
+    cfg->scope.channels[0] = ESC_SCOPE_SIGNAL_CURRENT_A;
+    cfg->scope.channels[1] = ESC_SCOPE_SIGNAL_CURRENT_B;
+    cfg->scope.channels[2] = ESC_SCOPE_SIGNAL_CURRENT_C;
+    cfg->scope.trigger = ESC_SCOPE_TRIGGER_RISING;
+    cfg->scope.trigger_signal = ESC_SCOPE_SIGNAL_SPEED;
+    cfg->scope.trigger_level = 1000.0f;
+    cfg->scope.decimation = 1U;
+    cfg->scope.pre_trigger_frames = 256U;
+    cfg->throttle = 0.3f;
+    cfg->duration_ms = HOST_SCOPE_DEFAULT_DURATION_MS;
+    cfg->path = NULL;
+}
+
+bool host_scope_parse_signal(const char *name, EscScopeSignal_t *signal)
+{
+    for (uint32_t i = 0U; i < NUM_ESC_SCOPE_SIGNALS; ++i) {
+        if (strcmp(name, signal_names[i]) == 0) {
+            *signal = (EscScopeSignal_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool host_scope_parse_trigger(const char *name, EscScopeTrigger_t *trigger)
+{
+    for (uint32_t i = 0U; i < NUM_ESC_SCOPE_TRIGGERS; ++i) {
+        if (strcmp(name, trigger_names[i]) == 0) {
+            *trigger = (EscScopeTrigger_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool host_scope_run(const HostScopeConfig_t *cfg)
+{
+    hal_host_test_utils_reset();
+    hal_pwm_init();
+    HostPlantParams_t params;
+    HostPlant_t plant;
+    host_plant_default_params(&params);
+    host_plant_init(&plant, HAL_MOTOR_0, &params);
+
+    EscConfig_t esc_cfg;
+    Esc_t esc;
+    host_plant_default_esc_config(&esc_cfg);
+    if (!esc_init(&esc, HAL_MOTOR_0, &esc_cfg) || !scope_arm(&esc, &cfg->scope)) {
+        fprintf(stderr, "scope: capture settings out of range\n");
+        return false;
+    }
+    esc_set_throttle(&esc, cfg->throttle);
+
+    const uint32_t dt_us = HAL_PWM_PERIOD_US;
+    const uint32_t duration_us = cfg->duration_ms * 1000U;
+    uint32_t t_us = 0U;
+    while (t_us < duration_us && scope_get_state(&esc) != ESC_SCOPE_STATE_DONE) {
+        host_plant_step(&plant, dt_us);
+        MotorState_t motor_state;
+        hal_host_test_utils_get_motor_state(esc.hal_motor, &motor_state);
+        esc_set_motor_state(&esc, &motor_state);
+        esc_step(&esc, dt_us);
+        const EscInverterCmd_t cmd = esc_get_inverter_cmd(&esc);
+        hal_pwm_apply_inverter_cmd(esc.hal_motor, &cmd);
+        t_us += dt_us;
+    }
+
+    const EscScopeState_t state = scope_get_state(&esc);
+    const uint32_t frame_us = dt_us * cfg->scope.decimation;
+    printf("scope: %s after %.3f s, %u frames of %u channels every %u us, trigger frame %d\n", state_names[state],
+           (double)t_us / MICROSECONDS_PER_SECOND, (unsigned)scope_get_num_frames(&esc),
+           (unsigned)cfg->scope.num_channels, (unsigned)frame_us, (int)scope_get_trigger_index(&esc));
+    printf("scope: armed tick %u ns last, %u ns max\n", (unsigned)esc.scope.last_cycles,
+           (unsigned)esc.scope.max_cycles);
+
+    /* A capture cut short by the time limit is still written, as far as it got */
+    if (cfg->path != NULL && scope_get_num_frames(&esc) > 0U &&
+        !_host_scope_write_csv(&esc, cfg->path, frame_us)) {
+        fprintf(stderr, "scope: cannot write %s\n", cfg->path);
+        return false;
+    }
+    return state == ESC_SCOPE_STATE_DONE;
+}
@@ -9,6 +9,7 @@
 
 /* Standard library Headers */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* Inter-component Headers */
@@ -19,6 +20,7 @@
 /* Intra-component Headers */
 #include "host_state.h"
 #include "host_test_utils.h"
+#include "hal_time.h"
 
 /*******************************************************************************************************************************
  * Private Variables
@@ -30,94 +32,150 @@
  *******************************************************************************************************************************/
 
 void hal_host_test_utils_reset(void) {
-    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
-        hal_host_state.phase_currents_A[i] = 0.0f;
+    for (int m = 0; m < NUM_HAL_MOTORS; m++) {
+        HalHostMotorState_t *state = &hal_host_state.motors[m];
+        for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+            state->phase_currents_A[i] = 0.0f;
+        }
+        state->bus_voltage_V = 0.0f;
+        state->temperature_C = 0.0f;
+
+        state->hall_abc = 0U;
+        state->hall_timestamp_ticks = 0U;
+
+        state->fault_active = false;
+        state->fault = HAL_FAULT_NONE;
+        state->ready = false;
+
+        state->pwm_outputs_enabled = false;
+        for (uint8_t i = 0U; i < HAL_HOST_PWM_NUM_BUFFERS; i++) {
+            state->inverter_cmd_buffer[i] = (EscInverterCmd_t){ 0 };
+        }
+        state->inverter_cmd_active = 0U;
+        state->inverter_cmd_pending = false;
+        state->inverter_cmd_valid = false;
+        state->pwm_update_count = 0U;
+        state->pwm_write_hook = NULL;
+        for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+            state->phase_switching[i].mode = HAL_HOST_PHASE_FLOATING;
+            state->phase_switching[i].high_on_fraction = 0.0f;
+            state->phase_switching[i].low_on_fraction = 0.0f;
+        }
     }
-    hal_host_state.bus_voltage_V = 0.0f;
-    hal_host_state.temperature_C = 0.0f;
 
-    hal_host_state.hall_abc = 0U;
-    hal_host_state.hall_timestamp_us = 0U;
+    hal_host_state.input_edge_count = 0U;
 
-    hal_host_state.fault_active = false;
-    hal_host_state.fault = HAL_FAULT_NONE;
-    hal_host_state.ready = false;
+    /* The flash contents are kept, as they are across a real reset */
+    hal_host_state.flash_power_cut_armed = false;
+    hal_host_state.flash_ops_to_power_cut = 0U;
+    hal_host_state.flash_power_lost = false;
 
-    hal_host_state.time_us = 0U;
-
-    hal_host_state.pwm_outputs_enabled = false;
-    hal_host_state.inverter_cmd.enable = false;
-    hal_host_state.inverter_cmd.duty = 0.0f;
-    hal_host_state.inverter_cmd.commutation_step = 0U;
-    hal_host_state.inverter_cmd_valid = false;
+    hal_host_state.time_ticks = 0U;
 }
 
-void hal_host_test_utils_set_phase_currents(float phase_a_A, float phase_b_A, float phase_c_A) {
-    hal_host_state.phase_currents_A[MOTOR_PHASE_A] = phase_a_A;
-    hal_host_state.phase_currents_A[MOTOR_PHASE_B] = phase_b_A;
-    hal_host_state.phase_currents_A[MOTOR_PHASE_C] = phase_c_A;
+void hal_host_test_utils_set_phase_currents(HalMotor_t motor, float phase_a_A, float phase_b_A, float phase_c_A) {
+    hal_host_state.motors[motor].phase_currents_A[MOTOR_PHASE_A] = phase_a_A;
+    hal_host_state.motors[motor].phase_currents_A[MOTOR_PHASE_B] = phase_b_A;
+    hal_host_state.motors[motor].phase_currents_A[MOTOR_PHASE_C] = phase_c_A;
 }
 
-void hal_host_test_utils_set_bus_voltage(float bus_voltage_V) {
+void hal_host_test_utils_set_bus_voltage(HalMotor_t motor, float bus_voltage_V) {
     // check for under / overvolt
-    hal_host_state.bus_voltage_V = bus_voltage_V;
+    hal_host_state.motors[motor].bus_voltage_V = bus_voltage_V;
 }
 
-void hal_host_test_utils_set_temperature(float temperature_C) {
-    hal_host_state.temperature_C = temperature_C;
+void hal_host_test_utils_set_temperature(HalMotor_t motor, float temperature_C) {
+    hal_host_state.motors[motor].temperature_C = temperature_C;
 }
 
-void hal_host_test_utils_set_hall_state(uint8_t hall_abc) {
-    hal_host_state.hall_abc = hall_abc;
+void hal_host_test_utils_set_hall_state(HalMotor_t motor, uint8_t hall_abc) {
+    hal_host_state.motors[motor].hall_abc = hall_abc;
 }
 
-void hal_host_test_utils_set_hall_timestamp_us(uint32_t hall_timestamp_us) {
-    hal_host_state.hall_timestamp_us = hall_timestamp_us;
+void hal_host_test_utils_set_hall_timestamp_ticks(HalMotor_t motor, uint32_t hall_timestamp_ticks) {
+    hal_host_state.motors[motor].hall_timestamp_ticks = hall_timestamp_ticks;
 }
 
-void hal_host_test_utils_set_fault(bool active, HalFault_t fault) {
+void hal_host_test_utils_capture_input_edges(const uint32_t *ticks, uint32_t count) {
+    for (uint32_t i = 0U; i < count; i++) {
+        hal_host_state.input_edge_ticks[hal_host_state.input_edge_count % HAL_INPUT_CAPTURE_SIZE] = ticks[i];
+        hal_host_state.input_edge_count++;
+    }
+}
+
+void hal_host_test_utils_set_fault(HalMotor_t motor, bool active, HalFault_t fault) {
     if (active) {
-        hal_host_state.fault |= fault;
+        hal_host_state.motors[motor].fault |= fault;
     } else {
-        hal_host_state.fault &= ~(1 << fault);
+        hal_host_state.motors[motor].fault &= ~(1 << fault);
     }
 }
 
-void hal_host_test_utils_set_ready(bool ready) {
-    hal_host_state.ready = ready;
+void hal_host_test_utils_set_ready(HalMotor_t motor, bool ready) {
+    hal_host_state.motors[motor].ready = ready;
 }
 
 void hal_host_test_utils_advance_time_ms(uint32_t delta_ms) {
-    hal_host_state.time_us += delta_ms ;
+    hal_host_state.time_ticks += (uint64_t)delta_ms * HAL_TIME_TICKS_PER_MS;
 }
 
 void hal_host_test_utils_advance_time_us(uint32_t delta_us) {
-    hal_host_state.time_us += delta_us / 1000;
+    hal_host_state.time_ticks += hal_time_us_to_ticks(delta_us);
 }
 
-bool hal_host_test_utils_get_inverter_cmd(EscInverterCmd_t *cmd) {
+void hal_host_test_utils_advance_time_ticks(uint64_t delta_ticks) {
+    hal_host_state.time_ticks += delta_ticks;
+}
+
+bool hal_host_test_utils_get_inverter_cmd(HalMotor_t motor, EscInverterCmd_t *cmd) {
     if (cmd == NULL) return false;
 
-    hal_host_state.inverter_cmd.enable = cmd->enable;
-    hal_host_state.inverter_cmd.duty = cmd->duty;
-    hal_host_state.inverter_cmd.commutation_step = cmd->commutation_step;
-    return true;
+    const HalHostMotorState_t *state = &hal_host_state.motors[motor];
+    *cmd = state->inverter_cmd_buffer[state->inverter_cmd_active];
+    return state->inverter_cmd_valid;
+}
+
+void hal_host_test_utils_set_pwm_write_hook(HalMotor_t motor, HalHostPwmWriteHook_t hook) {
+    hal_host_state.motors[motor].pwm_write_hook = hook;
 }
 
-bool hal_host_test_utils_pwm_outputs_enabled(void) {
-    return hal_host_state.pwm_outputs_enabled;
+bool hal_host_test_utils_get_phase_switching(HalMotor_t motor, MotorPhase_t phase, HalHostPhaseSwitching_t *switching) {
+    if (switching == NULL || phase >= NUM_MOTOR_PHASES) return false;
+
+    *switching = hal_host_state.motors[motor].phase_switching[phase];
+    return hal_host_state.motors[motor].inverter_cmd_valid;
+}
+
+bool hal_host_test_utils_pwm_outputs_enabled(HalMotor_t motor) {
+    return hal_host_state.motors[motor].pwm_outputs_enabled;
 }
 
-bool hal_host_test_utils_get_motor_state(MotorState_t *motor_state) {
+bool hal_host_test_utils_get_motor_state(HalMotor_t motor, MotorState_t *motor_state) {
     if (motor_state == NULL) return false;
 
+    const HalHostMotorState_t *state = &hal_host_state.motors[motor];
     for (int i = 0; i < NUM_MOTOR_PHASES; ++i) {
-        motor_state->phase_currents_A[i] = hal_host_state.phase_currents_A[i];
+        motor_state->phase_currents_A[i] = state->phase_currents_A[i];
     }
-    motor_state->vbus_V = hal_host_state.bus_voltage_V;
-    motor_state->temperature_C = hal_host_state.temperature_C;
-    motor_state->hall_abc = hal_host_state.hall_abc;
-    motor_state->hall_timestamp_us = hal_host_state.hall_timestamp_us;
+    motor_state->vbus_V = state->bus_voltage_V;
+    motor_state->temperature_C = state->temperature_C;
+    motor_state->hall_abc = state->hall_abc;
+    motor_state->hall_timestamp_ticks = state->hall_timestamp_ticks;
+
+    return true;
+}
+
+void hal_host_test_utils_cut_flash_power_after(uint32_t operations) {
+    hal_host_state.flash_power_cut_armed = true;
+    hal_host_state.flash_ops_to_power_cut = operations;
+    hal_host_state.flash_power_lost = false;
+}
+
+bool hal_host_test_utils_restore_flash_power(void) {
+    const bool lost = hal_host_state.flash_power_lost;
+    hal_host_state.flash_power_cut_armed = false;
+    hal_host_state.flash_power_lost = false;
+    return lost;
 }
 
-/** @} */
\ No newline at end of file
+/** @} */
@@ -0,0 +1,293 @@
+/*******************************************************************************************************************************
+ * @file   host_trig_bench.c
+ *
+ * @brief  Source file for the host trigonometry benchmark module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "trig.h"
+
+/* Intra-component Headers */
+#include "host_trig_bench.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define HOST_TRIG_BENCH_ANGLES 65536U
+#define HOST_TRIG_BENCH_PI 3.14159265358979323846
+#define HOST_TRIG_BENCH_RAD_PER_COUNT (2.0 * HOST_TRIG_BENCH_PI / 65536.0)
+
+/* Documented error bounds from trig.h */
+#define HOST_TRIG_BENCH_SIN_BOUND 2.0e-5
+#define HOST_TRIG_BENCH_Q15_BOUND (2.0 / 32768.0)
+#define HOST_TRIG_BENCH_ATAN2_BOUND_COUNTS 1.0
+#define HOST_TRIG_BENCH_MAGNITUDE_BOUND_LSB 1.0
+#define HOST_TRIG_BENCH_MAGNITUDE_BOUND_REL 1e-4
+#define HOST_TRIG_BENCH_SQRT_BOUND_REL 5e-6
+
+/**
+ * @brief   Kernels timed against each other
+ */
+typedef enum {
+    HOST_TRIG_BENCH_LIBM_SINF,
+    HOST_TRIG_BENCH_TRIG_SIN,
+    HOST_TRIG_BENCH_TRIG_SIN_Q15,
+    HOST_TRIG_BENCH_LIBM_SINCOSF,
+    HOST_TRIG_BENCH_TRIG_SINCOS,
+    HOST_TRIG_BENCH_CORDIC_SINCOS,
+    HOST_TRIG_BENCH_LIBM_ATAN2F,
+    HOST_TRIG_BENCH_TRIG_ATAN2,
+    HOST_TRIG_BENCH_CORDIC_ATAN2,
+    HOST_TRIG_BENCH_LIBM_SQRTF,
+    HOST_TRIG_BENCH_TRIG_SQRT,
+    HOST_TRIG_BENCH_SQRT_U32,
+    HOST_TRIG_BENCH_NUM_KERNELS
+} HostTrigBenchKernel_t;
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static const char *const kernel_names[HOST_TRIG_BENCH_NUM_KERNELS] = {
+    "libm sinf",      "trig_sin",          "trig_sin_q15",       "libm sinf+cosf",
+    "trig_sincos",    "trig_cordic_sincos", "libm atan2f",       "trig_atan2",
+    "trig_cordic_atan2", "libm sqrtf",     "trig_sqrt",          "trig_sqrt_u32",
+};
+
+/* Inputs shared by the timed kernels, one per angle */
+static float bench_x[HOST_TRIG_BENCH_ANGLES];
+static float bench_y[HOST_TRIG_BENCH_ANGLES];
+static int16_t bench_x_q15[HOST_TRIG_BENCH_ANGLES];
+static int16_t bench_y_q15[HOST_TRIG_BENCH_ANGLES];
+
+/* Results land here so the compiler cannot drop the timed calls */
+static volatile float bench_sink_f;
+static volatile int32_t bench_sink_i;
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint64_t _host_trig_bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+/* Signed difference of two angles in counts, wrapped to half a turn */
+static double _host_trig_bench_angle_error(double angle, double expected)
+{
+    double error = fmod(angle - expected, 65536.0);
+    if (error > 32768.0) {
+        error -= 65536.0;
+    } else if (error < -32768.0) {
+        error += 65536.0;
+    }
+    return fabs(error);
+}
+
+static double _host_trig_bench_max(double a, double b)
+{
+    return (a > b) ? a : b;
+}
+
+static uint32_t _host_trig_bench_report(const char *name, double error, double bound, const char *unit)
+{
+    const bool ok = error <= bound;
+    printf("  %-20s max error %.3g %s (bound %.3g) %s\n", name, error, unit, bound, ok ? "ok" : "FAIL");
+    return ok ? 0U : 1U;
+}
+
+static uint32_t _host_trig_bench_check_accuracy(void)
+{
+    uint32_t failures = 0U;
+    double sin_error = 0.0;
+    double sincos_error = 0.0;
+    double q15_error = 0.0;
+    double cordic_error = 0.0;
+    for (uint32_t a = 0U; a < HOST_TRIG_BENCH_ANGLES; ++a) {
+        const uint16_t angle = (uint16_t)a;
+        const double s = sin((double)a * HOST_TRIG_BENCH_RAD_PER_COUNT);
+        const double c = cos((double)a * HOST_TRIG_BENCH_RAD_PER_COUNT);
+        float sin_f;
+        float cos_f;
+        trig_sincos(angle, &sin_f, &cos_f);
+        sin_error = _host_trig_bench_max(sin_error, fabs((double)trig_sin(angle) - s));
+        sincos_error = _host_trig_bench_max(sincos_error, _host_trig_bench_max(fabs(sin_f - s), fabs(cos_f - c)));
+        q15_error = _host_trig_bench_max(q15_error, fabs(trig_sin_q15(angle) / 32768.0 - s));
+        q15_error = _host_trig_bench_max(q15_error, fabs(trig_cos_q15(angle) / 32768.0 - c));
+        int16_t sin_q;
+        int16_t cos_q;
+        trig_cordic_sincos_q15(angle, &sin_q, &cos_q);
+        cordic_error = _host_trig_bench_max(cordic_error, fabs(sin_q / 32768.0 - s));
+        cordic_error = _host_trig_bench_max(cordic_error, fabs(cos_q / 32768.0 - c));
+    }
+    failures += _host_trig_bench_report("trig_sin", sin_error, HOST_TRIG_BENCH_SIN_BOUND, "");
+    failures += _host_trig_bench_report("trig_sincos", sincos_error, HOST_TRIG_BENCH_SIN_BOUND, "");
+    failures += _host_trig_bench_report("trig_sin/cos_q15", q15_error, HOST_TRIG_BENCH_Q15_BOUND, "");
+    failures += _host_trig_bench_report("trig_cordic_sincos", cordic_error, HOST_TRIG_BENCH_Q15_BOUND, "");
+
+    /* Vectors at every angle, over a range of lengths */
+    static const double float_radii[] = {1e-3, 1.0, 1e3};
+    static const double int_radii[] = {100.0, 1000.0, 32767.0};
+    double atan2_error = 0.0;
+    double cordic_atan2_error = 0.0;
+    double magnitude_error = 0.0;
+    for (size_t r = 0U; r < sizeof(float_radii) / sizeof(float_radii[0]); ++r) {
+        for (uint32_t a = 0U; a < HOST_TRIG_BENCH_ANGLES; ++a) {
+            /* Off the count grid, so the rounding to counts is exercised too */
+            const double theta = ((double)a + (double)((a * 7919U) % 1000U) / 1000.0) * HOST_TRIG_BENCH_RAD_PER_COUNT;
+            const float x = (float)(float_radii[r] * cos(theta));
+            const float y = (float)(float_radii[r] * sin(theta));
+            const double expected = atan2((double)y, (double)x) / HOST_TRIG_BENCH_RAD_PER_COUNT;
+            atan2_error = _host_trig_bench_max(atan2_error, _host_trig_bench_angle_error(trig_atan2(y, x), expected));
+
+            const int16_t xi = (int16_t)lround(int_radii[r] * cos(theta));
+            const int16_t yi = (int16_t)lround(int_radii[r] * sin(theta));
+            uint16_t magnitude;
+            const uint16_t angle = trig_cordic_atan2(yi, xi, &magnitude);
+            const double expected_i = atan2((double)yi, (double)xi) / HOST_TRIG_BENCH_RAD_PER_COUNT;
+            cordic_atan2_error = _host_trig_bench_max(cordic_atan2_error, _host_trig_bench_angle_error(angle, expected_i));
+            /* Magnitude error in LSB beyond the relative bound */
+            const double length = hypot((double)xi, (double)yi);
+            magnitude_error = _host_trig_bench_max(
+                magnitude_error, fabs((double)magnitude - length) - length * HOST_TRIG_BENCH_MAGNITUDE_BOUND_REL);
+        }
+    }
+    failures += _host_trig_bench_report("trig_atan2", atan2_error, HOST_TRIG_BENCH_ATAN2_BOUND_COUNTS, "counts");
+    failures +=
+        _host_trig_bench_report("trig_cordic_atan2", cordic_atan2_error, HOST_TRIG_BENCH_ATAN2_BOUND_COUNTS, "counts");
+    failures += _host_trig_bench_report("cordic magnitude", magnitude_error, HOST_TRIG_BENCH_MAGNITUDE_BOUND_LSB,
+                                        "LSB over 0.01%");
+
+    double sqrt_error = 0.0;
+    for (int e = -40; e <= 40; ++e) {
+        for (uint32_t m = 0U; m < 1024U; ++m) {
+            const float x = ldexpf(1.0f + (float)m / 1024.0f, e);
+            const double expected = sqrt((double)x);
+            sqrt_error = _host_trig_bench_max(sqrt_error, fabs(trig_sqrt(x) - expected) / expected);
+            sqrt_error = _host_trig_bench_max(sqrt_error, fabs(trig_rsqrt(x) * expected - 1.0));
+        }
+    }
+    failures += _host_trig_bench_report("trig_sqrt/rsqrt", sqrt_error, HOST_TRIG_BENCH_SQRT_BOUND_REL, "relative");
+
+    uint32_t sqrt_u32_wrong = 0U;
+    for (uint64_t x = 0U; x <= 0xFFFFFFFFULL; x += (x < 0x100000ULL) ? 1U : 65521U) {
+        const uint64_t root = trig_sqrt_u32((uint32_t)x);
+        if (root * root > x || (root + 1U) * (root + 1U) <= x) {
+            ++sqrt_u32_wrong;
+        }
+    }
+    failures += _host_trig_bench_report("trig_sqrt_u32", (double)sqrt_u32_wrong, 0.0, "wrong roots");
+    return failures;
+}
+
+static void _host_trig_bench_run_kernel(HostTrigBenchKernel_t kernel)
+{
+    float acc_f = 0.0f;
+    int32_t acc_i = 0;
+    for (uint32_t a = 0U; a < HOST_TRIG_BENCH_ANGLES; ++a) {
+        const uint16_t angle = (uint16_t)a;
+        const float radians = (float)a * (float)HOST_TRIG_BENCH_RAD_PER_COUNT;
+        switch (kernel) {
+            case HOST_TRIG_BENCH_LIBM_SINF:
+                acc_f += sinf(radians);
+                break;
+            case HOST_TRIG_BENCH_TRIG_SIN:
+                acc_f += trig_sin(angle);
+                break;
+            case HOST_TRIG_BENCH_TRIG_SIN_Q15:
+                acc_i += trig_sin_q15(angle);
+                break;
+            case HOST_TRIG_BENCH_LIBM_SINCOSF:
+                acc_f += sinf(radians) + cosf(radians);
+                break;
+            case HOST_TRIG_BENCH_TRIG_SINCOS: {
+                float s;
+                float c;
+                trig_sincos(angle, &s, &c);
+                acc_f += s + c;
+                break;
+            }
+            case HOST_TRIG_BENCH_CORDIC_SINCOS: {
+                int16_t s;
+                int16_t c;
+                trig_cordic_sincos_q15(angle, &s, &c);
+                acc_i += s + c;
+                break;
+            }
+            case HOST_TRIG_BENCH_LIBM_ATAN2F:
+                acc_f += atan2f(bench_y[a], bench_x[a]);
+                break;
+            case HOST_TRIG_BENCH_TRIG_ATAN2:
+                acc_i += trig_atan2(bench_y[a], bench_x[a]);
+                break;
+            case HOST_TRIG_BENCH_CORDIC_ATAN2:
+                acc_i += trig_cordic_atan2(bench_y_q15[a], bench_x_q15[a], NULL);
+                break;
+            case HOST_TRIG_BENCH_LIBM_SQRTF:
+                acc_f += sqrtf(radians);
+                break;
+            case HOST_TRIG_BENCH_TRIG_SQRT:
+                acc_f += trig_sqrt(radians);
+                break;
+            case HOST_TRIG_BENCH_SQRT_U32:
+                acc_i += trig_sqrt_u32(a * 65521U);
+                break;
+            default:
+                break;
+        }
+    }
+    bench_sink_f = acc_f;
+    bench_sink_i = acc_i;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint32_t host_trig_bench_run(uint32_t passes)
+{
+    if (passes == 0U) {
+        passes = 1U;
+    }
+
+    printf("trig-bench: accuracy, exhaustive over all %u angles\n", (unsigned)HOST_TRIG_BENCH_ANGLES);
+    const uint32_t failures = _host_trig_bench_check_accuracy();
+
+    for (uint32_t a = 0U; a < HOST_TRIG_BENCH_ANGLES; ++a) {
+        const double theta = (double)a * HOST_TRIG_BENCH_RAD_PER_COUNT;
+        bench_x[a] = (float)(10.0 * cos(theta));
+        bench_y[a] = (float)(10.0 * sin(theta));
+        bench_x_q15[a] = (int16_t)lround(30000.0 * cos(theta));
+        bench_y_q15[a] = (int16_t)lround(30000.0 * sin(theta));
+    }
+
+    printf("trig-bench: time per call, %u passes over all angles\n", (unsigned)passes);
+    for (int k = 0; k < HOST_TRIG_BENCH_NUM_KERNELS; ++k) {
+        /* One untimed pass to warm the caches and branch predictors */
+        _host_trig_bench_run_kernel((HostTrigBenchKernel_t)k);
+        const uint64_t start_ns = _host_trig_bench_now_ns();
+        for (uint32_t p = 0U; p < passes; ++p) {
+            _host_trig_bench_run_kernel((HostTrigBenchKernel_t)k);
+        }
+        const uint64_t elapsed_ns = _host_trig_bench_now_ns() - start_ns;
+        printf("  %-20s %6.2f ns\n", kernel_names[k],
+               (double)elapsed_ns / ((double)passes * (double)HOST_TRIG_BENCH_ANGLES));
+    }
+    return failures;
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************************************************************
+ * @file   input.c
+ *
+ * @brief  Source file for the throttle input module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "host_state.h"
+
+/* Intra-component Headers */
+#include "input.h"
+
+/*******************************************************************************************************************************
+ * Private Variables
+ *******************************************************************************************************************************/
+
+static HalInputDecoder_t input_decoder;
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void hal_input_init(HalInputProtocol_t protocol) {
+    /* Capture starts with the pin idle low, so the next edge captured is rising. The pin has been low since the
+     * last edge captured, or since the capture timer started at 0 */
+    const uint32_t count = hal_host_state.input_edge_count;
+    const uint32_t idle_ticks =
+        (count > 0U) ? hal_host_state.input_edge_ticks[(count - 1U) % HAL_INPUT_CAPTURE_SIZE] : 0U;
+    hal_input_decoder_init(&input_decoder, protocol, count, idle_ticks);
+}
+
+uint32_t hal_input_update(HalInputFrame_t *frame) {
+    return hal_input_decode(&input_decoder, hal_host_state.input_edge_ticks, hal_host_state.input_edge_count, frame);
+}
+
+HalInputStats_t hal_input_get_stats(void) {
+    return input_decoder.stats;
+}
@@ -9,6 +9,7 @@
 
 /* Standard library Headers */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* Inter-component Headers */
@@ -17,6 +18,7 @@
 #include "motor.h"
 
 /* Intra-component Headers */
+#include "host_pwm.h"
 #include "host_state.h"
 #include "pwm.h"
 
@@ -25,40 +27,146 @@
  *******************************************************************************************************************************/
 
 
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static void _hal_pwm_float_all(HalHostMotorState_t *state) {
+    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+        state->phase_switching[i].mode = HAL_HOST_PHASE_FLOATING;
+        state->phase_switching[i].high_on_fraction = 0.0f;
+        state->phase_switching[i].low_on_fraction = 0.0f;
+    }
+}
+
+static void _hal_pwm_write_hook(const HalHostMotorState_t *state) {
+    if (state->pwm_write_hook != NULL) {
+        state->pwm_write_hook();
+    }
+}
+
+static void _hal_pwm_load_phase_switching(HalHostMotorState_t *state, const EscInverterCmd_t *cmd) {
+    _hal_pwm_float_all(state);
+    if (!cmd->enable) {
+        return;
+    }
+
+    /* Dead time delays each complementary turn-on, leaving both switches off (diode conducting) */
+    const float dead_fraction = (float)cmd->dead_time_ns * 1e-9f * (float)HAL_PWM_FREQUENCY_HZ;
+
+    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+        const bool high = (cmd->high_enable_mask & ESC_PHASE_MASK(i)) != 0U;
+        const bool low = (cmd->low_enable_mask & ESC_PHASE_MASK(i)) != 0U;
+        HalHostPhaseSwitching_t *leg = &state->phase_switching[i];
+
+        float duty = cmd->phase_duty[i];
+        if (duty < 0.0f) {
+            duty = 0.0f;
+        }
+        if (duty > 1.0f) {
+            duty = 1.0f;
+        }
+
+        if (high && low) {
+            leg->mode = HAL_HOST_PHASE_COMPLEMENTARY;
+            /* A leg parked at 0% or 100% never transitions, so no dead time is inserted */
+            leg->high_on_fraction = (duty >= 1.0f) ? 1.0f : ((duty > dead_fraction) ? duty - dead_fraction : 0.0f);
+            leg->low_on_fraction = (duty <= 0.0f) ? 1.0f : ((1.0f - duty > dead_fraction) ? 1.0f - duty - dead_fraction : 0.0f);
+        } else if (high) {
+            leg->mode = HAL_HOST_PHASE_HIGH_PWM;
+            leg->high_on_fraction = duty;
+        } else if (low) {
+            leg->mode = HAL_HOST_PHASE_LOW_ON;
+            leg->low_on_fraction = 1.0f;
+        }
+    }
+}
+
 /*******************************************************************************************************************************
  * Function Definitions
  *******************************************************************************************************************************/
 
 void hal_pwm_init(void) {
-    /* Captured PWM output disabled on default */
-    hal_host_state.pwm_outputs_enabled = 0;
+    for (int m = 0; m < NUM_HAL_MOTORS; m++) {
+        HalHostMotorState_t *state = &hal_host_state.motors[m];
 
-    /* Inverter disabled on default */
-    hal_host_state.inverter_cmd.enable = 0;
-    hal_host_state.inverter_cmd.duty = 0.0f;
-    hal_host_state.inverter_cmd.commutation_step = 0;
+        /* Captured PWM output disabled on default */
+        state->pwm_outputs_enabled = 0;
 
-    /* No command sent on default */
-    hal_host_state.inverter_cmd_valid = 0;
+        /* Inverter disabled on default */
+        for (uint8_t i = 0U; i < HAL_HOST_PWM_NUM_BUFFERS; i++) {
+            state->inverter_cmd_buffer[i] = (EscInverterCmd_t){ 0 };
+        }
+        state->inverter_cmd_active = 0U;
+
+        /* No command sent on default */
+        state->inverter_cmd_pending = 0;
+        state->inverter_cmd_valid = 0;
+        _hal_pwm_float_all(state);
+    }
 }
 
-void hal_pwm_apply_inverter_cmd(const EscInverterCmd_t *cmd) {
+void hal_pwm_apply_inverter_cmd(HalMotor_t motor, const EscInverterCmd_t *cmd) {
+    HalHostMotorState_t *state = &hal_host_state.motors[motor];
+
     /* Enable outputs */
-    hal_host_state.pwm_outputs_enabled = 1;
+    state->pwm_outputs_enabled = 1;
 
-    /* Copy cmd commands to hal host state */
-    hal_host_state.inverter_cmd.enable = cmd->enable;
-    hal_host_state.inverter_cmd.duty = cmd->duty;
-    hal_host_state.inverter_cmd.commutation_step = cmd->commutation_step;
+    /* Withdraw a command that was never latched before its buffer is overwritten */
+    state->inverter_cmd_pending = 0;
 
-    /* Command written */
-    hal_host_state.inverter_cmd_valid = 1;
+    /* Write the shadow buffer register by register, as the timer peripheral would be written */
+    EscInverterCmd_t *shadow = &state->inverter_cmd_buffer[state->inverter_cmd_active ^ 1U];
+    shadow->enable = cmd->enable;
+    _hal_pwm_write_hook(state);
+    shadow->duty = cmd->duty;
+    _hal_pwm_write_hook(state);
+    shadow->commutation_step = cmd->commutation_step;
+    _hal_pwm_write_hook(state);
+    shadow->brake = cmd->brake;
+    _hal_pwm_write_hook(state);
+    for (int i = 0; i < NUM_MOTOR_PHASES; i++) {
+        shadow->phase_duty[i] = cmd->phase_duty[i];
+        _hal_pwm_write_hook(state);
+    }
+    shadow->high_enable_mask = cmd->high_enable_mask;
+    _hal_pwm_write_hook(state);
+    shadow->low_enable_mask = cmd->low_enable_mask;
+    _hal_pwm_write_hook(state);
+    shadow->dead_time_ns = cmd->dead_time_ns;
+    _hal_pwm_write_hook(state);
+    shadow->center_aligned = cmd->center_aligned;
+    _hal_pwm_write_hook(state);
+
+    /* Command complete, latched as a whole at the next update event */
+    state->inverter_cmd_pending = 1;
+}
+
+void hal_pwm_disable_outputs(HalMotor_t motor) {
+    HalHostMotorState_t *state = &hal_host_state.motors[motor];
+    state->pwm_outputs_enabled = 0;
+    state->inverter_cmd_pending = 0;
+    _hal_pwm_float_all(state);
 }
 
-void hal_pwm_disable_outputs(void) {
-    hal_host_state.pwm_outputs_enabled = 0;
+void hal_host_pwm_update_event(HalMotor_t motor) {
+    HalHostMotorState_t *state = &hal_host_state.motors[motor];
+    state->pwm_update_count++;
+
+    /* Single index flip: the latched command is always a completely written buffer */
+    if (state->inverter_cmd_pending) {
+        state->inverter_cmd_active ^= 1U;
+        state->inverter_cmd_pending = 0;
+        state->inverter_cmd_valid = 1;
+    }
+
+    if (!state->pwm_outputs_enabled || !state->inverter_cmd_valid) {
+        _hal_pwm_float_all(state);
+        return;
+    }
+    _hal_pwm_load_phase_switching(state, &state->inverter_cmd_buffer[state->inverter_cmd_active]);
 }
 
-bool hal_pwm_outputs_enabled(void) {
-    return hal_host_state.pwm_outputs_enabled;
+bool hal_pwm_outputs_enabled(HalMotor_t motor) {
+    return hal_host_state.motors[motor].pwm_outputs_enabled;
 }
\ No newline at end of file
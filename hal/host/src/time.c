@@ -9,12 +9,13 @@
 
 /* Standard library Headers */
 #include <stdint.h>
+#include <time.h>
 
 /* Inter-component Headers */
 #include "host_state.h"
 
 /* Intra-component Headers */
-#include "time.h"
+#include "hal_time.h"
 
 /*******************************************************************************************************************************
  * Private Variables
@@ -25,19 +26,34 @@
  *******************************************************************************************************************************/
 
 void hal_time_init(void) {
-    hal_host_state.time_us = 0U;
+    hal_host_state.time_ticks = 0U;
+}
+
+uint64_t hal_time_get_ticks(void) {
+    return hal_host_state.time_ticks;
 }
 
 uint32_t hal_time_get_ms(void) {
     /* Grabbing milliseconds */
-    return hal_host_state.time_us / 1000;
+    return (uint32_t)(hal_host_state.time_ticks / HAL_TIME_TICKS_PER_MS);
 }
 
 uint32_t hal_time_get_us(void) {
     /* Grabbing microseconds */
-    return hal_host_state.time_us;
+    return (uint32_t)hal_time_ticks_to_us(hal_host_state.time_ticks);
+}
+
+uint64_t hal_time_get_us64(void) {
+    return hal_time_ticks_to_us(hal_host_state.time_ticks);
+}
+
+uint32_t hal_time_get_cycles(void) {
+    /* Wall-clock nanoseconds, truncated */
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
 }
 
 void hal_time_delay_ms(uint32_t delay_ms) {
-    hal_host_state.time_us += delay_ms * 1000;
+    hal_host_state.time_ticks += (uint64_t)delay_ms * HAL_TIME_TICKS_PER_MS;
 }
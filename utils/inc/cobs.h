@@ -0,0 +1,86 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   cobs.h
+ *
+ * @brief  Header file for the COBS framing module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Cobs COBS framing module
+ * @brief    Consistent Overhead Byte Stuffing: frames without zero bytes, delimited by a zero
+ * @details  The encoder is incremental so a frame can be assembled straight from its sources into the output buffer:
+ *           each block's code byte is reserved when the block opens and written when it closes. The decoder works in
+ *           place, as decoded data is never longer than the encoding it comes from.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define COBS_DELIMITER 0x00U
+#define COBS_MAX_BLOCK 254U /* Data bytes in a block without a zero */
+#define COBS_MAX_ENCODED_SIZE(len) ((len) + (len) / COBS_MAX_BLOCK + 2U) /* Encoded length with the delimiter */
+
+/**
+ * @brief   Incremental COBS encoder
+ */
+typedef struct {
+    uint8_t *out;      /**< Output buffer */
+    size_t size;       /**< Output buffer size */
+    size_t len;        /**< Bytes used, including the open block's code byte */
+    size_t code_pos;   /**< Position of the open block's code byte */
+    uint8_t code;      /**< Open block's code: its data bytes plus one */
+    bool overflow;     /**< Output buffer too small; the frame is abandoned */
+} CobsEncoder_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Start a frame
+ * @param   enc Encoder
+ * @param   out Output buffer
+ * @param   size Output buffer size, COBS_MAX_ENCODED_SIZE() of the data is always enough
+ */
+void cobs_encoder_begin(CobsEncoder_t *enc, uint8_t *out, size_t size);
+
+/**
+ * @brief   Append data to the frame
+ * @param   enc Encoder
+ * @param   data Data
+ * @param   len Length of data in bytes
+ */
+void cobs_encoder_write(CobsEncoder_t *enc, const void *data, size_t len);
+
+/**
+ * @brief   Close the frame and append the delimiter
+ * @param   enc Encoder
+ * @return  Encoded length including the delimiter, 0 if the output buffer overflowed
+ */
+size_t cobs_encoder_end(CobsEncoder_t *enc);
+
+/**
+ * @brief   Decode one frame in place
+ * @param   buf Encoded frame without its delimiter, overwritten with the decoded data
+ * @param   len Encoded length
+ * @param   decoded_len Output decoded length
+ * @return  true if the encoding is well formed
+ */
+bool cobs_decode(uint8_t *buf, size_t len, size_t *decoded_len);
+
+/** @} */
@@ -0,0 +1,47 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   crc.h
+ *
+ * @brief  Header file for the CRC module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Crc CRC module
+ * @brief    CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF, no reflection, no final XOR)
+ * @details  Computed a byte at a time without a table. Appending the CRC most significant byte first makes
+ *           the CRC of the data and CRC together zero.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define CRC16_INIT 0xFFFFU /* Initial value, the CRC of no data */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Continue a CRC over more data
+ * @param   crc CRC so far, CRC16_INIT to start
+ * @param   data Data
+ * @param   len Length of data in bytes
+ * @return  CRC including data
+ */
+uint16_t crc16_update(uint16_t crc, const void *data, size_t len);
+
+/** @} */
@@ -0,0 +1,71 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   histogram.h
+ *
+ * @brief  Header file for the log-linear histogram module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Histogram Log-linear histogram module
+ * @brief    HDR-style histogram of 32-bit values with constant relative precision and O(1) recording
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define HISTOGRAM_SUB_BUCKET_BITS 4U /* 16 linear sub-buckets per power of two, values within 1/16 (6.25%) */
+#define HISTOGRAM_SUB_BUCKETS (1U << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_NUM_BUCKETS ((32U - HISTOGRAM_SUB_BUCKET_BITS + 1U) * HISTOGRAM_SUB_BUCKETS)
+
+/**
+ * @brief   Histogram class
+ * @details Values below HISTOGRAM_SUB_BUCKETS are counted exactly; above that, each power of two is split into
+ *          HISTOGRAM_SUB_BUCKETS equal buckets.
+ */
+typedef struct {
+    uint64_t counts[HISTOGRAM_NUM_BUCKETS]; /**< Count per bucket */
+    uint64_t total;                         /**< Number of recorded values */
+    uint32_t min;                           /**< Smallest recorded value */
+    uint32_t max;                           /**< Largest recorded value */
+} Histogram_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Clear all recorded values
+ * @param   hist Histogram instance
+ */
+void histogram_reset(Histogram_t *hist);
+
+/**
+ * @brief   Record one value
+ * @param   hist Histogram instance
+ * @param   value Value to record
+ */
+void histogram_record(Histogram_t *hist, uint32_t value);
+
+/**
+ * @brief   Value at or below which the given percentage of recorded values fall
+ * @param   hist Histogram instance
+ * @param   percentile Percentile in [0, 100]
+ * @return  Highest value equivalent to the bucket holding the percentile (capped at max), 0 if empty
+ */
+uint32_t histogram_percentile(const Histogram_t *hist, float percentile);
+
+/** @} */
@@ -0,0 +1,75 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   pid.h
+ *
+ * @brief  Header file for the PID controller module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Pid PID controller module
+ * @brief    Discrete PID controller with output clamping and integrator anti-windup
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   PID controller class
+ */
+typedef struct {
+    float kp;          /**< Proportional gain */
+    float ki;          /**< Integral gain (per second) */
+    float kd;          /**< Derivative gain (seconds) */
+    float out_min;     /**< Lower output (and integrator) bound */
+    float out_max;     /**< Upper output (and integrator) bound */
+
+    float integrator;  /**< Integral term state */
+    float prev_error;  /**< Error from the previous update */
+} Pid_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initialize a PID controller
+ * @param   pid PID instance
+ * @param   kp Proportional gain
+ * @param   ki Integral gain (per second)
+ * @param   kd Derivative gain (seconds)
+ * @param   out_min Lower output bound
+ * @param   out_max Upper output bound
+ */
+void pid_init(Pid_t *pid, float kp, float ki, float kd, float out_min, float out_max);
+
+/**
+ * @brief   Reset the controller state, preloading the integrator
+ * @param   pid PID instance
+ * @param   integrator Initial integrator value (clamped to the output bounds)
+ */
+void pid_reset(Pid_t *pid, float integrator);
+
+/**
+ * @brief   Run one controller update
+ * @param   pid PID instance
+ * @param   error Reference minus measurement
+ * @param   dt_s Time since last update in seconds
+ * @return  Controller output clamped to [out_min, out_max]
+ */
+float pid_update(Pid_t *pid, float error, float dt_s);
+
+/** @} */
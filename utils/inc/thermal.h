@@ -0,0 +1,83 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   thermal.h
+ *
+ * @brief  Header file for the lumped thermal model module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Thermal Lumped thermal model module
+ * @brief    First-order thermal node (one heat capacity behind one thermal resistance) and current derating helpers
+ * @details  A node tracks its temperature rise above whatever it is referenced to: C * d(rise)/dt = P - rise / R.
+ *           The update is the exact solution for power held constant over the step, so it stays stable for steps
+ *           of any length relative to the R * C time constant.
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define THERMAL_COPPER_TEMPCO_PER_K 0.00393f /* Copper resistance temperature coefficient */
+#define THERMAL_COPPER_REFERENCE_C 25.0f     /* Temperature the copper resistance is specified at */
+
+/**
+ * @brief   Thermal node class
+ */
+typedef struct {
+    float r_th_K_per_W;   /**< Thermal resistance to the reference */
+    float c_th_J_per_K;   /**< Heat capacity */
+    float rise_K;         /**< Temperature rise above the reference */
+} ThermalNode_t;
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Initialize a thermal node at zero rise
+ * @param   node Thermal node instance
+ * @param   r_th_K_per_W Thermal resistance to the reference
+ * @param   c_th_J_per_K Heat capacity
+ */
+void thermal_node_init(ThermalNode_t *node, float r_th_K_per_W, float c_th_J_per_K);
+
+/**
+ * @brief   Advance a thermal node
+ * @param   node Thermal node instance
+ * @param   power_W Power dissipated in the node, taken as constant over the step
+ * @param   dt_s Step length
+ * @return  Temperature rise above the reference
+ */
+float thermal_node_update(ThermalNode_t *node, float power_W, float dt_s);
+
+/**
+ * @brief   Copper winding resistance at a temperature
+ * @param   resistance_Ohm Resistance at THERMAL_COPPER_REFERENCE_C
+ * @param   temp_C Winding temperature
+ * @return  Resistance at temp_C
+ */
+float thermal_copper_resistance(float resistance_Ohm, float temp_C);
+
+/**
+ * @brief   Current derating factor ahead of a temperature limit
+ * @param   temp_C Present temperature
+ * @param   limit_C Temperature at which the factor reaches zero
+ * @param   band_C Band below limit_C over which the factor falls linearly from one
+ * @return  Factor in [0, 1]
+ */
+float thermal_derate(float temp_C, float limit_C, float band_C);
+
+/** @} */
@@ -0,0 +1,135 @@
+#pragma once
+
+/*******************************************************************************************************************************
+ * @file   trig.h
+ *
+ * @brief  Header file for the fast trigonometry module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup Trig Fast trigonometry module
+ * @brief    Table, polynomial and CORDIC replacements for the libm calls on the control path
+ * @details  Angles are 16-bit, with TRIG_ANGLE_COUNTS counts per revolution, so they wrap for free. The lookup tables
+ *           are generated at build time (utils/tools/trig_tables_gen.c) and live in flash; nothing is computed at
+ *           boot. Worst-case errors, checked exhaustively over all angles by the host `trig-bench`:
+ *           - trig_sin/trig_cos/trig_sincos: 2.0e-5
+ *           - trig_sin_q15/trig_cos_q15: 2 LSB (6.1e-5)
+ *           - trig_cordic_sincos_q15: 2 LSB (6.1e-5)
+ *           - trig_atan2: 1 count (9.6e-5 rad); trig_cordic_atan2: 1 count, magnitude 1 LSB + 0.01%
+ *           - trig_sqrt/trig_rsqrt: 5e-6 relative; trig_sqrt_u32: exact (floor)
+ * @{
+ */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define TRIG_ANGLE_COUNTS 65536.0f                                  /* Angle counts per revolution */
+#define TRIG_ANGLE_COUNTS_PER_RAD (TRIG_ANGLE_COUNTS / 6.28318530718f)
+#define TRIG_ANGLE_QUARTER_TURN ((uint16_t)0x4000U)
+#define TRIG_ANGLE_HALF_TURN ((uint16_t)0x8000U)
+#define TRIG_ANGLE_THIRD_TURN ((uint16_t)21845U)
+#define TRIG_Q15_ONE 32767                                          /* Largest Q15 value, standing in for 1.0 */
+
+#define TRIG_TABLE_BITS 9U                                          /* 512 sine entries per revolution */
+#define TRIG_TABLE_SIZE (1U << TRIG_TABLE_BITS)
+#define TRIG_CORDIC_ITERATIONS 16U                                  /* Last step atan(2^-15) is 0.3 counts */
+
+/*******************************************************************************************************************************
+ * Function declarations
+ *******************************************************************************************************************************/
+
+/**
+ * @brief   Sine of an angle, linearly interpolated from the table
+ * @param   angle Angle in counts
+ * @return  Sine [-1.0, 1.0]
+ */
+float trig_sin(uint16_t angle);
+
+/**
+ * @brief   Cosine of an angle, linearly interpolated from the table
+ * @param   angle Angle in counts
+ * @return  Cosine [-1.0, 1.0]
+ */
+float trig_cos(uint16_t angle);
+
+/**
+ * @brief   Sine and cosine of one angle
+ * @param   angle Angle in counts
+ * @param   sin_out Output sine
+ * @param   cos_out Output cosine
+ */
+void trig_sincos(uint16_t angle, float *sin_out, float *cos_out);
+
+/**
+ * @brief   Angle of a vector, from an odd polynomial for the arctangent over one octant
+ * @param   y Vertical component
+ * @param   x Horizontal component
+ * @return  Angle in counts, 0 for a zero vector
+ */
+uint16_t trig_atan2(float y, float x);
+
+/**
+ * @brief   Reciprocal square root: bit-level first guess and two Newton steps, for cores without a hardware square
+ *          root (the Cortex-M4F VSQRT is faster still)
+ * @param   x Value, greater than 0
+ * @return  1 / sqrt(x)
+ */
+float trig_rsqrt(float x);
+
+/**
+ * @brief   Square root through trig_rsqrt()
+ * @param   x Value
+ * @return  sqrt(x), 0 for x <= 0
+ */
+float trig_sqrt(float x);
+
+/**
+ * @brief   Q15 sine of an angle, linearly interpolated from the table
+ * @param   angle Angle in counts
+ * @return  Sine in Q15
+ */
+int16_t trig_sin_q15(uint16_t angle);
+
+/**
+ * @brief   Q15 cosine of an angle, linearly interpolated from the table
+ * @param   angle Angle in counts
+ * @return  Cosine in Q15
+ */
+int16_t trig_cos_q15(uint16_t angle);
+
+/**
+ * @brief   Q15 sine and cosine of an angle by CORDIC rotation, integer shifts and adds only
+ * @param   angle Angle in counts
+ * @param   sin_out Output sine in Q15
+ * @param   cos_out Output cosine in Q15
+ */
+void trig_cordic_sincos_q15(uint16_t angle, int16_t *sin_out, int16_t *cos_out);
+
+/**
+ * @brief   Angle and length of an integer vector by CORDIC vectoring, integer shifts and adds only
+ * @param   y Vertical component
+ * @param   x Horizontal component
+ * @param   magnitude Output vector length in the units of the inputs, may be NULL
+ * @return  Angle in counts, 0 for a zero vector
+ */
+uint16_t trig_cordic_atan2(int16_t y, int16_t x, uint16_t *magnitude);
+
+/**
+ * @brief   Integer square root, bit by bit
+ * @param   x Value
+ * @return  floor(sqrt(x))
+ */
+uint16_t trig_sqrt_u32(uint32_t x);
+
+/** @} */
@@ -0,0 +1,94 @@
+/*******************************************************************************************************************************
+ * @file   cobs.c
+ *
+ * @brief  Source file for the COBS framing module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "cobs.h"
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void cobs_encoder_begin(CobsEncoder_t *enc, uint8_t *out, size_t size)
+{
+    enc->out = out;
+    enc->size = size;
+    enc->len = 1U;
+    enc->code_pos = 0U;
+    enc->code = 1U;
+    enc->overflow = (out == NULL || size < 2U);
+}
+
+void cobs_encoder_write(CobsEncoder_t *enc, const void *data, size_t len)
+{
+    if (enc->overflow) {
+        return;
+    }
+
+    /* Work on locals: stores through the byte pointer would otherwise make the compiler reload the encoder */
+    const uint8_t *src = (const uint8_t *)data;
+    uint8_t *out = enc->out;
+    size_t pos = enc->len;
+    size_t code_pos = enc->code_pos;
+    uint8_t code = enc->code;
+    for (size_t i = 0U; i < len; ++i) {
+        /* Each byte either fills the next position or closes the block, whose successor's code takes it */
+        if (pos >= enc->size) {
+            enc->overflow = true;
+            return;
+        }
+        if (src[i] != COBS_DELIMITER) {
+            out[pos++] = src[i];
+            if (++code != COBS_MAX_BLOCK + 1U) {
+                continue;
+            }
+        }
+        out[code_pos] = code;
+        code_pos = pos++;
+        code = 1U;
+    }
+    enc->len = pos;
+    enc->code_pos = code_pos;
+    enc->code = code;
+}
+
+size_t cobs_encoder_end(CobsEncoder_t *enc)
+{
+    if (enc->overflow || enc->len + 1U > enc->size) {
+        enc->overflow = true;
+        return 0U;
+    }
+    enc->out[enc->code_pos] = enc->code;
+    enc->out[enc->len++] = COBS_DELIMITER;
+    return enc->len;
+}
+
+bool cobs_decode(uint8_t *buf, size_t len, size_t *decoded_len)
+{
+    size_t read = 0U;
+    size_t write = 0U;
+    while (read < len) {
+        const size_t code = buf[read++];
+        if (code == COBS_DELIMITER || read + code - 1U > len) {
+            return false;
+        }
+        for (size_t i = 1U; i < code; ++i) {
+            buf[write++] = buf[read++];
+        }
+        /* Every block but a full one ends in a zero, except at the end of the frame */
+        if (code != COBS_MAX_BLOCK + 1U && read < len) {
+            buf[write++] = COBS_DELIMITER;
+        }
+    }
+    *decoded_len = write;
+    return true;
+}
@@ -0,0 +1,31 @@
+/*******************************************************************************************************************************
+ * @file   crc.c
+ *
+ * @brief  Source file for the CRC module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "crc.h"
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+uint16_t crc16_update(uint16_t crc, const void *data, size_t len)
+{
+    /* A byte at a time without a table: the polynomial's taps at bits 12, 5 and 0 become three shifted XORs */
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0U; i < len; ++i) {
+        uint16_t x = (uint16_t)((crc >> 8) ^ bytes[i]);
+        x ^= (uint16_t)(x >> 4);
+        crc = (uint16_t)((crc << 8) ^ (x << 12) ^ (x << 5) ^ x);
+    }
+    return crc;
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************************************************************
+ * @file   histogram.c
+ *
+ * @brief  Source file for the log-linear histogram module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "histogram.h"
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static uint32_t _histogram_bucket_index(uint32_t value)
+{
+    if (value < HISTOGRAM_SUB_BUCKETS) {
+        return value;
+    }
+
+    /* Shift so the value keeps HISTOGRAM_SUB_BUCKET_BITS + 1 significant bits */
+    const uint32_t msb = 31U - (uint32_t)__builtin_clz(value);
+    const uint32_t shift = msb - HISTOGRAM_SUB_BUCKET_BITS;
+    return shift * HISTOGRAM_SUB_BUCKETS + (value >> shift);
+}
+
+static uint32_t _histogram_bucket_highest(uint32_t index)
+{
+    if (index < 2U * HISTOGRAM_SUB_BUCKETS) {
+        return index;
+    }
+
+    const uint32_t shift = index / HISTOGRAM_SUB_BUCKETS - 1U;
+    const uint64_t mantissa = (uint64_t)(index % HISTOGRAM_SUB_BUCKETS + HISTOGRAM_SUB_BUCKETS);
+    return (uint32_t)(((mantissa + 1U) << shift) - 1U);
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void histogram_reset(Histogram_t *hist)
+{
+    if (hist == NULL) {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < HISTOGRAM_NUM_BUCKETS; ++i) {
+        hist->counts[i] = 0U;
+    }
+    hist->total = 0U;
+    hist->min = UINT32_MAX;
+    hist->max = 0U;
+}
+
+void histogram_record(Histogram_t *hist, uint32_t value)
+{
+    if (hist == NULL) {
+        return;
+    }
+
+    hist->counts[_histogram_bucket_index(value)]++;
+    hist->total++;
+    if (value < hist->min) {
+        hist->min = value;
+    }
+    if (value > hist->max) {
+        hist->max = value;
+    }
+}
+
+uint32_t histogram_percentile(const Histogram_t *hist, float percentile)
+{
+    if (hist == NULL || hist->total == 0U) {
+        return 0U;
+    }
+
+    if (percentile < 0.0f) {
+        percentile = 0.0f;
+    } else if (percentile > 100.0f) {
+        percentile = 100.0f;
+    }
+
+    uint64_t target = (uint64_t)((double)percentile / 100.0 * (double)hist->total + 0.5);
+    if (target == 0U) {
+        target = 1U;
+    }
+
+    uint64_t seen = 0U;
+    for (uint32_t i = 0U; i < HISTOGRAM_NUM_BUCKETS; ++i) {
+        seen += hist->counts[i];
+        if (seen >= target) {
+            const uint32_t highest = _histogram_bucket_highest(i);
+            return (highest < hist->max) ? highest : hist->max;
+        }
+    }
+    return hist->max;
+}
@@ -0,0 +1,77 @@
+/*******************************************************************************************************************************
+ * @file   pid.c
+ *
+ * @brief  Source file for the PID controller module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stddef.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "pid.h"
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+static float _pid_clamp(const Pid_t *pid, float value)
+{
+    if (value > pid->out_max) {
+        return pid->out_max;
+    }
+    if (value < pid->out_min) {
+        return pid->out_min;
+    }
+    return value;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void pid_init(Pid_t *pid, float kp, float ki, float kd, float out_min, float out_max)
+{
+    if (pid == NULL) {
+        return;
+    }
+
+    pid->kp = kp;
+    pid->ki = ki;
+    pid->kd = kd;
+    pid->out_min = out_min;
+    pid->out_max = out_max;
+    pid_reset(pid, 0.0f);
+}
+
+void pid_reset(Pid_t *pid, float integrator)
+{
+    if (pid == NULL) {
+        return;
+    }
+
+    pid->integrator = _pid_clamp(pid, integrator);
+    pid->prev_error = 0.0f;
+}
+
+float pid_update(Pid_t *pid, float error, float dt_s)
+{
+    if (pid == NULL) {
+        return 0.0f;
+    }
+
+    /* Clamp the integrator itself so it cannot wind up past the output range */
+    pid->integrator = _pid_clamp(pid, pid->integrator + pid->ki * error * dt_s);
+
+    float derivative = 0.0f;
+    if (dt_s > 0.0f) {
+        derivative = pid->kd * (error - pid->prev_error) / dt_s;
+    }
+    pid->prev_error = error;
+
+    return _pid_clamp(pid, pid->kp * error + pid->integrator + derivative);
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************************************************************
+ * @file   thermal.c
+ *
+ * @brief  Source file for the lumped thermal model module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "thermal.h"
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+void thermal_node_init(ThermalNode_t *node, float r_th_K_per_W, float c_th_J_per_K)
+{
+    if (node == NULL) {
+        return;
+    }
+
+    node->r_th_K_per_W = r_th_K_per_W;
+    node->c_th_J_per_K = c_th_J_per_K;
+    node->rise_K = 0.0f;
+}
+
+float thermal_node_update(ThermalNode_t *node, float power_W, float dt_s)
+{
+    if (node == NULL) {
+        return 0.0f;
+    }
+
+    const float tau_s = node->r_th_K_per_W * node->c_th_J_per_K;
+    if (tau_s <= 0.0f) {
+        return node->rise_K;
+    }
+
+    /* Relax towards the steady-state rise P * R */
+    const float steady_K = power_W * node->r_th_K_per_W;
+    node->rise_K = steady_K + (node->rise_K - steady_K) * expf(-dt_s / tau_s);
+    return node->rise_K;
+}
+
+float thermal_copper_resistance(float resistance_Ohm, float temp_C)
+{
+    return resistance_Ohm * (1.0f + THERMAL_COPPER_TEMPCO_PER_K * (temp_C - THERMAL_COPPER_REFERENCE_C));
+}
+
+float thermal_derate(float temp_C, float limit_C, float band_C)
+{
+    if (band_C <= 0.0f) {
+        return (temp_C < limit_C) ? 1.0f : 0.0f;
+    }
+
+    const float factor = (limit_C - temp_C) / band_C;
+    if (factor > 1.0f) {
+        return 1.0f;
+    }
+    if (factor < 0.0f) {
+        return 0.0f;
+    }
+    return factor;
+}
@@ -0,0 +1,235 @@
+/*******************************************************************************************************************************
+ * @file   trig.c
+ *
+ * @brief  Source file for the fast trigonometry module
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "trig.h"
+#include "trig_tables.h"
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define TRIG_FRACTION_BITS (16U - TRIG_TABLE_BITS)
+#define TRIG_FRACTION_MASK ((1U << TRIG_FRACTION_BITS) - 1U)
+#define TRIG_CORDIC_QUARTER_TURN 0x40000000L  /* CORDIC angles have 2^32 counts per revolution */
+#define TRIG_CORDIC_HALF_TURN 0x80000000UL
+#define TRIG_CORDIC_INPUT_SHIFT 14U           /* Q15 inputs to Q29, leaving headroom for the CORDIC gain */
+#define TRIG_RSQRT_MAGIC 0x5F375A86UL         /* First guess for 1/sqrt from the float bit pattern */
+
+/* atan(z) on [0, 1], Abramowitz & Stegun 4.4.49, within 1e-5 rad */
+#define TRIG_ATAN_C1 0.9998660f
+#define TRIG_ATAN_C3 -0.3302995f
+#define TRIG_ATAN_C5 0.1801410f
+#define TRIG_ATAN_C7 -0.0851330f
+#define TRIG_ATAN_C9 0.0208351f
+
+/*******************************************************************************************************************************
+ * Private Function Definitions
+ *******************************************************************************************************************************/
+
+/* value when sign is 0, -value when sign is -1 */
+static inline int32_t _trig_negate_if(int32_t value, int32_t sign)
+{
+    return (value ^ sign) - sign;
+}
+
+static int16_t _trig_q30_to_q15(int32_t value)
+{
+    int32_t rounded = (value + (1L << 14)) >> 15;
+    if (rounded > TRIG_Q15_ONE) {
+        rounded = TRIG_Q15_ONE;
+    } else if (rounded < -TRIG_Q15_ONE) {
+        rounded = -TRIG_Q15_ONE;
+    }
+    return (int16_t)rounded;
+}
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+float trig_sin(uint16_t angle)
+{
+    const uint32_t index = (uint32_t)angle >> TRIG_FRACTION_BITS;
+    const float fraction = (float)(angle & TRIG_FRACTION_MASK) * (1.0f / (float)(1U << TRIG_FRACTION_BITS));
+    return trig_sin_table[index] + (trig_sin_table[index + 1U] - trig_sin_table[index]) * fraction;
+}
+
+float trig_cos(uint16_t angle)
+{
+    return trig_sin((uint16_t)(angle + TRIG_ANGLE_QUARTER_TURN));
+}
+
+void trig_sincos(uint16_t angle, float *sin_out, float *cos_out)
+{
+    if (sin_out == NULL || cos_out == NULL) {
+        return;
+    }
+
+    /* A quarter turn is a whole number of entries, so both share the index offset and fraction */
+    const uint32_t index = (uint32_t)angle >> TRIG_FRACTION_BITS;
+    const uint32_t cos_index = (index + TRIG_TABLE_SIZE / 4U) & (TRIG_TABLE_SIZE - 1U);
+    const float fraction = (float)(angle & TRIG_FRACTION_MASK) * (1.0f / (float)(1U << TRIG_FRACTION_BITS));
+    *sin_out = trig_sin_table[index] + (trig_sin_table[index + 1U] - trig_sin_table[index]) * fraction;
+    *cos_out = trig_sin_table[cos_index] + (trig_sin_table[cos_index + 1U] - trig_sin_table[cos_index]) * fraction;
+}
+
+uint16_t trig_atan2(float y, float x)
+{
+    const float ax = (x < 0.0f) ? -x : x;
+    const float ay = (y < 0.0f) ? -y : y;
+    if (ax == 0.0f && ay == 0.0f) {
+        return 0U;
+    }
+
+    /* Fold into the first octant, where the ratio is at most 1 */
+    const bool steep = ay > ax;
+    const float z = steep ? (ax / ay) : (ay / ax);
+    const float z2 = z * z;
+    float angle = z * (TRIG_ATAN_C1 +
+                       z2 * (TRIG_ATAN_C3 + z2 * (TRIG_ATAN_C5 + z2 * (TRIG_ATAN_C7 + z2 * TRIG_ATAN_C9))));
+    angle *= TRIG_ANGLE_COUNTS_PER_RAD;
+
+    if (steep) {
+        angle = (float)TRIG_ANGLE_QUARTER_TURN - angle;
+    }
+    if (x < 0.0f) {
+        angle = (float)TRIG_ANGLE_HALF_TURN - angle;
+    }
+    if (y < 0.0f) {
+        angle = -angle;
+    }
+    return (uint16_t)(int32_t)(angle + ((angle < 0.0f) ? -0.5f : 0.5f));
+}
+
+float trig_rsqrt(float x)
+{
+    union {
+        float f;
+        uint32_t u;
+    } bits = {x};
+    bits.u = TRIG_RSQRT_MAGIC - (bits.u >> 1);
+    float y = bits.f;
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y;
+}
+
+float trig_sqrt(float x)
+{
+    return (x > 0.0f) ? x * trig_rsqrt(x) : 0.0f;
+}
+
+int16_t trig_sin_q15(uint16_t angle)
+{
+    const uint32_t index = (uint32_t)angle >> TRIG_FRACTION_BITS;
+    const int32_t fraction = (int32_t)(angle & TRIG_FRACTION_MASK);
+    const int32_t start = trig_sin_q15_table[index];
+    const int32_t delta = (int32_t)trig_sin_q15_table[index + 1U] - start;
+    return (int16_t)(start + ((delta * fraction + (1L << (TRIG_FRACTION_BITS - 1U))) >> TRIG_FRACTION_BITS));
+}
+
+int16_t trig_cos_q15(uint16_t angle)
+{
+    return trig_sin_q15((uint16_t)(angle + TRIG_ANGLE_QUARTER_TURN));
+}
+
+void trig_cordic_sincos_q15(uint16_t angle, int16_t *sin_out, int16_t *cos_out)
+{
+    /* Rotation only converges within a quarter turn either way: rotate the rest by half a turn and negate */
+    uint32_t turn = (uint32_t)angle << 16;
+    bool negate = false;
+    if ((int32_t)turn > TRIG_CORDIC_QUARTER_TURN || (int32_t)turn < -TRIG_CORDIC_QUARTER_TURN) {
+        turn += TRIG_CORDIC_HALF_TURN;
+        negate = true;
+    }
+
+    int32_t z = (int32_t)turn;
+    int32_t x = TRIG_CORDIC_GAIN_Q30;
+    int32_t y = 0;
+    for (uint32_t i = 0U; i < TRIG_CORDIC_ITERATIONS; ++i) {
+        /* Turn towards the remaining angle, without branches: the direction is a coin toss for a branch predictor */
+        const int32_t sign = z >> 31;
+        const int32_t dx = _trig_negate_if(x >> i, sign);
+        const int32_t dy = _trig_negate_if(y >> i, sign);
+        x -= dy;
+        y += dx;
+        z -= _trig_negate_if(trig_cordic_atan_table[i], sign);
+    }
+
+    if (negate) {
+        x = -x;
+        y = -y;
+    }
+    if (sin_out != NULL) {
+        *sin_out = _trig_q30_to_q15(y);
+    }
+    if (cos_out != NULL) {
+        *cos_out = _trig_q30_to_q15(x);
+    }
+}
+
+uint16_t trig_cordic_atan2(int16_t y, int16_t x, uint16_t *magnitude)
+{
+    int32_t xs = (int32_t)x * (1L << TRIG_CORDIC_INPUT_SHIFT);
+    int32_t ys = (int32_t)y * (1L << TRIG_CORDIC_INPUT_SHIFT);
+    uint32_t z = 0U;
+
+    /* Vectoring only converges in the right half-plane */
+    if (xs < 0) {
+        xs = -xs;
+        ys = -ys;
+        z = TRIG_CORDIC_HALF_TURN;
+    }
+
+    /* Rotate onto the x axis, adding up the angle turned through */
+    for (uint32_t i = 0U; i < TRIG_CORDIC_ITERATIONS; ++i) {
+        const int32_t sign = ys >> 31;
+        const int32_t dx = _trig_negate_if(xs >> i, sign);
+        const int32_t dy = _trig_negate_if(ys >> i, sign);
+        xs += dy;
+        ys -= dx;
+        z += (uint32_t)_trig_negate_if(trig_cordic_atan_table[i], sign);
+    }
+
+    if (magnitude != NULL) {
+        /* Undo the CORDIC stretch, then the input scaling, rounding once */
+        const int64_t length = ((int64_t)xs * TRIG_CORDIC_GAIN_Q30) >> 30;
+        *magnitude = (uint16_t)((length + (1L << (TRIG_CORDIC_INPUT_SHIFT - 1U))) >> TRIG_CORDIC_INPUT_SHIFT);
+    }
+    if (x == 0 && y == 0) {
+        return 0U;
+    }
+    return (uint16_t)((z + (1UL << 15)) >> 16);
+}
+
+uint16_t trig_sqrt_u32(uint32_t x)
+{
+    if (x == 0U) {
+        return 0U;
+    }
+
+    /* Start from the highest even power of two not above x; each step decides one bit of the root, branch-free */
+    uint32_t root = 0U;
+    uint32_t bit = 1UL << ((31U - (uint32_t)__builtin_clz(x)) & ~1U);
+    while (bit != 0U) {
+        const uint32_t trial = root + bit;
+        const uint32_t take = 0U - (uint32_t)(x >= trial);
+        x -= trial & take;
+        root = (root >> 1) + (bit & take);
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
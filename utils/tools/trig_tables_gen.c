@@ -0,0 +1,87 @@
+/*******************************************************************************************************************************
+ * @file   trig_tables_gen.c
+ *
+ * @brief  Build-time generator for the fast trigonometry lookup tables
+ *
+ * @details Runs on the build host and writes trig_tables.h, which trig.c includes, so the tables are constant data in
+ *          flash and the firmware never links libm for them. The table sizes come from trig.h.
+ *
+ * @date   2026-10-19
+ * @author Leopoldo Mendoza
+ *******************************************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdio.h>
+
+/* Inter-component Headers */
+#include "trig.h"
+
+/* Intra-component Headers */
+
+/*******************************************************************************************************************************
+ * Private defines and enums
+ *******************************************************************************************************************************/
+
+#define TRIG_TABLES_GEN_PI 3.14159265358979323846
+#define TRIG_TABLES_GEN_PER_LINE 8U
+
+/*******************************************************************************************************************************
+ * Function Definitions
+ *******************************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s trig_tables.h\n", argv[0]);
+        return 1;
+    }
+    FILE *out = fopen(argv[1], "w");
+    if (out == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(out, "/* Generated by trig_tables_gen from trig.h, do not edit */\n\n");
+
+    /* One sine period with the first entry repeated at the end, so interpolation never wraps */
+    fprintf(out, "static const float trig_sin_table[TRIG_TABLE_SIZE + 1U] = {");
+    for (unsigned i = 0U; i <= TRIG_TABLE_SIZE; ++i) {
+        double value = sin(2.0 * TRIG_TABLES_GEN_PI * (double)i / (double)TRIG_TABLE_SIZE);
+        if (fabs(value) < 1e-12) {
+            value = 0.0; /* Exact zeros at the half turns, not the rounding residue of pi */
+        }
+        fprintf(out, "%s%#.9gf,", (i % TRIG_TABLES_GEN_PER_LINE == 0U) ? "\n    " : " ", value);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static const int16_t trig_sin_q15_table[TRIG_TABLE_SIZE + 1U] = {");
+    for (unsigned i = 0U; i <= TRIG_TABLE_SIZE; ++i) {
+        long value = lround(32768.0 * sin(2.0 * TRIG_TABLES_GEN_PI * (double)i / (double)TRIG_TABLE_SIZE));
+        if (value > TRIG_Q15_ONE) {
+            value = TRIG_Q15_ONE;
+        }
+        fprintf(out, "%s%ld,", (i % TRIG_TABLES_GEN_PER_LINE == 0U) ? "\n    " : " ", value);
+    }
+    fprintf(out, "\n};\n\n");
+
+    /* CORDIC step angles atan(2^-i), with 2^32 counts per revolution to keep the sub-count bits */
+    double gain = 1.0;
+    fprintf(out, "static const int32_t trig_cordic_atan_table[TRIG_CORDIC_ITERATIONS] = {");
+    for (unsigned i = 0U; i < TRIG_CORDIC_ITERATIONS; ++i) {
+        const double step = atan(ldexp(1.0, -(int)i));
+        gain *= cos(step);
+        fprintf(out, "%s%ld,", (i % TRIG_TABLES_GEN_PER_LINE == 0U) ? "\n    " : " ",
+                lround(step / (2.0 * TRIG_TABLES_GEN_PI) * 4294967296.0));
+    }
+    fprintf(out, "\n};\n\n");
+
+    /* The rotations stretch the vector by 1/gain; starting from the gain makes the result unit length */
+    fprintf(out, "#define TRIG_CORDIC_GAIN_Q30 %ldL\n", lround(gain * 1073741824.0));
+
+    if (fclose(out) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    return 0;
+}